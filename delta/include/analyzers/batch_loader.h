@@ -0,0 +1,193 @@
+/**
+ * @file batch_loader.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This is how the lexical analyzer splits large notebooks into
+ *        lexemes on several threads.
+ *
+ * @details
+ *  A notebook that is mapped into memory is complete from the very
+ *  beginning, so its lines do not need to wait for the previous ones to be
+ *  parsed in order to be scanned. The loader splits it into chunks of whole
+ *  lines, and each chunk is scanned by its own thread through the batch
+ *  scanner (see analyzers/batch_scanner.h) into an array of lexemes, which
+ *  records where each of them is in its line.
+ *
+ *  The lexical analyzer takes the lexemes line by line, in the same order
+ *  as the lines are read, so the line and col counters, the
+ *  compiled-expressions cache and the errors work just as if the lines were
+ *  scanned right then. While a chunk is being analyzed, the next ones are
+ *  already being scanned, so only a few chunks are kept in memory at once.
+ *
+ *  Only the lexemes are found in parallel; turning them into lexical
+ *  components (i.e. looking identifiers up, converting numbers) is still
+ *  up to the lexical analyzer, in order.
+ */
+
+
+#ifndef D_BATCH_LOADER
+#define D_BATCH_LOADER
+
+
+#include "analyzers/batch_scanner.h"
+
+
+/* pthread_t */
+#include <pthread.h>
+/* size_t */
+#include <stddef.h>
+/* uint32_t */
+#include <stdint.h>
+
+
+/**
+ * @brief A lexeme that a thread has recognized (see
+ *        "d_batch_scanner_lexeme").
+ */
+struct d_batch_loader_token {
+    /** Where the lexeme starts in its line, after any blanks. */
+    uint32_t offset;
+    /** How many characters of the line the lexeme spans. */
+    uint32_t length;
+    /** The lexical component, if the lexeme is a 1-char operator or
+        separator. */
+    uint16_t lexical_component;
+    /** Which kind of lexeme it is (enum d_batch_scanner_kind). */
+    uint8_t kind;
+    /** Whether the lexeme goes on with the next line, which is then left
+        for the lexical analyzer to scan. */
+    uint8_t continues;
+};
+
+
+/**
+ * @brief A chunk of whole lines of the input, along with their lexemes.
+ */
+struct d_batch_loader_chunk {
+    /** Where the chunk starts in the input. */
+    const char *text;
+    /** The length of the chunk, up to the end of its last line. */
+    size_t length;
+
+    /** Index of the first lexeme of each line, plus the amount of lexemes
+        of the chunk at the end. */
+    size_t *line_tokens;
+    /** How many lines the chunk has. */
+    size_t line_count;
+    /** How many indices fit. */
+    size_t line_capacity;
+    /** The lexemes of all of the lines of the chunk. */
+    struct d_batch_loader_token *tokens;
+    /** How many lexemes there are. */
+    size_t token_count;
+    /** How many lexemes fit. */
+    size_t token_capacity;
+
+    /** The line that is being scanned, whose bit masks are reused by the
+        next chunks scanned in the same place of the ring. */
+    struct d_batch_scanner_line line;
+    /** The thread that scans the chunk. */
+    pthread_t thread;
+    /** Whether the thread has to be joined yet. */
+    int is_running;
+    /** 0 if the chunk has been scanned, -1 if memory ran out, 1 if it has a
+        line too long for the offsets of its lexemes. */
+    int status;
+
+    /** Index of the next line to be handed. */
+    size_t next_line;
+};
+
+
+/**
+ * @brief Splits an input into lexemes on several threads.
+ */
+struct d_batch_loader {
+    /** The input, which must outlive the loader. */
+    const char *text;
+    /** The length of the input. */
+    size_t length;
+    /** How many characters, at least, each chunk has. */
+    size_t chunk_size;
+
+    /** Chunks that are being scanned or analyzed, used as a ring: the one
+        that is being analyzed is followed by those that are being
+        scanned. */
+    struct d_batch_loader_chunk *chunks;
+    /** How many chunks the ring has. */
+    size_t chunk_count;
+    /** How many chunks have been handed to a thread so far. */
+    size_t started_count;
+    /** Index of the chunk that is being analyzed, from the beginning of
+        the input. */
+    size_t current_chunk;
+    /** Where the next chunk to be handed to a thread starts. */
+    size_t next_offset;
+};
+
+
+/**
+ * @brief Starts splitting the given input into lexemes.
+ *
+ * @param[out] loader The loader.
+ * @param[in] text The input, which must outlive the loader.
+ * @param[in] length The length of the input.
+ * @param[in] chunk_size How many characters, at least, each chunk has (the
+ *                       last one may have fewer).
+ * @param[in] thread_count How many chunks are scanned at once, ahead of
+ *                         the one that is being analyzed.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_batch_loader_start(
+    struct d_batch_loader *loader,
+    const char *text,
+    size_t length,
+    size_t chunk_size,
+    size_t thread_count
+);
+
+
+/**
+ * @brief Hands the lexemes of the line that starts at the given offset of
+ *        the input.
+ *
+ * @details
+ *  Lines must be asked for in order, from the first one, and none of them
+ *  may be skipped. A lexeme that goes on with the next line (see
+ *  "continues") is the last one of its line, and the loader should be
+ *  stopped then, as the next line no longer starts where it was scanned
+ *  from.
+ *
+ * @param[in,out] loader The loader.
+ * @param[in] offset Where the line starts in the input.
+ * @param[out] tokens The lexemes of the line.
+ * @param[out] token_count How many lexemes the line has.
+ *
+ * @return 0 if successful, any other value if the line could not be split
+ *         (the loader should be stopped then, and the rest of the input
+ *         scanned line by line).
+ */
+int d_batch_loader_next_line(
+    struct d_batch_loader *loader,
+    size_t offset,
+    const struct d_batch_loader_token **tokens,
+    size_t *token_count
+);
+
+
+/**
+ * @brief Waits for the threads that are still scanning, and frees the
+ *        chunks.
+ *
+ * @param[in,out] loader The loader.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_batch_loader_stop(
+    struct d_batch_loader *loader
+);
+
+
+#endif //D_BATCH_LOADER
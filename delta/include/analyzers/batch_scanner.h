@@ -0,0 +1,225 @@
+/**
+ * @file batch_scanner.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This is the scanner that the lexical analyzer uses for inputs that
+ *        are not interactive.
+ *
+ * @details
+ *  Flex's scanner (see analyzers/lexical.h) walks its tables one character
+ *  at a time. When nobody is typing the input (e.g. notebooks, texts handed
+ *  through the API, or a redirected stdin), lines are already complete, so
+ *  this hand-written scanner splits them instead: it recognizes the very
+ *  same lexemes as lexical.l's rules, with no tables at all.
+ *
+ *  Most runs of digits, of characters of identifiers, of blanks or of the
+ *  characters of strings are a few characters long, and are just walked.
+ *  Longer ones (e.g. long strings or indentation) are looked up instead:
+ *  the line gets classified 64 characters at a time (as two blocks of 32
+ *  with AVX2, four blocks of 16 with SSE2, or one by one otherwise) into a
+ *  bit mask for each class of characters, so that finding where a run ends
+ *  is a matter of counting trailing bits.
+ *
+ *  The scanner only finds where lexemes end and which kind they are; the
+ *  lexical analyzer still turns them into lexical components, so that both
+ *  scanners report the same semantic values, locations and errors.
+ */
+
+
+#ifndef D_BATCH_SCANNER
+#define D_BATCH_SCANNER
+
+
+/* size_t */
+#include <stddef.h>
+/* uint64_t */
+#include <stdint.h>
+
+
+/** How many classes of characters there are. */
+#define D_BATCH_SCANNER_CLASS_COUNT 4
+
+/** How many characters each bit mask of a class covers. */
+#define D_BATCH_SCANNER_WINDOW_SIZE 64
+
+
+/**
+ * @brief Kinds of lexemes that the scanner recognizes, one for each of
+ *        lexical.l's rules (those that report the same lexical component or
+ *        error share a kind).
+ */
+enum d_batch_scanner_kind {
+    /** A 1-char operator or separator. */
+    D_BATCH_SCANNER_COMPONENT,
+    /** Blanks at the end of a line, which are ignored. */
+    D_BATCH_SCANNER_BLANKS,
+    /** The end of a line. */
+    D_BATCH_SCANNER_EOL,
+    /** An identifier. */
+    D_BATCH_SCANNER_IDENTIFIER,
+    /** A base 10 integer number. */
+    D_BATCH_SCANNER_INTEGER,
+    /** A base 10 float number. */
+    D_BATCH_SCANNER_FLOAT,
+    /** A double quoted string, which is not empty. */
+    D_BATCH_SCANNER_STRING,
+
+    /** An empty string (i.e. "\"\""). */
+    D_BATCH_SCANNER_STRING_EMPTY,
+    /** A character that is not supported. */
+    D_BATCH_SCANNER_CHARACTER,
+    /** An integer that is followed by a letter other than 'E' -OR- 'e'. */
+    D_BATCH_SCANNER_INTEGER_BAD,
+    /** A float whose decimal dot is followed by a letter. */
+    D_BATCH_SCANNER_FLOAT_BAD_DOT,
+    /** A float whose decimals are followed by a letter other than 'E' -OR-
+        'e'. */
+    D_BATCH_SCANNER_FLOAT_BAD_DECIMALS,
+    /** A float whose 'E' -OR- 'e' is followed by neither a sign nor a
+        digit. */
+    D_BATCH_SCANNER_FLOAT_BAD_EXPONENT,
+    /** A float whose exponent's sign is not followed by a digit, or whose
+        exponent is followed by letters, digits or '_'. */
+    D_BATCH_SCANNER_FLOAT_BAD_SIGN,
+    /** A float whose exponent's digits are followed by a letter. */
+    D_BATCH_SCANNER_FLOAT_BAD_DIGITS
+};
+
+
+/**
+ * @brief Classes of characters that the scanner spans at once.
+ */
+enum d_batch_scanner_class {
+    /** [0-9] */
+    D_BATCH_SCANNER_CLASS_DIGIT,
+    /** [0-9a-zA-Z_], the characters of identifiers. */
+    D_BATCH_SCANNER_CLASS_WORD,
+    /** [ \t] */
+    D_BATCH_SCANNER_CLASS_BLANK,
+    /** Printable characters, those of strings (see lexical.l). */
+    D_BATCH_SCANNER_CLASS_PRINT
+};
+
+
+/**
+ * @brief A line to be scanned, along with the classes of its characters.
+ */
+struct d_batch_scanner_line {
+    /** The line, which does not need to be '\0' terminated. */
+    const char *text;
+    /** The length of the line. */
+    size_t length;
+    /** A bit mask for each class (D_BATCH_SCANNER_CLASS_COUNT in a row) of
+        each window of D_BATCH_SCANNER_WINDOW_SIZE characters of the line,
+        in which the i-th bit is set if the window's i-th character belongs
+        to the class. */
+    uint64_t *masks;
+    /** How many bit masks fit. */
+    size_t mask_capacity;
+    /** How many windows, from the beginning of the line, have been
+        classified yet. */
+    size_t classified_window_count;
+};
+
+
+/**
+ * @brief A lexeme that the scanner has recognized.
+ */
+struct d_batch_scanner_lexeme {
+    /** Which kind of lexeme it is. */
+    enum d_batch_scanner_kind kind;
+    /** The lexical component (D_LC_XYZ), if the lexeme is a 1-char operator
+        or separator. */
+    int lexical_component;
+    /** How many blanks come before the lexeme, which are skipped. */
+    size_t blanks;
+    /** How many characters of the line the lexeme spans, after the
+        blanks. */
+    size_t length;
+    /** Whether the lexeme is a malformed float whose 'E' -OR- 'e', or whose
+        exponent's sign, is followed by the end of the line. Flex would not
+        stop there, but go on with the characters of identifiers at the
+        beginning of the next line, which are part of the lexeme too. */
+    int continues;
+};
+
+
+/**
+ * @brief Sets the line that is to be scanned.
+ *
+ * @details
+ *  The line is not copied, so it must outlive its scanning. Its characters
+ *  are classified as the scanner needs them (i.e. only where runs are long
+ *  enough for it to pay off).
+ *
+ *  The bit masks of a previous line are reused, so "line" may be set as
+ *  many times as needed (it should be zeroed before the first one), and
+ *  released through "d_batch_scanner_release" at the end.
+ *
+ * @param[in,out] line The line to be scanned.
+ * @param[in] text The line, which does not need to be '\0' terminated.
+ * @param[in] length The length of the line.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_batch_scanner_set_line(
+    struct d_batch_scanner_line *line,
+    const char *text,
+    size_t length
+);
+
+
+/**
+ * @brief Recognizes the lexeme at the given offset of the given line, after
+ *        any blanks.
+ *
+ * @details
+ *  The lexeme is the longest one that any of lexical.l's rules match (the
+ *  first of them, if several do), just as flex's scanner would recognize it.
+ *  Lexemes never span several lines, but for malformed floats (see
+ *  "continues"). The last line of an input may lack its '\n'.
+ *
+ * @param[in,out] line The line.
+ * @param[in] offset Where the lexeme starts, which must be within the line.
+ * @param[out] lexeme The lexeme.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_batch_scanner_scan(
+    struct d_batch_scanner_line *line,
+    size_t offset,
+    struct d_batch_scanner_lexeme *lexeme
+);
+
+
+/**
+ * @brief Returns how many characters, from the given offset of the given
+ *        line on, belong to the given class.
+ *
+ * @param[in,out] line The line.
+ * @param[in] offset Where to start.
+ * @param[in] class The class of characters.
+ *
+ * @return How many characters there are, up to the end of the line.
+ */
+size_t d_batch_scanner_span(
+    struct d_batch_scanner_line *line,
+    size_t offset,
+    enum d_batch_scanner_class class
+);
+
+
+/**
+ * @brief Releases the bit masks of the given line.
+ *
+ * @param[in,out] line The line.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_batch_scanner_release(
+    struct d_batch_scanner_line *line
+);
+
+
+#endif //D_BATCH_SCANNER
@@ -36,6 +36,18 @@
  *    - Strings will carry a string that represent their quote-limited
  *      characters.
  *
+ *  The analyzer is reentrant: all of its state lives in the context (see
+ *  common/context.h) that is given to it, and the semantic values and
+ *  locations of lexical components are handed to the syntactic & semantic
+ *  analyzer through its own variables instead of global ones.
+ *
+ *  Flex's scanner analyzes what the user types in a terminal. Any other
+ *  input (e.g. notebooks, texts, or a redirected stdin) is analyzed by a
+ *  hand-written scanner (see analyzers/batch_scanner.h), which works on
+ *  whole lines and recognizes the very same lexical components. Large
+ *  notebooks may also be split into lexemes on several threads beforehand
+ *  (see analyzers/batch_loader.h), if asked to.
+ *
  * @see https://github.com/westes/flex
  */
 
@@ -44,32 +56,11 @@
 #define D_LEXICAL_ANALYZER
 
 
-/* size_t */
-#include <stddef.h>
-
-
-/**
- * @brief Path to the file that is currently being read.
- */
-extern const char *d_lex_current_file;
-
-/**
- * @brief If the lexical analyzer is currently reading input from stdin or
- *        not.
- */
-extern int d_lex_is_stdin;
-
+#include "common/context.h"
 
-/**
- * @brief How many '\n' have been seen in the input file that is being
- *        analyzed.
- */
-extern size_t d_lex_current_line;
 
-/**
- * @brief How many characters have been seen in the current line.
- */
-extern size_t d_lex_current_column;
+/* size_t */
+#include <stddef.h>
 
 
 /**
@@ -88,16 +79,29 @@ struct d_lexical_component {
 
 
 /**
- * @brief Initializes the lexical analyzer.
+ * @brief Represents the state of a lexical analyzer.
+ *
+ * @details
+ *  Opaque data type, which holds flex's own state, the stack of input files,
+ *  and the line that is currently being analyzed.
+ */
+struct d_lexical_state;
+
+
+/**
+ * @brief Initializes the lexical analyzer of the given context.
  *
  * @details
  *  Initializes the lexical analyzer, setting stdin as the default input
- *  source.
+ *  source. Nothing is read, nor allocated to read it, until the syntactic &
+ *  semantic analyzer asks for the first lexical component.
+ *
+ * @param[in,out] context The context.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_lexical_analyzer_initialize(
-    void
+    struct d_context *context
 );
 
 
@@ -109,43 +113,150 @@ int d_lexical_analyzer_initialize(
  *  current input file, as well as all of its metadata, must be stored in the
  *  stack for later usage.
  *
+ *  Regular files are mapped into memory, so that their lines are analyzed
+ *  right where they are; anything else (e.g. pipes) is read in chunks, just
+ *  as stdin. A mapped file must not be truncated while it is being read.
+ *
+ *  Compiled notebooks (see interpreter/notebook.h) run the lines that have
+ *  programs as they were compiled, and only the rest are analyzed. If a
+ *  compiled notebook is stale or not valid, its source is read instead.
+ *
+ * @param[in,out] context The context.
  * @param[in] filename Absolute or relative path to the new input file.
  * 
  * @return 0 if successful, any other value otherwise.
  */
 int d_lexical_analyzer_new_file(
+    struct d_context *context,
     const char *filename
 );
 
 
+/**
+ * @brief Prepares to read the given text, just as a new input file.
+ *
+ * @details
+ *  The text is read just as a file that has been pushed through
+ *  "d_lexical_analyzer_new_file", although its last line does not need to be
+ *  '\n'-terminated. Once the whole text has been read, the end of the input
+ *  is reported, so that the syntactic & semantic analyzer stops parsing.
+ *
+ *  The text is not copied, so it must remain valid until it has been read.
+ *
+ * @param[in,out] context The context.
+ * @param[in] text The text, which does not need to be '\0' terminated.
+ * @param[in] length The length of the text.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_lexical_analyzer_new_string(
+    struct d_context *context,
+    const char *text,
+    size_t length
+);
+
+
 /**
  * @brief Closes the current input file.
  *
  * @details
  *  Closes the current input file, and restores the file represented by
  *  the currently accessible entry in the stack. Note that a "pop" may
- *  only be issued if a corresponding "new_file" has been called
- *  previously. Otherwise, you may end up trying to close stdin.
+ *  only be issued if a corresponding "new_file" (or "new_string") has been
+ *  called previously. Otherwise, you may end up trying to close stdin.
+ *
+ * @param[in,out] context The context.
  * 
  * @return 0 if successful, any other value otherwise.
  */
 int d_lexical_analyzer_pop_file(
-    void
+    struct d_context *context
+);
+
+
+/**
+ * @brief Chooses whether stdin is read once every other input has ended.
+ *
+ * @details
+ *  By default, it is read by all contexts but embedded ones (see
+ *  common/context.h), which only analyze the texts that they are handed.
+ *  Otherwise, the input ends, as it does for texts, once the last file that
+ *  has been pushed through "d_lexical_analyzer_new_file" ends (e.g. to run
+ *  some files and exit).
+ *
+ * @param[in,out] context The context.
+ * @param[in] is_enabled Whether stdin is to be read.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_lexical_analyzer_use_stdin(
+    struct d_context *context,
+    int is_enabled
 );
 
 
 /**
- * @brief The lexical analyzer identifies the next lexical component in the
- *        current source file.
+ * @brief Chooses which scanner analyzes the inputs that are not typed in a
+ *        terminal.
  *
  * @details
- *  If there is no source file specified, the analyzer will just take data
- *  from stdin by default.
+ *  By default, such inputs are analyzed by the batch scanner (see
+ *  analyzers/batch_scanner.h), but they may be analyzed by flex's too (e.g.
+ *  to compare both of them). It should be chosen before any input has been
+ *  analyzed, as flex's scanner may hold the part of a line that it has not
+ *  analyzed yet.
+ *
+ * @param[in,out] context The context.
+ * @param[in] is_enabled Whether the batch scanner is to be used.
  *
  * @return 0 if successful, any other value otherwise.
  */
-int yylex(
-    void
+int d_lexical_analyzer_use_batch_scanner(
+    struct d_context *context,
+    int is_enabled
+);
+
+
+/**
+ * @brief Chooses how many threads may split large notebooks into lexemes.
+ *
+ * @details
+ *  Notebooks that are larger than a few chunks may be split into lexemes
+ *  on several threads (see analyzers/batch_loader.h), as long as the batch
+ *  scanner is used. By default there is just one thread, so notebooks are
+ *  scanned line by line. Threads are capped to a limit, and the choice
+ *  applies to the notebooks that are loaded afterwards.
+ *
+ * @param[in,out] context The context.
+ * @param[in] thread_count How many threads, the one that analyzes the
+ *                         input included; 1 means that notebooks are
+ *                         scanned line by line, and 0 that there are as
+ *                         many threads as processors.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_lexical_analyzer_use_threads(
+    struct d_context *context,
+    size_t thread_count
+);
+
+
+/**
+ * @brief Returns the line that is currently being analyzed.
+ *
+ * @details
+ *  Input is read line by line, so the returned line is the one to which the
+ *  last recognized lexical component belongs. It is only valid until the
+ *  next line is read, or until its input file is popped.
+ *
+ * @param[in] context The context.
+ * @param[out] length The length of the line.
+ *
+ * @return The line, which is not '\0' terminated.
+ */
+const char *d_lexical_analyzer_get_current_line(
+    struct d_context *context,
+    size_t *length
 );
 
 
@@ -154,11 +265,15 @@ int yylex(
  *
  * @details
  *  Destroys the lexical analyzer, while also closing any still opened files.
+ *  "yylex", which is declared along with the lexical components, identifies
+ *  the next lexical component.
+ *
+ * @param[in,out] context The context.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_lexical_analyzer_destroy(
-    void
+    struct d_context *context
 );
 
 
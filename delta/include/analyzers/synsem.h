@@ -20,6 +20,10 @@
  *
  *  TODO which sentences are valid?
  *
+ *  Both analyzers are reentrant: they work on the context (see
+ *  common/context.h) that they are given, so that multiple interpreters may
+ *  parse their own input at the same time.
+ *
  * @see https://www.gnu.org/software/bison/
  * @see flex & bison by John Levine, 1st edition, chapter 2.5
  */
@@ -30,37 +34,30 @@
 
 
 #include "analyzers/lexical.h"
+#include "common/context.h"
 #include "common/symbol_table.h"
+#include "interpreter/notebook.h"
 
 
 /**
- * @brief Flag that tells the syntactic & semantic analyzer if it must request
- *        the lexical analyzer to read another file.
+ * @brief Represents the state of a syntactic & semantic analyzer.
  *
  * @details
- *  Flag that tells the syntactic & semantic analyzer if it must request the
- *  lexical analyzer to read another file. Depending on its value:
- *
- *    - 0: no other file needs to be read.
- *    - Otherwise: after reading the whole current line, the request will be
- *                 issued to the lexical analyzer and the flag's value will be
- *                 reset.
- */
-extern int d_synsem_load_file;
-
-/**
- * @brief Path of the other file that the lexical analyzer must read, if any.
+ *  Opaque data type, which holds the ASTs of the line that is being analyzed
+ *  and the program that may be cached from it.
  */
-extern const char *d_synsem_load_file_path;
+struct d_synsem_state;
 
 
 /**
- * @brief Initializes the syntactic analyzer.
+ * @brief Initializes the syntactic analyzer of the given context.
+ *
+ * @param[in,out] context The context.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_synsem_analyzer_initialize(
-    void
+    struct d_context *context
 );
 
 
@@ -72,20 +69,94 @@ int d_synsem_analyzer_initialize(
  *  lexical components that it can find in the user-given input. This process
  *  will just continue as long as no "quit" request is issued by the user.
  *
+ * @param[in,out] context The context.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int d_synsem_analyzer_parse(
-    void
+    struct d_context *context
+);
+
+
+/**
+ * @brief Runs a whole input line from the compiled-expressions cache, if it
+ *        is found in it.
+ *
+ * @details
+ *  The lexical analyzer asks for this before analyzing each line. If the
+ *  line's program is cached (see interpreter/cache.h), it is run just as if
+ *  the line had been analyzed once again, and the line must then be skipped.
+ *
+ * @param[in,out] context The context.
+ * @param[in] line The line, as it has been read.
+ * @param[in] length The length of the line.
+ *
+ * @return 0 if the line has been run from the cache, any other value
+ *         otherwise.
+ */
+int d_synsem_analyzer_run_cached_line(
+    struct d_context *context,
+    const char *line,
+    size_t length
+);
+
+
+/**
+ * @brief Runs a line of a compiled notebook as it was compiled, if it can.
+ *
+ * @details
+ *  The lexical analyzer asks for this before analyzing each line of a
+ *  compiled notebook (see interpreter/notebook.h). If the line has a program,
+ *  and its names are still what they were when it was compiled, it is run
+ *  just as if the line had been analyzed, and the line must then be
+ *  skipped.
+ *
+ * @param[in,out] context The context.
+ * @param[in,out] notebook The compiled notebook, or NULL if the current input
+ *                         is not one.
+ * @param[in] statement The line, which must be the last one that the
+ *                      notebook has handed.
+ *
+ * @return 0 if the line has been run, any other value otherwise.
+ */
+int d_synsem_analyzer_run_compiled_line(
+    struct d_context *context,
+    struct d_notebook *notebook,
+    const struct d_notebook_statement *statement
+);
+
+
+/**
+ * @brief Analyzes the current input without running it, adding the programs
+ *        of its lines to the given compiled notebook.
+ *
+ * @details
+ *  Mathematical expressions are compiled, but not run, and built-in commands
+ *  are not run either. Each line whose analysis does not raise any errors is
+ *  added, along with its program, to the compiled notebook, and no line is
+ *  run from the compiled-expressions cache.
+ *
+ * @param[in,out] context The context, which should be used for nothing else
+ *                        (see interpreter/notebook.h/d_notebook_compile).
+ * @param[in,out] writer The compiled notebook.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_synsem_analyzer_compile(
+    struct d_context *context,
+    struct d_notebook_writer *writer
 );
 
 
 /**
- * @brief Destroys the syntactic analyzer.
+ * @brief Destroys the syntactic analyzer of the given context.
+ *
+ * @param[in,out] context The context.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_synsem_analyzer_destroy(
-    void
+    struct d_context *context
 );
 
 
@@ -0,0 +1,140 @@
+/**
+ * @file delta.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This is the API through which other programs may embed delta.
+ *
+ * @details
+ *  This is the API through which other programs may embed delta, which is
+ *  built as a library ("libdelta") for that purpose. Each interpreter is
+ *  represented by its own context (see common/context.h), which holds its
+ *  workspace and its compiled-expressions cache, so that they are kept
+ *  between evaluations:
+ *
+ *    struct d_context *context = d_ctx_new();
+ *    struct d_dec_number result;
+ *
+ *    d_ctx_eval(context, "a = 2;\na ^ 10", 14, &result);
+ *    d_ctx_free(context);
+ *
+ *  An embedded interpreter does not show the intro tip, the prompt, nor the
+ *  values of mathematical expressions, which are handed back instead. Errors
+ *  are still reported through stderr, and the built-in commands still write
+ *  to stdout.
+ *
+ *  A context may only be used by one thread at a time, but each thread may
+ *  have its own.
+ */
+
+
+#ifndef D_API
+#define D_API
+
+
+#include "common/context.h"
+#include "math/dec_numbers.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/**
+ * @brief Creates a new embedded interpreter.
+ *
+ * @return The interpreter's context, which must be freed through
+ *         "d_ctx_free", or NULL if failed.
+ */
+struct d_context *d_ctx_new(
+    void
+);
+
+
+/**
+ * @brief Evaluates the given statements.
+ *
+ * @details
+ *  The statements are analyzed just as the lines of a notebook, one per
+ *  line, although the last line does not need to be '\n'-terminated. Their
+ *  effects on the workspace are kept.
+ *
+ * @param[in,out] context The context.
+ * @param[in] text The statements, which do not need to be '\0' terminated.
+ * @param[in] length The length of the statements.
+ * @param[out] result The value of the last mathematical expression that has
+ *                    been evaluated, whether it ends with ';' or not. It is
+ *                    not modified if there is none. If it is an array (see
+ *                    math/dec_arrays.h), it is owned by the context, and it
+ *                    stays valid until it is released through
+ *                    "d_ctx_release".
+ *
+ * @return 0 if successful, 1 if no mathematical expression has been
+ *         evaluated, any other value if any errors have been reported.
+ */
+int d_ctx_eval(
+    struct d_context *context,
+    const char *text,
+    size_t length,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Sets the value of the specified variable.
+ *
+ * @details
+ *  The variable is declared if it is not yet. Mathematical constants,
+ *  functions and built-in commands cannot be overwritten.
+ *
+ * @param[in,out] context The context.
+ * @param[in] name The variable's name, which must be a valid identifier.
+ * @param[in] value The variable's new value. It may only be an array if it
+ *                  has been handed back by the same context, and it has not
+ *                  been released yet.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_ctx_set_var(
+    struct d_context *context,
+    const char *name,
+    const struct d_dec_number *value
+);
+
+
+/**
+ * @brief Releases a value that has been handed back by "d_ctx_eval".
+ *
+ * @details
+ *  Arrays are kept valid until they are released, even across evaluations,
+ *  so every array that is handed back should be released once it is no
+ *  longer needed. Single numbers do not need to be released, although it is
+ *  harmless to do so. Once released, the value may no longer be used.
+ *
+ * @param[in,out] context The context that handed the value back.
+ * @param[in] value The value.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_ctx_release(
+    struct d_context *context,
+    const struct d_dec_number *value
+);
+
+
+/**
+ * @brief Frees an embedded interpreter.
+ *
+ * @details
+ *  Any dynamic libraries that it has loaded are closed.
+ *
+ * @param[in,out] context The context.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_ctx_free(
+    struct d_context *context
+);
+
+
+#endif //D_API
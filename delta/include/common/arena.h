@@ -0,0 +1,157 @@
+/**
+ * @file arena.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the region-based allocator that delta uses for
+ *        short-lived and bulk-freed data.
+ *
+ * @details
+ *  This file contains the region-based allocator (arena) that delta uses for
+ *  data whose lifetime is bound to a well-known phase of the interpretation
+ *  process, such as the expression trees that are built for each input line.
+ *
+ *  An arena hands out memory by just bumping a pointer inside a big block, and
+ *  it requests a new block whenever the current one is exhausted. Individual
+ *  allocations are never freed; instead, the whole arena gets reset at once,
+ *  which is O(1) regarding the amount of allocations that were made.
+ */
+
+
+#ifndef D_ARENA
+#define D_ARENA
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/** Default size in bytes of each block that an arena requests. */
+#define D_ARENA_DEFAULT_BLOCK_SIZE 4096
+
+/** All allocations but strings are rounded up to this alignment, which is
+    enough for any of delta's data types (int64_t, double, pointers).
+    Therefore, allocations of the same size that share a block are laid out
+    just as an array. */
+#define D_ARENA_ALIGNMENT 16
+
+
+/**
+ * @brief Represents a block of memory that belongs to an arena.
+ *
+ * @details
+ *  Blocks are chained so that all of them may be freed when the arena gets
+ *  reset or destroyed.
+ */
+struct d_arena_block {
+    /** Block that was in use before this one, if any. */
+    struct d_arena_block *previous_block;
+
+    /** How many bytes can be handed out from this block. */
+    size_t size;
+    /** How many bytes have already been handed out from this block. */
+    size_t used;
+
+    /** The memory itself, which is placed right after this header. */
+    unsigned char *data;
+};
+
+
+/**
+ * @brief Represents an arena.
+ */
+struct d_arena {
+    /** Block from which memory is currently being handed out. */
+    struct d_arena_block *current_block;
+
+    /** Minimum size in bytes of each new block. */
+    size_t block_size;
+};
+
+
+/**
+ * @brief Initializes the given arena.
+ *
+ * @details
+ *  No memory is requested until the first allocation takes place.
+ *
+ * @param[out] arena The arena.
+ * @param[in] block_size Minimum size in bytes of each block that the arena
+ *                       will request.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_arena_initialize(
+    struct d_arena *arena,
+    size_t block_size
+);
+
+
+/**
+ * @brief Allocates memory from the given arena.
+ *
+ * @details
+ *  The returned memory is suitably aligned for any of delta's data types, and
+ *  it remains valid until the arena is reset or destroyed.
+ *
+ * @param[in,out] arena The arena.
+ * @param[in] size How many bytes are requested.
+ *
+ * @return Pointer to the requested memory, or NULL if failed.
+ */
+void *d_arena_allocate(
+    struct d_arena *arena,
+    size_t size
+);
+
+
+/**
+ * @brief Copies the given string into the given arena.
+ *
+ * @details
+ *  Unlike "d_arena_allocate", strings are not aligned, so that they are
+ *  packed one after another. It allows an arena to act as a pool of strings
+ *  that are kept together in memory (i.e. the lexemes of the symbol table).
+ *
+ * @param[in,out] arena The arena.
+ * @param[in] string The string, which does not need to be '\0' terminated.
+ * @param[in] length The length of the string.
+ *
+ * @return The '\0' terminated copy, or NULL if failed.
+ */
+char *d_arena_copy_string(
+    struct d_arena *arena,
+    const char *string,
+    size_t length
+);
+
+
+/**
+ * @brief Releases all allocations that have been made from the given arena.
+ *
+ * @details
+ *  The most recently requested block is kept so that the arena does not need
+ *  to request memory again right away, while all other blocks are freed.
+ *
+ * @param[in,out] arena The arena.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_arena_reset(
+    struct d_arena *arena
+);
+
+
+/**
+ * @brief Destroys the given arena, freeing all of its blocks.
+ *
+ * @param[in,out] arena The arena.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_arena_destroy(
+    struct d_arena *arena
+);
+
+
+#endif //D_ARENA
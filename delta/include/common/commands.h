@@ -25,11 +25,24 @@
  *
  *    - load(file): opens a file which contains statements written in the
  *                  delta's language; they are all executed as they are read.
+ *    - compile(file): analyzes a notebook without running it, and writes
+ *                     its programs into a compiled notebook, which loads
+ *                     faster (see interpreter/notebook.h).
  *
  *    - ws(): shows the current workspace; that is, shows the symbol table.
  *    - wcs(): clears all registered variables in the current workspace.
  *
+ *    - cache(): shows the statistics of the compiled-expressions cache.
+ *    - jit(mode): enables ("on") or disables ("off") the compilation of hot
+ *                 expressions into native code.
+ *    - format(mode): shows floating point values with the fewest digits
+ *                    that are read back as them ("shortest"), or as older
+ *                    versions of delta did ("compat").
+ *
  *    - quit(): exits delta.
+ *
+ *  Commands operate on the context (see common/context.h) of the interpreter
+ *  from which they are issued.
  */
 
 
@@ -37,6 +50,9 @@
 #define D_COMMANDS
 
 
+#include "common/context.h"
+
+
 /** Which numeric code the "quit" command will return in order to point out
     that the program must end its execution. This value must be understood by
     the lexical and semantic analyzer in order to stop parsing. */
@@ -44,8 +60,8 @@
 
 
 /** Templates for the functions that implement the built-in commands. */
-typedef int (*comm_function_0) (void);
-typedef int (*comm_function_1) (const char *);
+typedef int (*comm_function_0) (struct d_context *);
+typedef int (*comm_function_1) (struct d_context *, const char *);
 
 
 /**
@@ -82,19 +98,35 @@ struct d_command {
 /** 0 args commands **/
 
 /** Which names the user may specify to call the no arg built-in commands. */
-extern const char *D_COMMANDS_NAMES_0[4];
+extern const char *D_COMMANDS_NAMES_0[5];
 
 /** Pointers to the implementations of the no arg built-in commands. */
-extern const comm_function_0 D_COMMANDS_IMPLEMENTATIONS_0[4];
+extern const comm_function_0 D_COMMANDS_IMPLEMENTATIONS_0[5];
 
 
 /** 1 args commands **/
 
 /** Which names the user may specify to call the 1 arg built-in commands. */
-extern const char *D_COMMANDS_NAMES_1[4];
+extern const char *D_COMMANDS_NAMES_1[7];
 
 /** Pointers to the implementations of the 1 arg built-in commands. */
-extern const comm_function_1 D_COMMANDS_IMPLEMENTATIONS_1[4];
+extern const comm_function_1 D_COMMANDS_IMPLEMENTATIONS_1[7];
+
+
+/**
+ * @brief Closes all dynamic libraries that the given context has loaded.
+ *
+ * @details
+ *  Any math functions that were loaded from them must not be called
+ *  afterwards.
+ *
+ * @param[in,out] context The context.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_commands_close_libraries(
+    struct d_context *context
+);
 
 
 #endif //D_COMMANDS
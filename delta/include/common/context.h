@@ -0,0 +1,185 @@
+/**
+ * @file context.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the context that holds the whole state of a
+ *        delta interpreter.
+ *
+ * @details
+ *  This file contains the context that holds the whole state of a delta
+ *  interpreter: its workspace (symbol table), the dynamic libraries that it
+ *  has loaded, its compiled-expressions cache, and the state of its lexical
+ *  and syntactic & semantic analyzers, including the stack of files that are
+ *  being read.
+ *
+ *  Every component of delta receives the context on which it must operate,
+ *  instead of relying on global variables. Therefore, multiple interpreters
+ *  may live in the same process, as long as each context is only used by one
+ *  thread at a time.
+ *
+ *  A context may be driven by a user through a terminal, or it may be
+ *  embedded in another program (see api/delta.h). In the latter case, the
+ *  values of mathematical expressions are kept in the context instead of
+ *  being shown.
+ */
+
+
+#ifndef D_CONTEXT
+#define D_CONTEXT
+
+
+#include "math/dec_numbers.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/* Opaque data types, which are defined by the components that use them */
+
+/** See common/symbol_table.h */
+struct d_symbol_table;
+/** See common/commands.h */
+struct d_commands_library;
+/** See interpreter/cache.h */
+struct d_cache;
+/** See math/dec_arrays.h */
+struct d_dec_arrays;
+/** See analyzers/lexical.h */
+struct d_lexical_state;
+/** See analyzers/synsem.h */
+struct d_synsem_state;
+
+
+/**
+ * @brief How a delta interpreter interacts with whoever drives it.
+ */
+enum d_context_mode {
+    /** A user types in statements: the intro tip, the prompt and the values
+        of mathematical expressions are shown. */
+    D_CONTEXT_MODE_INTERACTIVE,
+    /** Statements are piped in (i.e. by a script): the values of
+        mathematical expressions are shown, but neither the intro tip nor
+        the prompt, and stdout is not flushed before reading more input. */
+    D_CONTEXT_MODE_BATCH,
+    /** Another program hands statements to the interpreter: only built-in
+        commands write to stdout. */
+    D_CONTEXT_MODE_EMBEDDED
+};
+
+
+/**
+ * @brief Represents the state of a delta interpreter.
+ */
+struct d_context {
+
+    /** How the interpreter interacts with whoever drives it. */
+    enum d_context_mode mode;
+    /** If the interpreter may not reach the file system, load dynamic
+        libraries, nor change settings that are shared by the whole process
+        (i.e. when it serves a remote client). */
+    int is_sandboxed;
+
+
+    /* ═══ Workspace ═══ */
+
+    /** The symbol table. */
+    struct d_symbol_table *symbol_table;
+
+    /** The dynamic libraries that have been loaded, in a hash table. */
+    struct d_commands_library *libraries;
+    /** The last selected dynamic library, from which math functions are
+        loaded. */
+    struct d_commands_library *last_library;
+
+    /** The compiled-expressions cache. */
+    struct d_cache *cache;
+
+    /** The heap that holds the arrays of all values. */
+    struct d_dec_arrays *arrays;
+
+
+    /* ═══ Lexical analysis ═══ */
+
+    /** The lexical analyzer's own state. */
+    struct d_lexical_state *lexical;
+
+    /** Path to the file that is currently being read. */
+    const char *current_file;
+    /** If the file that is currently being read is stdin, or if there is
+        none left, as stdin comes next (see
+        analyzers/lexical.h/d_lexical_analyzer_use_stdin). */
+    int is_stdin;
+
+    /** How many '\n' have been seen in the current file, plus 1. */
+    size_t current_line;
+    /** How many characters have been seen in the current line, plus 1. */
+    size_t current_column;
+
+
+    /* ═══ Syntactic & semantic analysis ═══ */
+
+    /** The syntactic & semantic analyzer's own state. */
+    struct d_synsem_state *synsem;
+
+    /** Path of another file that the lexical analyzer must read once the
+        current line has been analyzed, or NULL. It is owned by the
+        context. */
+    char *load_file_path;
+
+    /** Value of the last mathematical expression that has been evaluated,
+        whether it has been shown or not. */
+    struct d_dec_number last_value;
+    /** If "last_value" holds any value. */
+    int has_last_value;
+
+
+    /* ═══ Errors ═══ */
+
+    /** How many parsing errors have been shown so far. It allows telling if
+        some process has raised any errors, by comparing its value before and
+        after it. */
+    size_t error_count;
+    /** If parsing errors are just counted, rather than shown (i.e. while
+        compiling a notebook, whose lines that raise them are analyzed again
+        once it is loaded). */
+    int are_errors_hidden;
+};
+
+
+/**
+ * @brief Initializes the given context.
+ *
+ * @details
+ *  All of its components are initialized, so that it is ready to analyze
+ *  stdin.
+ *
+ * @param[out] context The context.
+ * @param[in] mode How the interpreter interacts with whoever drives it.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_context_initialize(
+    struct d_context *context,
+    enum d_context_mode mode
+);
+
+
+/**
+ * @brief Destroys the given context.
+ *
+ * @details
+ *  All of its components are destroyed, and any dynamic libraries that it
+ *  loaded are closed.
+ *
+ * @param[in,out] context The context.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_context_destroy(
+    struct d_context *context
+);
+
+
+#endif //D_CONTEXT
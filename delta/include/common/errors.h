@@ -29,6 +29,12 @@
 
 // For functions with a variable amout of arguments
 #include <stdarg.h>
+/* size_t */
+#include <stddef.h>
+
+
+/** See common/context.h */
+struct d_context;
 
 
 #define D_ERR_DISTANCE_CATEGORY 1000
@@ -62,6 +68,7 @@
 #define D_ERR_LEX_INTEGERS 2320
 #define D_ERR_LEX_LITERALS_INTEGERS_BAD 2321
 #define D_ERR_LEX_LITERALS_INTEGERS_BINARY_BAD 2322
+#define D_ERR_LEX_LITERALS_INTEGERS_RANGE 2323
 #define D_ERR_LEX_LITERALS_STRINGS 2330
 #define D_ERR_LEX_LITERALS_STRING_EMPTY 2331
 
@@ -77,6 +84,8 @@
 #define D_ERR_SEM_DIVISION_BY_ZERO 4001
 #define D_ERR_SEM_INCORRECT_ARG_COUNT 4002
 #define D_ERR_SEM_INCORRECT_ARG_TYPE 4003
+#define D_ERR_SEM_ARRAY_LENGTHS_DIFFER 4004
+#define D_ERR_SEM_ARRAY_NESTED 4005
 
 
 /* Category: other user errors */
@@ -88,6 +97,9 @@
 #define D_ERR_USER_IO_FUNCTION_INACCESSIBLE 5102
 #define D_ERR_USER_IO_NO_DYN_LIBRARY_SELECTED 5103
 #define D_ERR_USER_IO_FUNCTION_NAME_TAKEN 5104
+#define D_ERR_USER_IO_SANDBOXED 5105
+#define D_ERR_USER_IO_NOT_A_NOTEBOOK 5106
+#define D_ERR_USER_IO_FILE_UNWRITABLE 5107
 
 
 /**
@@ -107,7 +119,10 @@ const char *d_errors_get_template(
  * @brief Outputs a parsing error message.
  *
  * @details
- *  A given parsing error message is shown through the standard output.
+ *  A given parsing error message is shown through the standard output. It
+ *  is reported as coming from the file that the given context is reading,
+ *  and counted in its "error_count" (even if the context hides its errors,
+ *  see "are_errors_hidden").
  *
  *  Its arguments are:
  *
@@ -128,10 +143,12 @@ const char *d_errors_get_template(
  *  "stdarg.h" library which will allow recognizing a variable amount of
  *  custom values.
  *
+ * @param[in,out] context The context.
  * @param[in] arg_count How many arguments are in total.
  * @param[in] ... The arguments themselves.
  */
 void d_errors_parse_show(
+    struct d_context *context,
     int arg_count,
     ...
 );
@@ -1,8 +1,8 @@
-/* A Bison parser, made by GNU Bison 3.5.1.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2020 Free Software Foundation,
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
    Inc.
 
    This program is free software: you can redistribute it and/or modify
@@ -16,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -31,8 +31,9 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Undocumented macros, especially those whose name start with YY_,
-   are private implementation details.  Do not rely on them.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
 
 #ifndef YY_YY_INCLUDE_COMMON_LEXICAL_COMP_H_INCLUDED
 # define YY_YY_INCLUDE_COMMON_LEXICAL_COMP_H_INCLUDED
@@ -52,10 +53,22 @@ extern int yydebug;
 
     #include "analyzers/synsem.h"
 
+    #include "common/arena.h"
+    #include "common/context.h"
     #include "common/errors.h"
     #include "common/help.h"
     #include "common/symbol_table.h"
 
+    #include "interpreter/ast.h"
+    #include "interpreter/bytecode.h"
+    #include "interpreter/cache.h"
+    #include "interpreter/notebook.h"
+    #include "interpreter/optimizer.h"
+    #include "interpreter/vm.h"
+
+    #include "math/dec_arrays.h"
+    #include "math/dec_format.h"
+
 
     #include <stdio.h>
     #include <stdlib.h>
@@ -63,65 +76,75 @@ extern int yydebug;
     /* For some basic operations that are expected to be available in a
        calculator */
     #include <math.h>
-    // To print int64_t data type
-    #include <inttypes.h>
 
 
     /* ═══════════════ */
     /* ═══ Defines ═══ */
     /* ═══════════════ */
 
-    /** Max length of string literals. Setting a static buffer for these
-        literals will avoid having to constantly reserve and free memory. */
-    #define D_LC_LITERAL_STR_MAX_LENGTH 256
-
     /** Which string is shown as prompt when delta is waiting for orders. */
     #define D_SYNSEM_PROMPT ">> "
 
-#line 82 "include/common/lexical_comp.h"
+#line 89 "include/common/lexical_comp.h"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    D_LC_WHITESPACE_EOF = 258,
-    D_LC_WHITESPACE_EOL = 259,
-    D_LC_SEPARATOR_SEMICOL = 260,
-    D_LC_LITERAL_STR = 261,
-    D_LC_IDENTIFIER_COMMAND = 262,
-    D_LC_IDENTIFIER_CONSTANT = 263,
-    D_LC_IDENTIFIER_FUNCTION = 264,
-    D_LC_IDENTIFIER_VARIABLE = 265,
-    D_LC_LITERAL_INT = 266,
-    D_LC_LITERAL_FP = 267,
-    D_LC_OP_ASSIGNMENT_ASSIGN = 268,
-    D_LC_OP_ARITHMETIC_PLUS = 269,
-    D_LC_OP_ARITHMETIC_MINUS = 270,
-    D_LC_OP_ARITHMETIC_TIMES = 271,
-    D_LC_OP_ARITHMETIC_DIV = 272,
-    D_LC_OP_ARITHMETIC_MOD = 273,
-    D_LC_SEPARATOR_L_PARENTHESIS = 274,
-    D_LC_SEPARATOR_R_PARENTHESIS = 275,
-    D_LC_OP_ARITHMETIC_NEG = 276,
-    D_LC_OP_ARITHMETIC_EXPONENT = 277
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    D_LC_WHITESPACE_EOF = 258,     /* D_LC_WHITESPACE_EOF  */
+    D_LC_WHITESPACE_EOL = 259,     /* D_LC_WHITESPACE_EOL  */
+    D_LC_SEPARATOR_SEMICOL = 260,  /* D_LC_SEPARATOR_SEMICOL  */
+    D_LC_LITERAL_STR = 261,        /* D_LC_LITERAL_STR  */
+    D_LC_IDENTIFIER_COMMAND = 262, /* D_LC_IDENTIFIER_COMMAND  */
+    D_LC_IDENTIFIER_CONSTANT = 263, /* D_LC_IDENTIFIER_CONSTANT  */
+    D_LC_IDENTIFIER_FUNCTION = 264, /* D_LC_IDENTIFIER_FUNCTION  */
+    D_LC_IDENTIFIER_VARIABLE = 265, /* D_LC_IDENTIFIER_VARIABLE  */
+    D_LC_LITERAL_INT = 266,        /* D_LC_LITERAL_INT  */
+    D_LC_LITERAL_FP = 267,         /* D_LC_LITERAL_FP  */
+    D_LC_OP_ASSIGNMENT_ASSIGN = 268, /* D_LC_OP_ASSIGNMENT_ASSIGN  */
+    D_LC_OP_ARITHMETIC_PLUS = 269, /* D_LC_OP_ARITHMETIC_PLUS  */
+    D_LC_OP_ARITHMETIC_MINUS = 270, /* D_LC_OP_ARITHMETIC_MINUS  */
+    D_LC_OP_ARITHMETIC_TIMES = 271, /* D_LC_OP_ARITHMETIC_TIMES  */
+    D_LC_OP_ARITHMETIC_DIV = 272,  /* D_LC_OP_ARITHMETIC_DIV  */
+    D_LC_OP_ARITHMETIC_MOD = 273,  /* D_LC_OP_ARITHMETIC_MOD  */
+    D_LC_SEPARATOR_L_PARENTHESIS = 274, /* D_LC_SEPARATOR_L_PARENTHESIS  */
+    D_LC_SEPARATOR_R_PARENTHESIS = 275, /* D_LC_SEPARATOR_R_PARENTHESIS  */
+    D_LC_SEPARATOR_L_BRACKET = 276, /* D_LC_SEPARATOR_L_BRACKET  */
+    D_LC_SEPARATOR_R_BRACKET = 277, /* D_LC_SEPARATOR_R_BRACKET  */
+    D_LC_SEPARATOR_COMMA = 278,    /* D_LC_SEPARATOR_COMMA  */
+    D_LC_OP_ARITHMETIC_NEG = 279,  /* D_LC_OP_ARITHMETIC_NEG  */
+    D_LC_OP_ARITHMETIC_EXPONENT = 280 /* D_LC_OP_ARITHMETIC_EXPONENT  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
 union YYSTYPE
 {
-#line 53 "src/analyzers/synsem.y"
-
-    /** Literal strings. */
-    char string[D_LC_LITERAL_STR_MAX_LENGTH];
+#line 59 "src/analyzers/synsem.y"
+
+    /** Literal strings, which live in the string pool of the lexical
+        analyzer until the next sentence starts. */
+    struct {
+        /** The string, without its double quotes, '\0' terminated. */
+        const char *text;
+        /** The length of the string. */
+        size_t length;
+    } string;
     /** Literal base 10 numbers. */
     struct d_dec_number dec_number;
     /** Identifiers. */
     struct d_symbol_table_entry *st_entry;
+    /** Mathematical expressions. */
+    struct d_ast_node *ast_node;
 
-#line 125 "include/common/lexical_comp.h"
+#line 148 "include/common/lexical_comp.h"
 
 };
 typedef union YYSTYPE YYSTYPE;
@@ -144,8 +167,29 @@ struct YYLTYPE
 #endif
 
 
-extern YYSTYPE yylval;
-extern YYLTYPE yylloc;
-int yyparse (void);
+
+
+int yyparse (struct d_context *context);
+
+/* "%code provides" blocks.  */
+#line 169 "src/analyzers/synsem.y"
+
+    /**
+     * @brief The lexical analyzer identifies the next lexical component
+     *        (see analyzers/lexical.h).
+     *
+     * @param[out] value The semantic value of the lexical component, if any.
+     * @param[out] location Where the lexical component has been found.
+     * @param[in,out] context The context.
+     *
+     * @return The category of the lexical component.
+     */
+    int yylex(
+        YYSTYPE *value,
+        YYLTYPE *location,
+        struct d_context *context
+    );
+
+#line 194 "include/common/lexical_comp.h"
 
 #endif /* !YY_YY_INCLUDE_COMMON_LEXICAL_COMP_H_INCLUDED  */
@@ -12,8 +12,20 @@
  *  in commands, as well as all of their attributes.
  *
  *  The symbol table is internally represented by a single hash table, as
- *  there is no scoping at the moment. Specifically, the "uthash" library by
- *  Troy D. Hanson is the one who provides the whole hash table functionality.
+ *  there is no scoping at the moment. It is an open-addressing one, which
+ *  keeps the hashes of the lexemes next to the pointers to their entries,
+ *  and which probes several slots at once (through SSE2, if available).
+ *
+ *  Entries are allocated from arenas (see common/arena.h), and their lexemes
+ *  are interned in string pools, one of each per lexical component category.
+ *  Therefore, a whole category (i.e. all variables, when the workspace is
+ *  cleared) is deleted without visiting its entries.
+ *
+ *  The values of the variables are not kept in their entries, but in a
+ *  single contiguous array, where each variable gets a slot as it is
+ *  declared. The entries just map the variables' names to their slots, so
+ *  that compiled programs (see interpreter/bytecode.h) may refer to them by
+ *  index.
  *
  *  It is also worth noting that, once the symbol table is created, its
  *  initial contents are:
@@ -23,7 +35,10 @@
  *    - The math functions in math/math_functions.h
  *
  *  This will allow telling those elements apart from variables' identifiers,
- *  as they are all alphanumeric strings.
+ *  as they are all alphanumeric strings. These built-ins are found through a
+ *  perfect hash table that is known at compile time, which is checked before
+ *  the hash table, so creating a symbol table does not allocate nor index
+ *  them one by one.
  */
 
 
@@ -35,9 +50,6 @@
 #include "math/dec_numbers.h"
 #include "math/math_functions.h"
 
-// External library 
-#include "lib/uthash.h"
-
 
 /**
  * @brief Represents a symbol table.
@@ -59,8 +71,8 @@ struct d_symbol_table;
 struct d_symbol_table_entry {
 
     /** '\0' terminated string which represents the lexeme that originated the
-        entry, as well as serving as its key. It will be automatically freed
-        once the entry is deleted. */
+        entry, as well as serving as its key. The symbol table keeps its own
+        copy, which is freed once the entry is deleted. */
     const char *lexeme;
 
     /** Lexical component which corresponds to the entry's lexeme. */
@@ -69,16 +81,17 @@ struct d_symbol_table_entry {
     /** Union that holds any attribute of any kind that an entry may
         require. */
     union {
-        /** For base 10 variables and constants. */
+        /** For base 10 constants, as well as for the initial value of the
+            variables that are given to "d_symbol_table_add". */
         struct d_dec_number dec_number;
+        /** For variables, the index of the slot that holds their value (see
+            "d_symbol_table_get_variables"). */
+        size_t variable_slot;
         /** For mathematical functions that operate on decimal values. */
         d_dec_function function;
         /** For built-in commands. */
         struct d_command command; 
     } attribute;
-
-    /** Makes this structure hashable by the library. */
-    UT_hash_handle hh;
 };
 
 
@@ -89,10 +102,13 @@ struct d_symbol_table_entry {
  *  Initializes the symbol table, filling it with all the math constants and
  *  functions, and built-in commands.
  *
+ * @param[out] table The symbol table, which must be destroyed through
+ *                   "d_symbol_table_destroy".
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_initialize(
-    void
+    struct d_symbol_table **table
 );
 
 
@@ -103,16 +119,39 @@ int d_symbol_table_initialize(
  *  Searches in the symbol table an entry identified by the given key, and
  *  returning it if found.
  *
+ * @param[in] table The symbol table.
  * @param[in] key '\0' terminated string which represents the key of the
  *                entry.
  *
  * @return Pointer to the requested entry, or NULL if not found.
  */
 struct d_symbol_table_entry *d_symbol_table_search(
+    struct d_symbol_table *table,
     const char* key
 );
 
 
+/**
+ * @brief Searches in the symbol table for the entry of the given lexeme.
+ *
+ * @details
+ *  Just as "d_symbol_table_search", but the lexeme does not need to be '\0'
+ *  terminated, so that the lexical analyzer may search for the lexemes that
+ *  it recognizes right where they are, without copying them.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] lexeme The lexeme.
+ * @param[in] length The length of the lexeme.
+ *
+ * @return Pointer to the requested entry, or NULL if not found.
+ */
+struct d_symbol_table_entry *d_symbol_table_search_lexeme(
+    struct d_symbol_table *table,
+    const char *lexeme,
+    size_t length
+);
+
+
 /**
  * @brief Adds a new entry to the symbol table.
  *
@@ -121,17 +160,23 @@ struct d_symbol_table_entry *d_symbol_table_search(
  *  present yet.
  *
  *  Every member in the given entry will be copied to a new entry internally
- *  managed by the symbol table.
+ *  managed by the symbol table. The lexeme is copied too, so the caller
+ *  keeps the ownership of the given one.
  *
- *  WARNING: if any member points to a certain memory region, just the pointer
- *           itself will be copied, whereas the contents of the region will
- *           not.
+ *  Variables are given their initial value as their attribute, which is
+ *  stored in a new slot; the new entry holds the index of that slot instead.
  *
+ *  WARNING: if any other member points to a certain memory region, just the
+ *           pointer itself will be copied, whereas the contents of the region
+ *           will not.
+ *
+ * @param[in,out] table The symbol table.
  * @param[in] entry The entry.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_add(
+    struct d_symbol_table *table,
     struct d_symbol_table_entry *entry
 );
 
@@ -145,6 +190,7 @@ int d_symbol_table_add(
  *  entry's key must NOT be present yet; that is, a function that goes by the
  *  same name.
  *
+ * @param[in,out] table The symbol table.
  * @param[in] funcion_name Name by which the function will be identified.
  * @param[in] function_implementation Where the function's implementation can
  *            be found.
@@ -152,11 +198,60 @@ int d_symbol_table_add(
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_add_math_function(
+    struct d_symbol_table *table,
     const char *function_name,
     d_dec_function function_implementation
 );
 
 
+/**
+ * @brief Gets the array that holds the values of all variables.
+ *
+ * @details
+ *  Each variable's value is found at the index that its entry holds
+ *  ("attribute.variable_slot"). The array may be moved whenever a new
+ *  variable is added, so it must be gotten again afterwards.
+ *
+ * @param[in] table The symbol table.
+ *
+ * @return The array, or NULL if there are no variables.
+ */
+struct d_dec_number *d_symbol_table_get_variables(
+    struct d_symbol_table *table
+);
+
+
+/**
+ * @brief Gets how many variables there are, and so how many values the array
+ *        of "d_symbol_table_get_variables" holds.
+ *
+ * @param[in] table The symbol table.
+ *
+ * @return How many variables there are.
+ */
+size_t d_symbol_table_get_variable_count(
+    const struct d_symbol_table *table
+);
+
+
+/**
+ * @brief Gets the value of the given variable.
+ *
+ * @details
+ *  Just as "d_symbol_table_get_variables", the pointer is valid until a new
+ *  variable is added.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] entry The variable's entry.
+ *
+ * @return Pointer to the variable's value.
+ */
+struct d_dec_number *d_symbol_table_get_variable(
+    struct d_symbol_table *table,
+    const struct d_symbol_table_entry *entry
+);
+
+
 /**
  * @brief Shows the symbol table.
  *
@@ -167,21 +262,33 @@ int d_symbol_table_add_math_function(
  *    - Math loaded functions.
  *    - Variables.
  *
+ * @param[in] table The symbol table.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_show(
-    void
+    struct d_symbol_table *table
 );
 
 
 /**
  * @brief Deletes all entries that belong to the specified lexical component.
  *
+ * @details
+ *  Its cost never exceeds the amount of deleted entries: if they are fewer
+ *  than the kept ones, their slots in the hash table become tombstones;
+ *  otherwise, the hash table is rebuilt from the kept entries.
+ *
+ *  Any pointers to the deleted entries become invalid, and so do the slots
+ *  of the variables, if they are deleted.
+ *
+ * @param[in,out] table The symbol table.
  * @param[in] lexical_component The lexical component category.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_delete(
+    struct d_symbol_table *table,
     int lexical_component
 );
 
@@ -192,10 +299,12 @@ int d_symbol_table_delete(
  * @details
  *  Destroys the symbol table, as well as all of its entries.
  *
+ * @param[in,out] table The symbol table.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int d_symbol_table_destroy(
-    void
+    struct d_symbol_table *table
 );
 
 
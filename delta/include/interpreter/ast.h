@@ -0,0 +1,295 @@
+/**
+ * @file ast.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the abstract syntax tree (AST) through which
+ *        delta represents mathematical expressions.
+ *
+ * @details
+ *  This file contains the abstract syntax tree (AST) through which delta
+ *  represents mathematical expressions. The syntactic & semantic analyzer
+ *  builds a tree for each recognized expression, instead of computing its
+ *  value right away, so that the same expression can be later evaluated,
+ *  optimized or compiled without needing to analyze its text once again.
+ *
+ *  All nodes are allocated from an arena (see common/arena.h), so a whole
+ *  tree is released at once by resetting the arena from which it was built.
+ *
+ *  Nodes keep the location (line & column) at which their expression ends,
+ *  as semantic errors that can only be detected when evaluating a tree (i.e.
+ *  a division by 0) must still be reported at the right place. They also
+ *  keep the data type of their values when it can be told in advance, which
+ *  allows later stages to specialize the code that computes them.
+ */
+
+
+#ifndef D_AST
+#define D_AST
+
+
+#include "common/arena.h"
+#include "common/symbol_table.h"
+#include "math/dec_numbers.h"
+
+
+/* size_t */
+#include <stddef.h>
+/* uint8_t */
+#include <stdint.h>
+
+
+/**
+ * @brief All kinds of nodes that may be found in an AST.
+ */
+enum d_ast_node_type {
+    /** A base 10 literal number. */
+    D_AST_LITERAL,
+    /** A reference to a math constant. */
+    D_AST_CONSTANT,
+    /** A reference to a variable. */
+    D_AST_VARIABLE,
+    /** Assigning an expression to a variable. */
+    D_AST_ASSIGNMENT,
+    /** Calling a math function with an expression as its argument. */
+    D_AST_FUNCTION_CALL,
+    /** A binary mathematical operation (+, -, *, /, %, ^). */
+    D_AST_OPERATION,
+    /** Negating an expression. */
+    D_AST_NEGATION,
+    /** An array built out of a list of expressions. */
+    D_AST_ARRAY
+};
+
+
+/**
+ * @brief Which data type the value of a node is known to have before
+ *        evaluating it.
+ *
+ * @details
+ *  Literals, constants and function calls always have a well-known data
+ *  type, which propagates through the operations that use them. However,
+ *  variables may hold any data type, which is only known at evaluation
+ *  time.
+ *
+ *  Array literals, and whatever is computed out of them, are known to be
+ *  arrays, which are operated on by dynamically typed instructions. A
+ *  variable may also hold an array, so a floating point value that depends
+ *  on variables may turn out to be an array of floating point numbers (see
+ *  interpreter/bytecode.h).
+ */
+enum d_ast_value_type {
+    /** The data type depends on the values of some variables. */
+    D_AST_VALUE_UNKNOWN,
+    /** The value will always be an integer number. */
+    D_AST_VALUE_INTEGER,
+    /** The value will always be a floating point number, or an array of
+        them if it depends on variables. */
+    D_AST_VALUE_FLOATING,
+    /** The value will always be an array. */
+    D_AST_VALUE_ARRAY
+};
+
+
+/**
+ * @brief Represents a node in an AST.
+ */
+struct d_ast_node {
+    /** Which kind of node this is (enum d_ast_node_type). */
+    uint8_t type;
+
+    /** Which data type the node's value is known to have (enum
+        d_ast_value_type). */
+    uint8_t value_type;
+
+    /** For binary operations, the symbol that represents them (+, -, *, /,
+        %, ^). */
+    char operation;
+
+    /** Line in which the node's expression ends. */
+    int line;
+    /** Column in which the node's expression ends. */
+    int column;
+
+    /** If the node computes the same value as another node that is
+        evaluated before it, that other node; NULL otherwise. Set by the
+        optimizer (see interpreter/optimizer.h). */
+    struct d_ast_node *duplicate_of;
+    /** If other nodes are duplicates of this one, where its value is kept
+        once computed so that they can reuse it; -1 otherwise. */
+    int local_slot;
+
+    /** Union that holds any attribute of any kind that a node may require. */
+    union {
+        /** For literal numbers. */
+        struct d_dec_number dec_number;
+
+        /** For constants and variables, their entries in the symbol
+            table. */
+        struct d_symbol_table_entry *st_entry;
+
+        /** For assignments and function calls, the entry in the symbol table
+            of the variable/function, and the expression that it operates
+            on. */
+        struct {
+            struct d_symbol_table_entry *st_entry;
+            struct d_ast_node *operand;
+        } unary;
+
+        /** For binary operations, both operands. */
+        struct {
+            struct d_ast_node *left;
+            struct d_ast_node *right;
+        } binary;
+
+        /** For negations, the negated expression. */
+        struct d_ast_node *operand;
+
+        /** For arrays, the expressions of their elements, in order. */
+        struct {
+            struct d_ast_node **elements;
+            size_t count;
+            size_t capacity;
+        } array;
+    } attribute;
+};
+
+
+/**
+ * @brief Creates a node that represents a base 10 literal number.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] dec_number The number.
+ * @param[in] line Line in which the literal ends.
+ * @param[in] column Column in which the literal ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_literal(
+    struct d_arena *arena,
+    const struct d_dec_number *dec_number,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Creates a node that represents a reference to a math constant or to
+ *        a variable.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] type D_AST_CONSTANT or D_AST_VARIABLE.
+ * @param[in] st_entry The constant's/variable's entry in the symbol table.
+ * @param[in] line Line in which the identifier ends.
+ * @param[in] column Column in which the identifier ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_identifier(
+    struct d_arena *arena,
+    enum d_ast_node_type type,
+    struct d_symbol_table_entry *st_entry,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Creates a node that represents an assignment or a function call.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] type D_AST_ASSIGNMENT or D_AST_FUNCTION_CALL.
+ * @param[in] st_entry The variable's/function's entry in the symbol table.
+ * @param[in] operand The assigned expression, or the function's argument.
+ * @param[in] line Line in which the whole expression ends.
+ * @param[in] column Column in which the whole expression ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_unary(
+    struct d_arena *arena,
+    enum d_ast_node_type type,
+    struct d_symbol_table_entry *st_entry,
+    struct d_ast_node *operand,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Creates a node that represents a binary mathematical operation.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] operation The symbol that represents the operation (+, -, *, /,
+ *                      %, ^).
+ * @param[in] left The first operand.
+ * @param[in] right The second operand.
+ * @param[in] line Line in which the whole expression ends.
+ * @param[in] column Column in which the whole expression ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_operation(
+    struct d_arena *arena,
+    char operation,
+    struct d_ast_node *left,
+    struct d_ast_node *right,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Creates a node that represents the negation of an expression.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] operand The negated expression.
+ * @param[in] line Line in which the whole expression ends.
+ * @param[in] column Column in which the whole expression ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_negation(
+    struct d_arena *arena,
+    struct d_ast_node *operand,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Creates a node that represents an array, out of the expression of
+ *        its first element.
+ *
+ * @param[in,out] arena The arena from which the node will be allocated.
+ * @param[in] element The expression of the first element.
+ * @param[in] line Line in which the first element ends.
+ * @param[in] column Column in which the first element ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *d_ast_new_array(
+    struct d_arena *arena,
+    struct d_ast_node *element,
+    int line,
+    int column
+);
+
+
+/**
+ * @brief Adds the expression of another element to the given array.
+ *
+ * @param[in,out] arena The arena from which the array was allocated.
+ * @param[in,out] array The array's node.
+ * @param[in] element The expression of the element.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_ast_add_element(
+    struct d_arena *arena,
+    struct d_ast_node *array,
+    struct d_ast_node *element
+);
+
+
+#endif //D_AST
@@ -0,0 +1,212 @@
+/**
+ * @file bytecode.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the bytecode format in which delta compiles
+ *        mathematical expressions, as well as its compiler.
+ *
+ * @details
+ *  This file contains the bytecode format in which delta compiles
+ *  mathematical expressions, as well as the compiler that translates ASTs
+ *  (see interpreter/ast.h) into it. The resulting programs are run by
+ *  delta's virtual machine (see interpreter/vm.h).
+ *
+ *  A program is a flat sequence of instructions for a stack machine. Each
+ *  instruction consists of an opcode and, at most, one operand.
+ *
+ *  Whenever the data types of the operands of an operation can be told in
+ *  advance, the compiler emits an opcode that is specialized for them (i.e.
+ *  "int64 addition" or "double addition"), so that the virtual machine does
+ *  not need to check them at run time. Otherwise, a generic opcode is
+ *  emitted, which dynamically applies the same promotion rules as
+ *  "math/dec_numbers.h/d_dec_numbers_compute_operation".
+ */
+
+
+#ifndef D_BYTECODE
+#define D_BYTECODE
+
+
+#include "common/arena.h"
+#include "common/symbol_table.h"
+#include "interpreter/ast.h"
+#include "math/math_functions.h"
+
+
+/* size_t */
+#include <stddef.h>
+/* uint8_t & int64_t */
+#include <stdint.h>
+
+
+/**
+ * @brief All opcodes that may be found in a program.
+ *
+ * @details
+ *  "_INTEGER" and "_FLOATING" opcodes expect their operands to be already of
+ *  that data type, whereas "_ANY" opcodes check them at run time. "_ANY"
+ *  opcodes operate on arrays, and so do "_FLOATING" ones when a variable
+ *  turns out to hold an array of floating point numbers, which they check
+ *  before falling back to the same element-wise arithmetic. "_INTEGER"
+ *  opcodes never see arrays, as their operands never depend on variables.
+ *
+ *  Arithmetic opcodes carry the column at which their second operand ends,
+ *  so that divisions by 0, and arrays of different lengths, can be
+ *  reported. As a program always comes from a single input line, the line
+ *  itself is given when running it, which allows reusing the program no
+ *  matter where its line appears.
+ */
+enum d_bytecode_opcode {
+
+    /* ═══ Loading & storing values ═══ */
+
+    /** Pushes an integer number. */
+    D_OP_PUSH_INTEGER,
+    /** Pushes a floating point number. */
+    D_OP_PUSH_FLOATING,
+    /** Pushes the value of a math constant. */
+    D_OP_LOAD_CONSTANT,
+    /** Pushes the value of a variable. */
+    D_OP_LOAD_VARIABLE,
+    /** Sets the value on top of the stack as a variable's one, without
+        popping it. */
+    D_OP_STORE_VARIABLE,
+    /** Pushes the value that was kept in a local slot. */
+    D_OP_LOAD_LOCAL,
+    /** Keeps the value on top of the stack in a local slot, without popping
+        it. */
+    D_OP_STORE_LOCAL,
+    /** Pops the given amount of values, and pushes the array that is built
+        out of them (see math/dec_arrays.h/d_dec_arrays_build). */
+    D_OP_MAKE_ARRAY,
+
+    /* ═══ Conversions ═══ */
+
+    /** Converts the integer on top of the stack into a floating point
+        number. */
+    D_OP_TO_FLOATING_INTEGER,
+    /** Converts the value on top of the stack into a floating point number,
+        if it is not one yet. */
+    D_OP_TO_FLOATING_ANY,
+
+    /* ═══ Math functions ═══ */
+
+    /** Calls a math function with the floating point number on top of the
+        stack, which gets replaced by the result. */
+    D_OP_CALL_FUNCTION,
+
+    /* ═══ Integer arithmetic ═══ */
+
+    D_OP_ADD_INTEGER,
+    D_OP_SUB_INTEGER,
+    D_OP_MUL_INTEGER,
+    D_OP_DIV_INTEGER,
+    D_OP_MOD_INTEGER,
+    D_OP_POW_INTEGER,
+    D_OP_NEG_INTEGER,
+
+    /* ═══ Floating point arithmetic ═══ */
+
+    D_OP_ADD_FLOATING,
+    D_OP_SUB_FLOATING,
+    D_OP_MUL_FLOATING,
+    D_OP_DIV_FLOATING,
+    D_OP_MOD_FLOATING,
+    D_OP_POW_FLOATING,
+    D_OP_NEG_FLOATING,
+
+    /* ═══ Dynamically typed arithmetic ═══ */
+
+    D_OP_ADD_ANY,
+    D_OP_SUB_ANY,
+    D_OP_MUL_ANY,
+    D_OP_DIV_ANY,
+    D_OP_MOD_ANY,
+    D_OP_POW_ANY,
+    D_OP_NEG_ANY
+};
+
+
+/**
+ * @brief Represents an instruction.
+ */
+struct d_bytecode_instruction {
+    /** Which operation the instruction performs (enum
+        d_bytecode_opcode). */
+    uint8_t opcode;
+
+    /** Union that holds the operand that an instruction may require. */
+    union {
+        /** For pushing integer numbers. */
+        int64_t integer;
+        /** For pushing floating point numbers. */
+        double floating;
+        /** For loading constants. */
+        struct d_symbol_table_entry *st_entry;
+        /** For loading/storing variables, the index of their slot (see
+            common/symbol_table.h/d_symbol_table_get_variables). */
+        size_t variable_slot;
+        /** For calling math functions. */
+        d_dec_function function;
+        /** For loading/storing local slots, which slot. */
+        int local_slot;
+        /** For building arrays, how many values they are built out of, and
+            the column at which they end, so that elements that are arrays
+            themselves can be reported. */
+        struct {
+            uint32_t element_count;
+            int column;
+        } array;
+        /** For arithmetic, the column at which their second operand
+            ends. */
+        int column;
+    } operand;
+};
+
+
+/**
+ * @brief Represents a compiled program.
+ */
+struct d_bytecode {
+    /** The program's instructions. */
+    struct d_bytecode_instruction *instructions;
+    /** How many instructions there are. */
+    size_t instruction_count;
+
+    /** How many values the stack needs to hold, at most, while running the
+        program. */
+    size_t stack_size;
+
+    /** How many local slots the program uses. They keep the values of
+        common subexpressions (see interpreter/optimizer.h), so that they are
+        computed only once. */
+    size_t local_count;
+};
+
+
+/**
+ * @brief Compiles the given AST into a program.
+ *
+ * @details
+ *  The program's instructions are allocated from the given arena, so they
+ *  are valid as long as the arena is not reset or destroyed. The AST is not
+ *  needed any more once the program has been compiled.
+ *
+ *  Nodes that are duplicates of others just load the value that the
+ *  original node kept in its local slot.
+ *
+ * @param[in] root The root of the AST.
+ * @param[in,out] arena The arena from which the instructions are allocated.
+ * @param[out] bytecode The compiled program.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_bytecode_compile(
+    const struct d_ast_node *root,
+    struct d_arena *arena,
+    struct d_bytecode *bytecode
+);
+
+
+#endif //D_BYTECODE
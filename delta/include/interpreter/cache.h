@@ -0,0 +1,231 @@
+/**
+ * @file cache.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the cache in which delta keeps the programs of
+ *        recently analyzed input lines.
+ *
+ * @details
+ *  This file contains the cache in which delta keeps the programs (see
+ *  interpreter/bytecode.h) into which recently analyzed input lines have been
+ *  compiled. Notebooks and REPL sessions tend to repeat the same lines over
+ *  and over, so when a line is found in the cache, its program is run right
+ *  away, skipping its lexical, syntactic & semantic analysis.
+ *
+ *  Only lines that consist of a single mathematical expression, and whose
+ *  analysis did not raise any errors, are cached. Lines are normalized
+ *  before looking them up, by dropping any trailing whitespace, as it changes
+ *  neither the meaning of a sentence nor the location of its errors.
+ *
+ *  The cache holds a bounded amount of programs. Once it is full, the least
+ *  recently used one is evicted to make room for the new one.
+ *
+ *  Programs that are run many times get compiled into native code (see
+ *  interpreter/jit.h), which is used instead of the virtual machine from
+ *  then on. If the variables of a program change their data types, its
+ *  native code is discarded, and it gets compiled again once it is hot
+ *  again. Programs that cannot be compiled (i.e. those that build arrays, or
+ *  whose variables hold arrays) are only tried once, and left to the virtual
+ *  machine from then on.
+ *
+ *  Programs reference the entries of the symbol table that their expressions
+ *  use, as well as the slots of their variables, so the cache must be
+ *  cleared whenever any of those entries may be deleted (i.e. when clearing
+ *  the workspace).
+ */
+
+
+#ifndef D_CACHE
+#define D_CACHE
+
+
+#include "common/context.h"
+#include "interpreter/bytecode.h"
+#include "interpreter/jit.h"
+#include "math/dec_numbers.h"
+
+#include "lib/uthash.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/** Default amount of programs that the cache can hold. */
+#define D_CACHE_DEFAULT_CAPACITY 1024
+
+
+/**
+ * @brief Represents a cache.
+ *
+ * @details
+ *  Opaque data type. Each context has its own cache, as programs reference
+ *  the entries of its symbol table.
+ */
+struct d_cache;
+
+
+/**
+ * @brief Represents an entry in the cache.
+ */
+struct d_cache_entry {
+    /** The normalized line, which acts as the key of the entry. It is not
+        '\0' terminated. */
+    const char *line;
+    /** The length of the normalized line. */
+    size_t line_length;
+
+    /** The program into which the line's expression was compiled. Its
+        instructions are owned by the entry. */
+    struct d_bytecode bytecode;
+
+    /** If the expression's value must be shown after running the program
+        (i.e. the line did not end with ';'). */
+    int echo;
+
+    /** How many times the program has been run since it was added, or
+        since its native code was discarded. */
+    size_t run_count;
+    /** The native code of the program, or NULL if it has not been compiled
+        (yet). */
+    struct d_jit_code *native_code;
+    /** If the program could not be compiled into native code, so that it
+        is not tried again. */
+    int has_jit_failed;
+
+    /** Makes this structure hashable by the library. The order in which
+        entries are kept by the library is the order in which they have been
+        used, from least to most recently. */
+    UT_hash_handle hh;
+};
+
+
+/**
+ * @brief Initializes a cache.
+ *
+ * @param[out] cache The cache, which must be destroyed through
+ *                   "d_cache_destroy".
+ * @param[in] capacity How many programs the cache can hold, at most.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_initialize(
+    struct d_cache **cache,
+    size_t capacity
+);
+
+
+/**
+ * @brief Searches for the program into which the given line was compiled.
+ *
+ * @details
+ *  Lines that are empty once normalized are neither looked up nor counted
+ *  as misses. If the line is found, its entry becomes the most recently used
+ *  one.
+ *
+ * @param[in,out] cache The cache.
+ * @param[in] line The line, as it has been read.
+ * @param[in] length The length of the line.
+ *
+ * @return The entry of the line, or NULL if it is not cached.
+ */
+struct d_cache_entry *d_cache_search(
+    struct d_cache *cache,
+    const char *line,
+    size_t length
+);
+
+
+/**
+ * @brief Adds the program into which the given line was compiled.
+ *
+ * @details
+ *  The program's instructions are copied, so the given program does not
+ *  need to outlive this call. If the cache is full, the least recently used
+ *  entry is evicted.
+ *
+ * @param[in,out] cache The cache.
+ * @param[in] line The line, as it has been read.
+ * @param[in] length The length of the line.
+ * @param[in] bytecode The program.
+ * @param[in] echo If the expression's value must be shown after running the
+ *                 program.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_add(
+    struct d_cache *cache,
+    const char *line,
+    size_t length,
+    const struct d_bytecode *bytecode,
+    int echo
+);
+
+
+/**
+ * @brief Runs the program of the given entry.
+ *
+ * @details
+ *  The program is run through its native code if it has any, or through the
+ *  virtual machine otherwise. Once the program is hot enough, it gets
+ *  compiled into native code, as long as the JIT compiler is enabled.
+ *
+ * @param[in,out] context The context to which the cache belongs.
+ * @param[in,out] entry The entry.
+ * @param[in] line Line from which the program comes, where any errors will be
+ *                 reported.
+ * @param[out] result The value of the program's expression.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_run(
+    struct d_context *context,
+    struct d_cache_entry *entry,
+    int line,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Deletes all entries in the cache.
+ *
+ * @details
+ *  The hit & miss counters are kept.
+ *
+ * @param[in,out] cache The cache.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_clear(
+    struct d_cache *cache
+);
+
+
+/**
+ * @brief Shows how many entries are in the cache, how many of them have
+ *        been compiled into native code, and how many times lines have been
+ *        found (hits) or not (misses) in it.
+ *
+ * @param[in] cache The cache.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_show(
+    struct d_cache *cache
+);
+
+
+/**
+ * @brief Destroys the given cache.
+ *
+ * @param[in,out] cache The cache.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_cache_destroy(
+    struct d_cache *cache
+);
+
+
+#endif //D_CACHE
@@ -0,0 +1,151 @@
+/**
+ * @file jit.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the just-in-time (JIT) compiler that translates
+ *        hot programs into native x86-64 code.
+ *
+ * @details
+ *  This file contains the just-in-time (JIT) compiler that translates
+ *  programs (see interpreter/bytecode.h) into native x86-64 code. It is only
+ *  used for programs that are run many times (see interpreter/cache.h), as
+ *  compiling them has a cost of its own.
+ *
+ *  The native code performs int64/double arithmetic inline and calls math
+ *  functions directly. In order to do so, it gets specialized for the data
+ *  types that the program's variables hold when it is compiled. Before
+ *  doing anything else, the native code checks that those variables still
+ *  hold the same data types; if any of them does not, nothing is run and
+ *  the program must be run by the virtual machine instead (see
+ *  interpreter/vm.h). Programs that build arrays, or whose variables hold
+ *  arrays, are always left to the virtual machine.
+ *
+ *  The native code behaves exactly as the virtual machine would, including
+ *  which semantic errors are reported and where. On platforms other than
+ *  x86-64, no program is ever compiled.
+ */
+
+
+#ifndef D_JIT
+#define D_JIT
+
+
+#include "common/context.h"
+#include "interpreter/bytecode.h"
+#include "math/dec_numbers.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/** How many times a program must be run before it gets compiled into native
+    code. */
+#define D_JIT_HOT_THRESHOLD 16
+
+/** Value that "d_jit_execute" returns when the variables of a program do not
+    hold the data types for which it was compiled anymore. */
+#define D_JIT_TYPES_CHANGED 2
+
+
+/**
+ * @brief If the JIT compiler may be used or not.
+ *
+ * @details
+ *  It allows comparing the performance of native code and the virtual
+ *  machine, through the "jit" built-in command.
+ */
+extern int d_jit_enabled;
+
+
+/**
+ * @brief Represents the native code of a program.
+ */
+struct d_jit_code {
+    /** Executable memory that holds the code. */
+    void *memory;
+    /** Size in bytes of that memory. */
+    size_t memory_size;
+
+    /** How many 8-byte slots the code needs for its stack and local slots,
+        plus the one that holds the address of the variables' values. */
+    size_t frame_size;
+
+    /** If the value of the program's expression is a floating point number
+        or an integer one. */
+    int result_is_floating;
+};
+
+
+/**
+ * @brief Tells if native code can be generated on the current platform.
+ *
+ * @return 1 if it can, 0 otherwise.
+ */
+int d_jit_is_supported(
+    void
+);
+
+
+/**
+ * @brief Compiles the given program into native code.
+ *
+ * @details
+ *  The code gets specialized for the data types that the program's
+ *  variables hold right now.
+ *
+ * @param[in] context The context whose variables the program uses.
+ * @param[in] bytecode The program.
+ * @param[out] code The native code, which must be freed through
+ *                  "d_jit_free".
+ *
+ * @return 0 if successful, any other value otherwise (i.e. the platform is
+ *         not supported).
+ */
+int d_jit_compile(
+    struct d_context *context,
+    const struct d_bytecode *bytecode,
+    struct d_jit_code **code
+);
+
+
+/**
+ * @brief Runs the native code of the given program.
+ *
+ * @details
+ *  Any semantic errors that are found while running the code are reported
+ *  right away, just as the virtual machine does.
+ *
+ * @param[in,out] context The context in which errors are reported.
+ * @param[in] code The native code.
+ * @param[in] bytecode The program from which the code was compiled.
+ * @param[in] line Line from which the program comes, where any errors will be
+ *                 reported.
+ * @param[out] result The value of the program's expression.
+ *
+ * @return 0 if successful, D_JIT_TYPES_CHANGED if nothing has been run as
+ *         the variables' data types have changed, any other value otherwise.
+ */
+int d_jit_execute(
+    struct d_context *context,
+    const struct d_jit_code *code,
+    const struct d_bytecode *bytecode,
+    int line,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Frees the given native code.
+ *
+ * @param[in] code The native code.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_jit_free(
+    struct d_jit_code *code
+);
+
+
+#endif //D_JIT
@@ -0,0 +1,262 @@
+/**
+ * @file notebook.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the format in which delta keeps notebooks that
+ *        have already been compiled (".deltac" files), as well as its writer
+ *        and reader.
+ *
+ * @details
+ *  Loading a notebook spends most of its time analyzing its lines, even
+ *  though they are the same each time it is loaded. Compiling a notebook
+ *  ("x.delta") analyzes it once, and writes the programs (see
+ *  interpreter/bytecode.h) of its lines into "x.deltac", which can then be
+ *  loaded instead: each line that was compiled is just run, skipping its
+ *  lexical, syntactic & semantic analysis.
+ *
+ *  A compiled notebook holds all of the lines of its source, in the same
+ *  order. Only lines that consist of a single mathematical expression, and
+ *  whose analysis did not raise any errors, get their program; any other
+ *  line (i.e. built-in commands, or lines with errors) is kept as it is,
+ *  and it is analyzed whenever the notebook is loaded. Therefore, loading
+ *  either file runs the same statements and shows the same values and
+ *  errors, at the same lines.
+ *
+ *  Programs do not reference entries of any symbol table. Instead, the file
+ *  holds a table with each name (of a constant, variable or function) that
+ *  its programs use, and each program lists which of those names it uses.
+ *  Names are looked up once when the notebook is loaded, and missing
+ *  variables are created just as the lexical analyzer would, in the same
+ *  order. If a name turns out to be something else by then (e.g. a function
+ *  that has been imported since the notebook was compiled), its line is
+ *  analyzed instead.
+ *
+ *  The file records the size and the modification time of its source. A
+ *  compiled notebook whose source has changed since then is stale, and its
+ *  source is loaded instead. Files are written in the byte order of the
+ *  machine that compiles them; files of other versions of the format, or
+ *  from machines with other byte orders, are not loaded.
+ */
+
+
+#ifndef D_NOTEBOOK
+#define D_NOTEBOOK
+
+
+#include "common/symbol_table.h"
+#include "interpreter/ast.h"
+#include "interpreter/bytecode.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/** Version of the format of compiled notebooks. It must be increased
+    whenever the format, or the opcodes of programs, change. */
+#define D_NOTEBOOK_VERSION 3
+
+/** Extension of the notebooks that may be compiled. */
+#define D_NOTEBOOK_SOURCE_EXTENSION ".delta"
+
+/** Extension of compiled notebooks, which replaces the one of their source
+    (i.e. "x.delta" becomes "x.deltac"). */
+#define D_NOTEBOOK_EXTENSION ".deltac"
+
+
+/**
+ * @brief Represents a compiled notebook that has been opened.
+ *
+ * @details
+ *  Opaque data type.
+ */
+struct d_notebook;
+
+
+/**
+ * @brief Represents a compiled notebook that is being written.
+ *
+ * @details
+ *  Opaque data type.
+ */
+struct d_notebook_writer;
+
+
+/**
+ * @brief Represents a line of a compiled notebook.
+ */
+struct d_notebook_statement {
+    /** The line, which is not '\0' terminated. It lives as long as the
+        notebook is open. */
+    const char *line;
+    /** The length of the line. */
+    size_t length;
+
+    /** Where the program of the line is in the notebook, or NULL if the line
+        must be analyzed. */
+    const unsigned char *program;
+};
+
+
+/**
+ * @brief Compiles the given notebook.
+ *
+ * @details
+ *  The notebook is analyzed in a context of its own, which only has the
+ *  built-ins, so the current one is not changed. Its lines are not run, nor
+ *  are its built-in commands, so errors that are only raised when running
+ *  them (i.e. divisions by 0) are left for when the compiled notebook is
+ *  loaded. Errors are not shown either, as the lines that raise them are
+ *  kept to be analyzed again.
+ *
+ *  The compiled notebook is written next to its source (see
+ *  "d_notebook_get_compiled_path"). It is replaced at once, so that whoever
+ *  is loading a previous one still reads a whole file.
+ *
+ * @param[in] path The path of the notebook, which must end with
+ *                 D_NOTEBOOK_SOURCE_EXTENSION.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_notebook_compile(
+    const char *path
+);
+
+
+/**
+ * @brief Adds a line, along with its program, to the given compiled notebook.
+ *
+ * @details
+ *  The syntactic & semantic analyzer calls this, while compiling a notebook,
+ *  for each line whose analysis did not raise any errors. Lines that are not
+ *  part of the notebook's source (i.e. its last line, if it has been
+ *  completed with a '\n') are ignored, and so are programs that reference
+ *  anything but constants, variables and math functions.
+ *
+ * @param[in,out] writer The compiled notebook.
+ * @param[in] line The line, as it has been read.
+ * @param[in] length The length of the line.
+ * @param[in] root The root of the AST of the line's expression, from which
+ *                 its names are taken, in the order in which they appear.
+ * @param[in] bytecode The program into which the expression was compiled.
+ * @param[in] echo If the expression's value must be shown after running the
+ *                 program.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_notebook_writer_add(
+    struct d_notebook_writer *writer,
+    const char *line,
+    size_t length,
+    const struct d_ast_node *root,
+    const struct d_bytecode *bytecode,
+    int echo
+);
+
+
+/**
+ * @brief Opens the given compiled notebook.
+ *
+ * @details
+ *  The whole file is checked before handing any line, so that a damaged one
+ *  cannot make the virtual machine read or write out of bounds.
+ *
+ * @param[in] path The path of the compiled notebook.
+ * @param[out] notebook The notebook, which must be closed through
+ *                      "d_notebook_close".
+ *
+ * @return 0 if successful, 1 if the notebook is missing, stale, or not
+ *         valid (its source should be loaded instead), any other value
+ *         otherwise.
+ */
+int d_notebook_open(
+    const char *path,
+    struct d_notebook **notebook
+);
+
+
+/**
+ * @brief Returns the path of the compiled notebook of the given source.
+ *
+ * @param[in] path The path of the source.
+ *
+ * @return The path, which must be freed, or NULL if "path" does not end with
+ *         D_NOTEBOOK_SOURCE_EXTENSION or if failed.
+ */
+char *d_notebook_get_compiled_path(
+    const char *path
+);
+
+
+/**
+ * @brief Returns the path of the source of the given compiled notebook.
+ *
+ * @param[in] path The path of the compiled notebook.
+ *
+ * @return The path, which must be freed, or NULL if "path" does not end with
+ *         D_NOTEBOOK_EXTENSION or if failed.
+ */
+char *d_notebook_get_source_path(
+    const char *path
+);
+
+
+/**
+ * @brief Hands the next line of the given compiled notebook.
+ *
+ * @param[in,out] notebook The notebook.
+ * @param[out] statement The line.
+ *
+ * @return 0 if successful, any other value if there are no more lines.
+ */
+int d_notebook_next_statement(
+    struct d_notebook *notebook,
+    struct d_notebook_statement *statement
+);
+
+
+/**
+ * @brief Gets the program of the given line ready to be run on the given
+ *        symbol table.
+ *
+ * @details
+ *  The names of the program are looked up, and missing variables are
+ *  created. Once a line has been run, the names that it looked up are kept
+ *  for the next lines, until a line is analyzed (as it may change the symbol
+ *  table in any way).
+ *
+ * @param[in,out] notebook The notebook.
+ * @param[in] statement The line, which must be the last one that has been
+ *                      handed.
+ * @param[in,out] table The symbol table.
+ * @param[out] bytecode The program, whose instructions live until the next
+ *                      line is handed.
+ * @param[out] echo If the expression's value must be shown after running the
+ *                  program.
+ *
+ * @return 0 if successful, 1 if any of the names is something else by now
+ *         (the line should be analyzed instead), any other value otherwise.
+ */
+int d_notebook_resolve(
+    struct d_notebook *notebook,
+    const struct d_notebook_statement *statement,
+    struct d_symbol_table *table,
+    struct d_bytecode *bytecode,
+    int *echo
+);
+
+
+/**
+ * @brief Closes the given compiled notebook.
+ *
+ * @param[in,out] notebook The notebook.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_notebook_close(
+    struct d_notebook *notebook
+);
+
+
+#endif //D_NOTEBOOK
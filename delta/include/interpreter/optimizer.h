@@ -0,0 +1,58 @@
+/**
+ * @file optimizer.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the optimizer that delta applies to the ASTs of
+ *        mathematical expressions before compiling them.
+ *
+ * @details
+ *  This file contains the optimizer that delta applies to the ASTs (see
+ *  interpreter/ast.h) of mathematical expressions before compiling them into
+ *  programs (see interpreter/bytecode.h). It performs two passes:
+ *
+ *    - Constant folding. Subtrees that only involve literals and math
+ *      constants are computed right away, and replaced by a literal. Values
+ *      are computed through "math/dec_numbers.h", so they follow the very
+ *      same integer/floating point promotion rules as at run time.
+ *      Divisions and modulus by 0 are never folded, so that they are still
+ *      reported when (and where) they are evaluated.
+ *
+ *    - Common subexpression elimination. When the same subexpression
+ *      appears more than once, only its first occurrence is computed, and
+ *      the other ones just reuse its value. Math functions are assumed to be
+ *      pure. As assignments may change the value of a variable between two
+ *      occurrences, subexpressions that read any variable to which the
+ *      expression assigns a value are not shared, wherever the assignment
+ *      is (i.e. in "x = a*b + a*b", "a*b" is computed once, but it is
+ *      computed twice in "a = a*b + a*b").
+ *
+ *  The optimizer never changes which value an expression has, nor which
+ *  errors it raises and where.
+ */
+
+
+#ifndef D_OPTIMIZER
+#define D_OPTIMIZER
+
+
+#include "common/arena.h"
+#include "interpreter/ast.h"
+
+
+/**
+ * @brief Optimizes the given AST in place.
+ *
+ * @param[in,out] root The root of the AST.
+ * @param[in,out] arena The arena from which the AST was allocated, from
+ *                      which any working memory is also allocated.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_optimizer_optimize(
+    struct d_ast_node *root,
+    struct d_arena *arena
+);
+
+
+#endif //D_OPTIMIZER
@@ -0,0 +1,53 @@
+/**
+ * @file vm.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the virtual machine that runs the programs into
+ *        which delta compiles mathematical expressions.
+ *
+ * @details
+ *  This file contains the virtual machine that runs the programs into which
+ *  delta compiles mathematical expressions (see interpreter/bytecode.h).
+ *
+ *  The virtual machine is a stack machine. Its stack holds base 10 numbers,
+ *  which keep their data types so that dynamically typed instructions can
+ *  check them. A program can be run as many times as needed, without having
+ *  to analyze or compile its expression again.
+ */
+
+
+#ifndef D_VM
+#define D_VM
+
+
+#include "common/context.h"
+#include "interpreter/bytecode.h"
+#include "math/dec_numbers.h"
+
+
+/**
+ * @brief Runs the given program.
+ *
+ * @details
+ *  Any semantic errors that are found while running the program (i.e. a
+ *  division by 0) are reported right away, and the program stops. Side
+ *  effects of the instructions that had already been run persist.
+ *
+ * @param[in,out] context The context in which errors are reported.
+ * @param[in] bytecode The program.
+ * @param[in] line Line from which the program comes, where any errors will be
+ *                 reported.
+ * @param[out] result The value of the program's expression.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_vm_execute(
+    struct d_context *context,
+    const struct d_bytecode *bytecode,
+    int line,
+    struct d_dec_number *result
+);
+
+
+#endif //D_VM
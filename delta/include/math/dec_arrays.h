@@ -0,0 +1,281 @@
+/**
+ * @file dec_arrays.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the arrays of base 10 numbers that delta's
+ *        values may hold, and the element-wise arithmetic over them.
+ *
+ * @details
+ *  This file contains the arrays of base 10 numbers (see
+ *  math/dec_numbers.h) that delta's values may hold, such as "[1, 2, 3]".
+ *  All elements of an array have the same data type: if any of those that
+ *  it is built from is a floating point number, all of them are converted.
+ *
+ *  Arithmetic is applied element by element, following the very same
+ *  integer/floating point promotion rules as single numbers. If one of the
+ *  operands is a single number, it is used with every element of the other
+ *  one; otherwise, both arrays must have the same length. Math functions
+ *  are applied to each element as well.
+ *
+ *  Additions, subtractions, multiplications and divisions of floating point
+ *  arrays, as well as additions and subtractions of integer ones, are
+ *  computed with AVX2 (4 elements at once) or SSE2 (2 elements at once),
+ *  when available; the rest of them element by element.
+ *
+ *  Arrays are never modified once built, so values may share them freely.
+ *  Each interpreter keeps all of its arrays in a heap. Once enough memory
+ *  has been used since the last time, the arrays of the values that are
+ *  still in use are marked, and all the other ones are freed. Arrays that
+ *  are held outside the interpreter (i.e. by a program that embeds it) are
+ *  never freed until they are released.
+ */
+
+
+#ifndef D_DEC_ARRAYS
+#define D_DEC_ARRAYS
+
+
+#include "math/dec_numbers.h"
+#include "math/math_functions.h"
+
+
+/* size_t */
+#include <stddef.h>
+
+
+/** Value that the operations over arrays return when both of their operands
+    are arrays of different lengths. */
+#define D_DEC_ARRAYS_LENGTHS_DIFFER 1
+
+/** Value that building an array returns when any of its elements is an
+    array. */
+#define D_DEC_ARRAYS_NESTED 2
+
+
+/**
+ * @brief Represents an array of base 10 numbers.
+ */
+struct d_dec_array {
+    /** How many elements it has. */
+    size_t length;
+
+    /** The next array in the heap that holds it. */
+    struct d_dec_array *next;
+
+    /** If it is still reachable, while the heap is being collected. */
+    int is_marked;
+
+    /** How many times it has been held and not released yet. It is not
+        freed while this is not 0. */
+    size_t hold_count;
+
+    /** The elements, which are all integers or all floating point numbers,
+        as the value that holds the array tells. */
+    d_dec_number_values elements[];
+};
+
+
+/**
+ * @brief Represents the heap that holds all the arrays of an interpreter.
+ */
+struct d_dec_arrays;
+
+
+/**
+ * @brief Initializes a new heap of arrays.
+ *
+ * @param[out] arrays The heap.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_arrays_initialize(
+    struct d_dec_arrays **arrays
+);
+
+
+/**
+ * @brief Destroys the given heap, along with all of its arrays.
+ *
+ * @param[in,out] arrays The heap.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_arrays_destroy(
+    struct d_dec_arrays *arrays
+);
+
+
+/**
+ * @brief Tells if enough memory has been used since the last collection to
+ *        collect the heap again.
+ *
+ * @param[in] arrays The heap.
+ *
+ * @return 1 if it is, 0 otherwise.
+ */
+int d_dec_arrays_is_collection_due(
+    const struct d_dec_arrays *arrays
+);
+
+
+/**
+ * @brief Marks the arrays of the given values as reachable.
+ *
+ * @param[in] values The values, which may be single numbers as well.
+ * @param[in] count How many values there are.
+ */
+void d_dec_arrays_mark(
+    const struct d_dec_number *values,
+    size_t count
+);
+
+
+/**
+ * @brief Keeps the array of the given value from being freed until it is
+ *        released, even if no value in use holds it.
+ *
+ * @param[in] value The value, which may be a single number as well.
+ */
+void d_dec_arrays_hold(
+    const struct d_dec_number *value
+);
+
+
+/**
+ * @brief Releases the array of the given value, which must have been held.
+ *        It is freed once it is no longer held nor reachable.
+ *
+ * @param[in] value The value, which may be a single number as well.
+ */
+void d_dec_arrays_release(
+    const struct d_dec_number *value
+);
+
+
+/**
+ * @brief Frees all arrays of the given heap that have not been marked, and
+ *        are not held, and clears the marks of the rest of them.
+ *
+ * @param[in,out] arrays The heap.
+ */
+void d_dec_arrays_sweep(
+    struct d_dec_arrays *arrays
+);
+
+
+/**
+ * @brief Builds an array out of the given values.
+ *
+ * @details
+ *  Arrays hold single numbers only, so none of the values may be an array
+ *  (i.e. "[[1, 2], 3]" is rejected).
+ *
+ * @param[in,out] arrays The heap from which the array is allocated.
+ * @param[in] values The values, in order.
+ * @param[in] count How many values there are, at least 1.
+ * @param[out] result The array. It may be any of the values.
+ *
+ * @return 0 if successful, D_DEC_ARRAYS_NESTED if any of the values is an
+ *         array, any other value otherwise.
+ */
+int d_dec_arrays_build(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *values,
+    size_t count,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Tells if the given value is 0, or if any of its elements is 0.
+ *
+ * @param[in] value The value.
+ *
+ * @return 1 if so, 0 otherwise.
+ */
+int d_dec_arrays_has_zero(
+    const struct d_dec_number *value
+);
+
+
+/**
+ * @brief Performs the requested mathematical operation over the two given
+ *        values, element by element, at least one of which is an array.
+ *
+ * @details
+ *  Divisions and modulus by 0 must have been already checked (see
+ *  "d_dec_arrays_has_zero").
+ *
+ * @param[in,out] arrays The heap from which the result is allocated.
+ * @param[in] operation The symbol that represents the mathematical operation
+ *                      (+, -, *, /, %, ^).
+ * @param[in] value_1 The first value.
+ * @param[in] value_2 The second value.
+ * @param[out] result The resulting array. It may be any of the values.
+ *
+ * @return 0 if successful, D_DEC_ARRAYS_LENGTHS_DIFFER if both values are
+ *         arrays of different lengths, any other value otherwise.
+ */
+int d_dec_arrays_compute_operation(
+    struct d_dec_arrays *arrays,
+    char operation,
+    const struct d_dec_number *value_1,
+    const struct d_dec_number *value_2,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Negates all elements of the given array.
+ *
+ * @param[in,out] arrays The heap from which the result is allocated.
+ * @param[in] value The array.
+ * @param[out] result The resulting array. It may be the given one.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_arrays_negate(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Converts all elements of the given array into floating point
+ *        numbers.
+ *
+ * @param[in,out] arrays The heap from which the result is allocated.
+ * @param[in] value The array, whose elements are integers.
+ * @param[out] result The resulting array. It may be the given one.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_arrays_to_floating(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+);
+
+
+/**
+ * @brief Calls the given math function with each element of the given
+ *        array.
+ *
+ * @param[in,out] arrays The heap from which the result is allocated.
+ * @param[in] function The math function.
+ * @param[in] value The array, whose elements are floating point numbers.
+ * @param[out] result The resulting array. It may be the given one.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_arrays_apply_function(
+    struct d_dec_arrays *arrays,
+    d_dec_function function,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+);
+
+
+#endif //D_DEC_ARRAYS
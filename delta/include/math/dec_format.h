@@ -0,0 +1,129 @@
+/**
+ * @file dec_format.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains how delta turns base 10 numbers into text.
+ *
+ * @details
+ *  This file contains how delta turns base 10 numbers (see
+ *  math/dec_numbers.h) into text, without going through printf's format
+ *  strings, as results are shown for every sentence that is a mathematical
+ *  expression.
+ *
+ *  Integers are written two digits at a time, from a table that holds all
+ *  pairs of digits.
+ *
+ *  Floating point numbers are written with the fewest digits that are read
+ *  back as the very same number (Ryu's algorithm), in the same layout as
+ *  printf's "%g": in scientific notation only if their exponent is below -4
+ *  or above 16. For instance, "0.1 + 0.2" is written as
+ *  "0.30000000000000004" instead of "0.3". As long as
+ *  "d_dec_format_is_compatible" is set, they are written just as "%.15g"
+ *  would instead.
+ */
+
+
+#ifndef D_DEC_FORMAT
+#define D_DEC_FORMAT
+
+
+#include "math/dec_numbers.h"
+
+
+/* size_t */
+#include <stddef.h>
+// int64_t
+#include <stdint.h>
+
+
+/** Most characters that a base 10 number may take once written, '\0'
+    included (i.e. "-2.2250738585072014e-308"). */
+#define D_DEC_FORMAT_MAX_LENGTH 32
+
+/** Most characters that an element of an array may take once written (see
+    "d_dec_format_element"), '\0' included. */
+#define D_DEC_FORMAT_MAX_ELEMENT_LENGTH (D_DEC_FORMAT_MAX_LENGTH + 3)
+
+
+/**
+ * @brief If floating point numbers are written just as "%.15g" would.
+ *
+ * @details
+ *  It allows keeping the same output as older versions of delta, through the
+ *  "format" built-in command.
+ */
+extern int d_dec_format_is_compatible;
+
+
+/**
+ * @brief Writes the given integer.
+ *
+ * @param[in] value The integer.
+ * @param[out] buffer Where to write it, which must hold, at least,
+ *                    D_DEC_FORMAT_MAX_LENGTH characters.
+ *
+ * @return How many characters have been written, '\0' excluded.
+ */
+size_t d_dec_format_integer(
+    int64_t value,
+    char *buffer
+);
+
+
+/**
+ * @brief Writes the given floating point number.
+ *
+ * @details
+ *  Infinities and NaNs are written as "inf", "-inf", "nan" and "-nan".
+ *
+ * @param[in] value The floating point number.
+ * @param[out] buffer Where to write it, which must hold, at least,
+ *                    D_DEC_FORMAT_MAX_LENGTH characters.
+ *
+ * @return How many characters have been written, '\0' excluded.
+ */
+size_t d_dec_format_floating(
+    double value,
+    char *buffer
+);
+
+
+/**
+ * @brief Writes the given base 10 number.
+ *
+ * @param[in] dec_number The base 10 number, which must not be an array.
+ * @param[out] buffer Where to write it, which must hold, at least,
+ *                    D_DEC_FORMAT_MAX_LENGTH characters.
+ *
+ * @return How many characters have been written, '\0' excluded.
+ */
+size_t d_dec_format_number(
+    const struct d_dec_number *dec_number,
+    char *buffer
+);
+
+
+/**
+ * @brief Writes the given element of the given array.
+ *
+ * @details
+ *  Writing all elements in order results in the whole array, such as
+ *  "[1, 2, 3]": the first one is preceded by '[', the rest of them by ", ",
+ *  and the last one is followed by ']'.
+ *
+ * @param[in] dec_number The array (see math/dec_arrays.h).
+ * @param[in] index Which element.
+ * @param[out] buffer Where to write it, which must hold, at least,
+ *                    D_DEC_FORMAT_MAX_ELEMENT_LENGTH characters.
+ *
+ * @return How many characters have been written, '\0' excluded.
+ */
+size_t d_dec_format_element(
+    const struct d_dec_number *dec_number,
+    size_t index,
+    char *buffer
+);
+
+
+#endif //D_DEC_FORMAT
@@ -14,6 +14,10 @@
  *  floating data type. However, delta is intented to be a calculator, and in
  *  order to do it properly, it should avoid any C precision related errors
  *  while only integer arithmetic is required by the user.
+ *
+ *  A value may also be a whole array of numbers of the same data type (see
+ *  math/dec_arrays.h). The functions in this file only operate on single
+ *  numbers.
  */
  
 
@@ -25,6 +29,10 @@
 #include <stdint.h>
 
 
+/** See math/dec_arrays.h */
+struct d_dec_array;
+
+
 /**
  * @brief Groups all possible data types of a base 10 number.
  * 
@@ -36,6 +44,8 @@
 typedef union {
     int64_t integer;
     double floating;
+    /** If the value is an array, its elements. */
+    struct d_dec_array *array;
 } d_dec_number_values;
 
 
@@ -46,9 +56,13 @@ typedef union {
  *  Contains all the attributes that are needed to represent a base 10 number.
  */
 struct d_dec_number {
-    /** If the represented number is a floating point or an integer one. */
+    /** If the represented number is a floating point or an integer one. For
+        arrays, the data type of all of their elements. */
     uint8_t is_floating;
 
+    /** If the value is an array of numbers, rather than a single one. */
+    uint8_t is_array;
+
     /** The actual value of the number. */
     d_dec_number_values values;
 };
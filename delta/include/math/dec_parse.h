@@ -0,0 +1,79 @@
+/**
+ * @file dec_parse.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains how delta turns the lexemes of numbers into base
+ *        10 numbers.
+ *
+ * @details
+ *  This file contains how delta turns the lexemes of numeric literals into
+ *  base 10 numbers (see math/dec_numbers.h). Lexemes are read just once,
+ *  from their text and length, so they do not need to be '\0' terminated,
+ *  and the result does not depend on the locale.
+ *
+ *  Integers that do not fit in an int64_t are reported.
+ *
+ *  Floating point numbers are correctly rounded (to nearest, ties to even).
+ *  Those with no more than 19 significant digits, which are nearly all of
+ *  them, are converted with the Eisel-Lemire algorithm: a single 64 x 128
+ *  bit multiplication by a precomputed power of 5. The rare ones that it
+ *  cannot tell apart from a halfway case are converted by strtod instead.
+ */
+
+
+#ifndef D_DEC_PARSE
+#define D_DEC_PARSE
+
+
+/* size_t */
+#include <stddef.h>
+// int64_t
+#include <stdint.h>
+
+
+/** Value that "d_dec_parse_integer" returns when the integer does not fit in
+    an int64_t. */
+#define D_DEC_PARSE_OUT_OF_RANGE 1
+
+
+/**
+ * @brief Converts the given lexeme of an integer.
+ *
+ * @param[in] text The lexeme, made up of decimal digits, which does not need
+ *                 to be '\0' terminated.
+ * @param[in] length The length of the lexeme.
+ * @param[out] value The integer, or INT64_MAX if it does not fit.
+ *
+ * @return 0 if successful, D_DEC_PARSE_OUT_OF_RANGE if the integer does not
+ *         fit in an int64_t, any other value otherwise.
+ */
+int d_dec_parse_integer(
+    const char *text,
+    size_t length,
+    int64_t *value
+);
+
+
+/**
+ * @brief Converts the given lexeme of a floating point number.
+ *
+ * @details
+ *  Numbers that are too large become infinity, and those that are too small
+ *  become 0, just as strtod does.
+ *
+ * @param[in] text The lexeme, as in "12", "12.", "1.5", ".5", "1e-3" or
+ *                 "1.5E+3", which does not need to be '\0' terminated.
+ * @param[in] length The length of the lexeme.
+ * @param[out] value The floating point number.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int d_dec_parse_floating(
+    const char *text,
+    size_t length,
+    double *value
+);
+
+
+#endif //D_DEC_PARSE
@@ -0,0 +1,77 @@
+/**
+ * @file server.h
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief This file contains the server through which delta may evaluate
+ *        statements on behalf of other processes.
+ *
+ * @details
+ *  This file contains the server through which delta may evaluate statements
+ *  on behalf of other processes, which connect to it through a Unix domain
+ *  socket. Each connection gets its own embedded interpreter (see
+ *  api/delta.h), so its workspace and its compiled-expressions cache are kept
+ *  until it is closed.
+ *
+ *  The protocol is line based: clients send one sentence per line, and the
+ *  server answers each line with another one, in the same order:
+ *
+ *    - The value of the mathematical expression, if the line had one
+ *      (whether it ends with ';' or not).
+ *
+ *    - An empty line, if no mathematical expression was evaluated (i.e. an
+ *      assignment to a variable or a built-in command).
+ *
+ *    - "error", if the line raised any errors. The errors themselves are
+ *      reported through the server's stderr.
+ *
+ *  Clients may send as many lines as they want without waiting for their
+ *  answers (pipelining).
+ *
+ *  A single thread waits for all sockets through epoll, while a pool of
+ *  worker threads, as many as online processors, evaluates the lines. Each
+ *  connection is handed to one worker at a time, which evaluates one of its
+ *  lines before giving the others a chance; therefore, its answers are always
+ *  sent in order.
+ *
+ *  Served interpreters are sandboxed (see common/context.h): clients may
+ *  neither load notebooks or dynamic libraries, nor turn the JIT compiler
+ *  on or off, as it is shared by the whole process. Built-in commands which
+ *  only show information still write to the server's stdout.
+ *
+ *  The server runs until it receives SIGINT or SIGTERM.
+ */
+
+
+#ifndef D_SERVER
+#define D_SERVER
+
+
+/** Maximum length of a line that a client may send, '\n' included. Longer
+    ones close the connection. */
+#define D_SERVER_MAX_LINE_LENGTH (64 * 1024)
+
+/** Maximum amount of bytes that may be waiting to be evaluated or sent for
+    a single connection. Once it is reached, the server stops reading from
+    the connection until its client reads its answers. */
+#define D_SERVER_MAX_PENDING_LENGTH (1024 * 1024)
+
+
+/**
+ * @brief Serves connections through the given Unix domain socket.
+ *
+ * @details
+ *  The socket is created, replacing any stale socket in the same path, and
+ *  it is removed once the server stops.
+ *
+ * @param[in] socket_path Path to the socket.
+ *
+ * @return 0 if the server has been stopped through a signal, any other value
+ *         if it could not be started.
+ */
+int d_server_run(
+    const char *socket_path
+);
+
+
+#endif //D_SERVER
@@ -0,0 +1,411 @@
+/**
+ * @file batch_loader.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of analyzers/batch_loader.h
+ */
+
+
+#include "analyzers/batch_loader.h"
+
+#include "common/errors.h"
+
+
+#include <stdlib.h>
+#include <string.h>
+
+
+/**
+ * @brief Makes the given array able to hold, at least, the given amount of
+ *        elements.
+ *
+ * @param[in,out] array The array.
+ * @param[in,out] capacity How many elements the array holds.
+ * @param[in] count The amount of elements.
+ * @param[in] size The size of each element.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_batch_loader_reserve(
+    void **array,
+    size_t *capacity,
+    size_t count,
+    size_t size
+);
+
+/**
+ * @brief Splits the given chunk into lexemes.
+ *
+ * @details
+ *  It is what each thread runs, so it must not touch anything but its
+ *  chunk.
+ *
+ * @param[in,out] chunk The chunk (struct d_batch_loader_chunk).
+ *
+ * @return NULL.
+ */
+void *_d_batch_loader_scan_chunk(
+    void *chunk
+);
+
+/**
+ * @brief Hands the next chunk of the input to a thread, in the place of the
+ *        ring that the chunk before the current one has left.
+ *
+ * @param[in,out] loader The loader.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_batch_loader_start_chunk(
+    struct d_batch_loader *loader
+);
+
+
+/**
+ * @brief Implementation of batch_loader.c/_d_batch_loader_reserve
+ */
+int _d_batch_loader_reserve(
+    void **array,
+    size_t *capacity,
+    size_t count,
+    size_t size
+)
+{
+    size_t new_capacity = *capacity;
+    void *new_array = NULL;
+
+
+    if(count <= *capacity) {
+        return 0;
+    }
+
+
+    while(new_capacity < count) {
+        new_capacity = 2 * new_capacity + 1024;
+    }
+
+    if((new_array = realloc(*array, new_capacity * size)) == NULL) {
+        return -1;
+    }
+
+    *array = new_array;
+    *capacity = new_capacity;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of batch_loader.c/_d_batch_loader_scan_chunk
+ */
+void *_d_batch_loader_scan_chunk(
+    void *chunk
+)
+{
+    struct d_batch_loader_chunk *scanned = chunk;
+
+    struct d_batch_scanner_lexeme lexeme;
+    struct d_batch_loader_token *token = NULL;
+    const char *start = scanned->text;
+    const char *end = scanned->text + scanned->length;
+    const char *line_end = NULL;
+    size_t length = 0;
+    size_t offset = 0;
+
+
+    scanned->line_count = 0;
+    scanned->token_count = 0;
+    scanned->status = 0;
+
+    for(; start < end; start += length) {
+
+        line_end = memchr(start, '\n', (size_t) (end - start));
+        length = line_end != NULL ? (size_t) (line_end - start) + 1 :
+                                    (size_t) (end - start);
+
+        if(length > UINT32_MAX) {
+            scanned->status = 1;
+            break;
+        }
+
+        // The last index is the amount of lexemes of the whole chunk
+        if(_d_batch_loader_reserve((void **) &scanned->line_tokens,
+                                   &scanned->line_capacity,
+                                   scanned->line_count + 2,
+                                   sizeof(size_t)) != 0 ||
+           d_batch_scanner_set_line(&scanned->line, start, length) != 0) {
+
+            scanned->status = -1;
+            break;
+        }
+
+        scanned->line_tokens[scanned->line_count++] = scanned->token_count;
+
+        for(offset = 0; offset < length;
+            offset += lexeme.blanks + lexeme.length) {
+
+            if(_d_batch_loader_reserve((void **) &scanned->tokens,
+                                       &scanned->token_capacity,
+                                       scanned->token_count + 1,
+                                       sizeof(struct d_batch_loader_token))
+               != 0) {
+
+                scanned->status = -1;
+                break;
+            }
+
+            d_batch_scanner_scan(&scanned->line, offset, &lexeme);
+
+            token = &scanned->tokens[scanned->token_count++];
+            token->offset = (uint32_t) (offset + lexeme.blanks);
+            token->length = (uint32_t) lexeme.length;
+            token->lexical_component = (uint16_t) lexeme.lexical_component;
+            token->kind = (uint8_t) lexeme.kind;
+            token->continues = (uint8_t) lexeme.continues;
+
+            // What comes next in the line belongs to the lexeme, which the
+            // lexical analyzer completes on its own
+            if(lexeme.continues) {
+                break;
+            }
+        }
+
+        if(scanned->status != 0) {
+            break;
+        }
+    }
+
+    if(scanned->line_tokens != NULL) {
+        scanned->line_tokens[scanned->line_count] = scanned->token_count;
+    }
+
+
+    return NULL;
+}
+
+
+/**
+ * @brief Implementation of batch_loader.c/_d_batch_loader_start_chunk
+ */
+int _d_batch_loader_start_chunk(
+    struct d_batch_loader *loader
+)
+{
+    struct d_batch_loader_chunk *chunk =
+        &loader->chunks[loader->started_count % loader->chunk_count];
+
+    size_t start = loader->next_offset;
+    size_t end = loader->length;
+    const char *line_end = NULL;
+
+
+    // The chunk goes on up to the end of the line in which it would end
+    if(loader->length - start > loader->chunk_size) {
+
+        line_end = memchr(loader->text + start + loader->chunk_size - 1, '\n',
+                          loader->length - start - loader->chunk_size + 1);
+
+        if(line_end != NULL) {
+            end = (size_t) (line_end - loader->text) + 1;
+        }
+    }
+
+    chunk->text = loader->text + start;
+    chunk->length = end - start;
+    chunk->next_line = 0;
+
+    loader->next_offset = end;
+    ++loader->started_count;
+
+
+    // Without another thread, the chunk is just scanned right now
+    chunk->is_running = pthread_create(&chunk->thread, NULL,
+                                       &_d_batch_loader_scan_chunk,
+                                       chunk) == 0;
+
+    if(!chunk->is_running) {
+        _d_batch_loader_scan_chunk(chunk);
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of batch_loader.h/d_batch_loader_start
+ */
+int d_batch_loader_start(
+    struct d_batch_loader *loader,
+    const char *text,
+    size_t length,
+    size_t chunk_size,
+    size_t thread_count
+)
+{
+    if(loader == NULL || text == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "batch_loader.c", "d_batch_loader_start",
+                               "'loader' -OR- 'text'");
+        return -1;
+    }
+
+    if(chunk_size == 0 || thread_count == 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                               "batch_loader.c", "d_batch_loader_start",
+                               "'chunk_size' -OR- 'thread_count'");
+        return -1;
+    }
+
+
+    memset(loader, 0, sizeof(struct d_batch_loader));
+
+    loader->text = text;
+    loader->length = length;
+    loader->chunk_size = chunk_size;
+
+    // One more chunk than threads, the one that is being analyzed
+    loader->chunk_count = thread_count + 1;
+
+    if((loader->chunks = calloc(loader->chunk_count,
+                                sizeof(struct d_batch_loader_chunk)))
+       == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "batch_loader.c", "d_batch_loader_start",
+                               "'calloc' for the chunks");
+        return -1;
+    }
+
+
+    while(loader->started_count < loader->chunk_count &&
+          loader->next_offset < loader->length) {
+        _d_batch_loader_start_chunk(loader);
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of batch_loader.h/d_batch_loader_next_line
+ */
+int d_batch_loader_next_line(
+    struct d_batch_loader *loader,
+    size_t offset,
+    const struct d_batch_loader_token **tokens,
+    size_t *token_count
+)
+{
+    struct d_batch_loader_chunk *chunk =
+        &loader->chunks[loader->current_chunk % loader->chunk_count];
+
+
+    while(1) {
+
+        // A chunk may only be read once its thread has finished with it
+        if(chunk->is_running) {
+            pthread_join(chunk->thread, NULL);
+            chunk->is_running = 0;
+        }
+
+        if(chunk->status != 0) {
+
+            if(chunk->status < 0) {
+                d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                       "batch_loader.c",
+                                       "d_batch_loader_next_line",
+                                       "'realloc' for the lexemes");
+            }
+
+            return -1;
+        }
+
+        if(chunk->next_line < chunk->line_count) {
+            break;
+        }
+
+
+        // Once the current chunk has been analyzed, its place in the ring is
+        // taken by the next chunk to be scanned
+        if(loader->current_chunk + 1 == loader->started_count) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "batch_loader.c",
+                                   "d_batch_loader_next_line", "there are "
+                                   "no more lines");
+            return -1;
+        }
+
+        ++loader->current_chunk;
+
+        if(loader->next_offset < loader->length) {
+            _d_batch_loader_start_chunk(loader);
+        }
+
+        chunk = &loader->chunks[loader->current_chunk % loader->chunk_count];
+    }
+
+
+    // Both the loader and whoever reads the lines split them at the very
+    // same places, or else the lexemes would belong to other lines
+    if(chunk->next_line == 0 &&
+       chunk->text != loader->text + offset) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "batch_loader.c",
+                               "d_batch_loader_next_line", "the line does "
+                               "not start a chunk");
+        return -1;
+    }
+
+    *tokens = chunk->tokens + chunk->line_tokens[chunk->next_line];
+    *token_count = chunk->line_tokens[chunk->next_line + 1] -
+                   chunk->line_tokens[chunk->next_line];
+
+    ++chunk->next_line;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of batch_loader.h/d_batch_loader_stop
+ */
+int d_batch_loader_stop(
+    struct d_batch_loader *loader
+)
+{
+    size_t i = 0;
+
+
+    if(loader == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "batch_loader.c", "d_batch_loader_stop",
+                               "'loader'");
+        return -1;
+    }
+
+
+    for(i = 0; loader->chunks != NULL && i < loader->chunk_count; ++i) {
+
+        if(loader->chunks[i].is_running) {
+            pthread_join(loader->chunks[i].thread, NULL);
+        }
+
+        free(loader->chunks[i].line_tokens);
+        free(loader->chunks[i].tokens);
+        d_batch_scanner_release(&loader->chunks[i].line);
+    }
+
+    free(loader->chunks);
+    memset(loader, 0, sizeof(struct d_batch_loader));
+
+
+    return 0;
+}
@@ -0,0 +1,824 @@
+/**
+ * @file batch_scanner.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of analyzers/batch_scanner.h
+ */
+
+
+#include "analyzers/batch_scanner.h"
+
+#include "common/errors.h"
+#include "common/lexical_comp.h"
+
+
+#include <stdlib.h>
+#include <string.h>
+
+// To classify a whole block of characters at once
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/* The same few operations classify a block with either instruction set; the
+   signed comparisons do not need to care about characters above 0x7F, as
+   they are negative, and so below any of the ASCII ranges */
+#if defined(__AVX2__)
+
+/** How many characters are classified at once. */
+#define D_BATCH_SCANNER_BLOCK_SIZE 32
+
+#define D_BATCH_SCANNER_VECTOR __m256i
+#define D_BATCH_SCANNER_LOAD(block) \
+    _mm256_loadu_si256((const __m256i *) (block))
+#define D_BATCH_SCANNER_SET(character) _mm256_set1_epi8((char) (character))
+#define D_BATCH_SCANNER_EQ(a, b) _mm256_cmpeq_epi8((a), (b))
+#define D_BATCH_SCANNER_GT(a, b) _mm256_cmpgt_epi8((a), (b))
+#define D_BATCH_SCANNER_AND(a, b) _mm256_and_si256((a), (b))
+#define D_BATCH_SCANNER_OR(a, b) _mm256_or_si256((a), (b))
+#define D_BATCH_SCANNER_XOR(a, b) _mm256_xor_si256((a), (b))
+#define D_BATCH_SCANNER_MOVEMASK(a) ((uint32_t) _mm256_movemask_epi8(a))
+
+#elif defined(__SSE2__)
+
+/** How many characters are classified at once. */
+#define D_BATCH_SCANNER_BLOCK_SIZE 16
+
+#define D_BATCH_SCANNER_VECTOR __m128i
+#define D_BATCH_SCANNER_LOAD(block) \
+    _mm_loadu_si128((const __m128i *) (block))
+#define D_BATCH_SCANNER_SET(character) _mm_set1_epi8((char) (character))
+#define D_BATCH_SCANNER_EQ(a, b) _mm_cmpeq_epi8((a), (b))
+#define D_BATCH_SCANNER_GT(a, b) _mm_cmpgt_epi8((a), (b))
+#define D_BATCH_SCANNER_AND(a, b) _mm_and_si128((a), (b))
+#define D_BATCH_SCANNER_OR(a, b) _mm_or_si128((a), (b))
+#define D_BATCH_SCANNER_XOR(a, b) _mm_xor_si128((a), (b))
+#define D_BATCH_SCANNER_MOVEMASK(a) ((uint32_t) _mm_movemask_epi8(a))
+
+#endif
+
+
+/** How many characters of a run are walked one by one before looking up the
+    rest of it in the bit masks. */
+#define D_BATCH_SCANNER_SHORT_SPAN 8
+
+
+/**
+ * @brief Returns whether the given character belongs to the given class.
+ */
+int _d_batch_scanner_is(
+    unsigned char character,
+    enum d_batch_scanner_class class
+)
+{
+    switch(class) {
+
+        case D_BATCH_SCANNER_CLASS_DIGIT:
+            return character >= '0' && character <= '9';
+
+        case D_BATCH_SCANNER_CLASS_WORD:
+            return (character >= '0' && character <= '9') ||
+                   ((character | 0x20) >= 'a' && (character | 0x20) <= 'z') ||
+                   character == '_';
+
+        case D_BATCH_SCANNER_CLASS_BLANK:
+            return character == ' ' || character == '\t';
+
+        // lexical.l's "[ -²]" is read by flex byte by byte: from ' ' up to
+        // the first byte of '²' in UTF-8 (0xC2), and its second byte (0xB2),
+        // which is already within that range
+        case D_BATCH_SCANNER_CLASS_PRINT:
+            return character >= ' ' && character <= 0xC2;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns whether the given character is a letter.
+ */
+int _d_batch_scanner_is_alpha(
+    unsigned char character
+)
+{
+    return (character | 0x20) >= 'a' && (character | 0x20) <= 'z';
+}
+
+
+#ifdef D_BATCH_SCANNER_BLOCK_SIZE
+
+/**
+ * @brief Returns which characters of the given block are within the given
+ *        range, both compared as signed.
+ */
+D_BATCH_SCANNER_VECTOR _d_batch_scanner_in_range(
+    D_BATCH_SCANNER_VECTOR characters,
+    signed char lowest,
+    signed char highest
+)
+{
+    return D_BATCH_SCANNER_AND(
+               D_BATCH_SCANNER_GT(characters,
+                                  D_BATCH_SCANNER_SET(lowest - 1)),
+               D_BATCH_SCANNER_GT(D_BATCH_SCANNER_SET(highest + 1),
+                                  characters)
+           );
+}
+
+
+/**
+ * @brief Classifies a whole block of characters.
+ *
+ * @param[in] block The block, of D_BATCH_SCANNER_BLOCK_SIZE characters.
+ * @param[in] shift Where the block starts within its window.
+ * @param[in,out] masks The bit masks of the window, one for each class.
+ */
+void _d_batch_scanner_classify_block(
+    const char *block,
+    size_t shift,
+    uint64_t *masks
+)
+{
+    D_BATCH_SCANNER_VECTOR characters = D_BATCH_SCANNER_LOAD(block);
+    D_BATCH_SCANNER_VECTOR digits;
+    D_BATCH_SCANNER_VECTOR letters;
+    D_BATCH_SCANNER_VECTOR blanks;
+    D_BATCH_SCANNER_VECTOR prints;
+
+
+    digits = _d_batch_scanner_in_range(characters, '0', '9');
+
+    // Setting 0x20 turns upper case letters into lower case ones
+    letters = _d_batch_scanner_in_range(
+                  D_BATCH_SCANNER_OR(characters, D_BATCH_SCANNER_SET(0x20)),
+                  'a', 'z'
+              );
+
+    blanks = D_BATCH_SCANNER_OR(
+                 D_BATCH_SCANNER_EQ(characters, D_BATCH_SCANNER_SET(' ')),
+                 D_BATCH_SCANNER_EQ(characters, D_BATCH_SCANNER_SET('\t'))
+             );
+
+    // Flipping the highest bit makes the signed comparisons behave as
+    // unsigned ones, as the range goes past 0x7F
+    prints = _d_batch_scanner_in_range(
+                 D_BATCH_SCANNER_XOR(characters, D_BATCH_SCANNER_SET(0x80)),
+                 (signed char) (' ' - 0x80), (signed char) (0xC2 - 0x80)
+             );
+
+
+    masks[D_BATCH_SCANNER_CLASS_DIGIT] |=
+        (uint64_t) D_BATCH_SCANNER_MOVEMASK(digits) << shift;
+    masks[D_BATCH_SCANNER_CLASS_WORD] |=
+        (uint64_t) D_BATCH_SCANNER_MOVEMASK(
+            D_BATCH_SCANNER_OR(
+                D_BATCH_SCANNER_OR(digits, letters),
+                D_BATCH_SCANNER_EQ(characters, D_BATCH_SCANNER_SET('_'))
+            )
+        ) << shift;
+    masks[D_BATCH_SCANNER_CLASS_BLANK] |=
+        (uint64_t) D_BATCH_SCANNER_MOVEMASK(blanks) << shift;
+    masks[D_BATCH_SCANNER_CLASS_PRINT] |=
+        (uint64_t) D_BATCH_SCANNER_MOVEMASK(prints) << shift;
+}
+
+#endif
+
+
+/**
+ * @brief Classifies a whole window of characters.
+ *
+ * @param[in] window The window, of D_BATCH_SCANNER_WINDOW_SIZE characters.
+ * @param[out] masks The bit masks of the window, one for each class.
+ */
+void _d_batch_scanner_classify_window(
+    const char *window,
+    uint64_t *masks
+)
+{
+    size_t i = 0;
+    size_t class = 0;
+
+
+    for(class = 0; class < D_BATCH_SCANNER_CLASS_COUNT; ++class) {
+        masks[class] = 0;
+    }
+
+    #ifdef D_BATCH_SCANNER_BLOCK_SIZE
+
+    for(i = 0; i < D_BATCH_SCANNER_WINDOW_SIZE;
+        i += D_BATCH_SCANNER_BLOCK_SIZE) {
+        _d_batch_scanner_classify_block(window + i, i, masks);
+    }
+
+    #else
+
+    for(i = 0; i < D_BATCH_SCANNER_WINDOW_SIZE; ++i) {
+
+        for(class = 0; class < D_BATCH_SCANNER_CLASS_COUNT; ++class) {
+            masks[class] |= (uint64_t) _d_batch_scanner_is(
+                                (unsigned char) window[i], class) << i;
+        }
+    }
+
+    #endif
+}
+
+
+/**
+ * @brief Classifies the windows of the given line up to the given one, those
+ *        that have not been classified yet.
+ */
+void _d_batch_scanner_classify_up_to(
+    struct d_batch_scanner_line *line,
+    size_t last_window
+)
+{
+    size_t window = line->classified_window_count;
+    size_t rest = 0;
+
+    // The last window is padded with '\0's, which belong to no class
+    char padded_window[D_BATCH_SCANNER_WINDOW_SIZE];
+
+
+    for(; window <= last_window; ++window) {
+
+        rest = line->length - window * D_BATCH_SCANNER_WINDOW_SIZE;
+
+        if(rest >= D_BATCH_SCANNER_WINDOW_SIZE) {
+
+            _d_batch_scanner_classify_window(
+                line->text + window * D_BATCH_SCANNER_WINDOW_SIZE,
+                line->masks + window * D_BATCH_SCANNER_CLASS_COUNT
+            );
+        }
+        else {
+
+            memset(padded_window, 0, D_BATCH_SCANNER_WINDOW_SIZE);
+            memcpy(padded_window,
+                   line->text + window * D_BATCH_SCANNER_WINDOW_SIZE, rest);
+
+            _d_batch_scanner_classify_window(
+                padded_window,
+                line->masks + window * D_BATCH_SCANNER_CLASS_COUNT
+            );
+        }
+    }
+
+    line->classified_window_count = window;
+}
+
+
+/**
+ * @brief Implementation of batch_scanner.h/d_batch_scanner_set_line
+ */
+int d_batch_scanner_set_line(
+    struct d_batch_scanner_line *line,
+    const char *text,
+    size_t length
+)
+{
+    size_t window_count = (length + D_BATCH_SCANNER_WINDOW_SIZE - 1) /
+                          D_BATCH_SCANNER_WINDOW_SIZE;
+    size_t capacity = window_count * D_BATCH_SCANNER_CLASS_COUNT;
+    uint64_t *masks = NULL;
+
+
+    if(line == NULL || text == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "batch_scanner.c", "d_batch_scanner_set_line",
+                               "'line' or 'text'");
+        return -1;
+    }
+
+
+    // The bit masks are allocated right away, so that classifying the line
+    // may never fail
+    if(capacity > line->mask_capacity) {
+
+        if((masks = realloc(line->masks, capacity * sizeof(uint64_t)))
+           == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                   "batch_scanner.c",
+                                   "d_batch_scanner_set_line",
+                                   "'realloc' for the bit masks");
+            return -1;
+        }
+
+        line->masks = masks;
+        line->mask_capacity = capacity;
+    }
+
+    line->text = text;
+    line->length = length;
+    line->classified_window_count = 0;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of batch_scanner.h/d_batch_scanner_span
+ */
+size_t d_batch_scanner_span(
+    struct d_batch_scanner_line *line,
+    size_t offset,
+    enum d_batch_scanner_class class
+)
+{
+    size_t start = offset;
+    size_t short_end = line->length - offset > D_BATCH_SCANNER_SHORT_SPAN ?
+                           offset + D_BATCH_SCANNER_SHORT_SPAN :
+                           line->length;
+    size_t window = 0;
+    size_t shift = 0;
+    uint64_t mismatches = 0;
+
+
+    // Most runs are short, and walking them is cheaper than looking them up
+    // in the bit masks (the processor can guess where they end, but not
+    // what a bit mask is going to say)
+    while(offset < short_end &&
+          _d_batch_scanner_is((unsigned char) line->text[offset], class)) {
+        ++offset;
+    }
+
+    if(offset < short_end || offset >= line->length) {
+        return offset - start;
+    }
+
+
+    // The bits that are shifted in look like matches, so that windows where
+    // the rest of the characters match are left behind too
+    window = offset / D_BATCH_SCANNER_WINDOW_SIZE;
+    shift = offset % D_BATCH_SCANNER_WINDOW_SIZE;
+
+    if(window >= line->classified_window_count) {
+        _d_batch_scanner_classify_up_to(line, window);
+    }
+
+    mismatches = ~line->masks[window * D_BATCH_SCANNER_CLASS_COUNT + class] >>
+                 shift;
+    offset -= shift;
+
+    while(mismatches == 0) {
+
+        ++window;
+        offset += D_BATCH_SCANNER_WINDOW_SIZE;
+
+        // Only when the line's last window is full
+        if(offset >= line->length) {
+            return line->length - start;
+        }
+
+        if(window >= line->classified_window_count) {
+            _d_batch_scanner_classify_up_to(line, window);
+        }
+
+        mismatches = ~line->masks[window * D_BATCH_SCANNER_CLASS_COUNT +
+                                  class];
+        shift = 0;
+    }
+
+
+    // '\0's in the last window do not match, so the span never goes past the
+    // end of the line
+    return offset + shift + (size_t) __builtin_ctzll(mismatches) - start;
+}
+
+
+/**
+ * @brief Sets the kind and length of the given lexeme.
+ *
+ * @return 0, so that it can be returned right away.
+ */
+int _d_batch_scanner_set(
+    struct d_batch_scanner_lexeme *lexeme,
+    enum d_batch_scanner_kind kind,
+    size_t length
+)
+{
+    lexeme->kind = kind;
+    lexeme->length = length;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Sets the given lexeme as a malformed number, which also spans the
+ *        characters of identifiers after its first "length" ones.
+ *
+ * @param[in] lexeme The lexeme.
+ * @param[in] kind The kind of malformed number.
+ * @param[in,out] line The line.
+ * @param[in] start Where the lexeme starts.
+ * @param[in] length How many characters the lexeme spans, at least.
+ *
+ * @return 0, so that it can be returned right away.
+ */
+int _d_batch_scanner_set_bad(
+    struct d_batch_scanner_lexeme *lexeme,
+    enum d_batch_scanner_kind kind,
+    struct d_batch_scanner_line *line,
+    size_t start,
+    size_t length
+)
+{
+    size_t word = d_batch_scanner_span(line, start + length,
+                                       D_BATCH_SCANNER_CLASS_WORD);
+
+
+    return _d_batch_scanner_set(lexeme, kind, length + word);
+}
+
+
+/**
+ * @brief Recognizes what follows after a number's 'E' -OR- 'e'.
+ *
+ * @details
+ *  Mirrors lexical.l's rules for floats' exponents: either the exponent is
+ *  valid, or the number is malformed (and spans the characters of
+ *  identifiers that follow), or the number ends right before the 'E' -OR-
+ *  'e', which is given back.
+ *
+ * @param[in,out] line The line.
+ * @param[in] start Where the number starts.
+ * @param[in] mantissa How many characters come before the 'E' -OR- 'e'.
+ * @param[in] kind The kind of number that they are, by themselves.
+ * @param[out] lexeme The lexeme.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_batch_scanner_exponent(
+    struct d_batch_scanner_line *line,
+    size_t start,
+    size_t mantissa,
+    enum d_batch_scanner_kind kind,
+    struct d_batch_scanner_lexeme *lexeme
+)
+{
+    const char *text = line->text;
+    size_t sign = start + mantissa + 1;
+    size_t digits = 0;
+    size_t word = 0;
+    size_t i = 0;
+
+
+    // Only the end of the input may follow; the 'E' -OR- 'e' is given back
+    if(sign == line->length) {
+        return _d_batch_scanner_set(lexeme, kind, mantissa);
+    }
+
+
+    if(_d_batch_scanner_is((unsigned char) text[sign],
+                           D_BATCH_SCANNER_CLASS_DIGIT)) {
+
+        digits = sign + d_batch_scanner_span(line, sign,
+                                             D_BATCH_SCANNER_CLASS_DIGIT);
+        word = sign + d_batch_scanner_span(line, sign,
+                                           D_BATCH_SCANNER_CLASS_WORD);
+
+        // A letter anywhere after the digits (and '_') makes it malformed;
+        // '_' by itself is given back
+        for(i = digits; i < word; ++i) {
+
+            if(_d_batch_scanner_is_alpha((unsigned char) text[i])) {
+                return _d_batch_scanner_set(lexeme,
+                                            D_BATCH_SCANNER_FLOAT_BAD_DIGITS,
+                                            word - start);
+            }
+        }
+
+        return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_FLOAT,
+                                    digits - start);
+    }
+
+
+    // Neither a sign nor a digit, which may even be the '\n'
+    if(text[sign] != '+' && text[sign] != '-') {
+
+        lexeme->continues = text[sign] == '\n';
+
+        return _d_batch_scanner_set_bad(lexeme,
+                                        D_BATCH_SCANNER_FLOAT_BAD_EXPONENT,
+                                        line, start, sign + 1 - start);
+    }
+
+
+    // The sign by itself is what is not a digit (when at the end of the
+    // input, or when the characters of identifiers that follow it go past
+    // the exponent's digits)
+    if(sign + 1 == line->length) {
+        return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_FLOAT_BAD_SIGN,
+                                    line->length - start);
+    }
+
+    if(_d_batch_scanner_is((unsigned char) text[sign + 1],
+                           D_BATCH_SCANNER_CLASS_DIGIT)) {
+
+        digits = sign + 1 +
+                 d_batch_scanner_span(line, sign + 1,
+                                      D_BATCH_SCANNER_CLASS_DIGIT);
+        word = sign + 1 +
+               d_batch_scanner_span(line, sign + 1,
+                                    D_BATCH_SCANNER_CLASS_WORD);
+
+        return word > digits ?
+                   _d_batch_scanner_set(lexeme,
+                                        D_BATCH_SCANNER_FLOAT_BAD_SIGN,
+                                        word - start) :
+                   _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_FLOAT,
+                                        digits - start);
+    }
+
+    lexeme->continues = text[sign + 1] == '\n';
+
+
+    return _d_batch_scanner_set_bad(lexeme, D_BATCH_SCANNER_FLOAT_BAD_SIGN,
+                                    line, start, sign + 2 - start);
+}
+
+
+/**
+ * @brief Recognizes the number (or the decimal dot) at the given offset of
+ *        the given line.
+ *
+ * @param[in,out] line The line.
+ * @param[in] start Where the number, which begins with a digit or a '.',
+ *                  starts.
+ * @param[out] lexeme The lexeme.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_batch_scanner_number(
+    struct d_batch_scanner_line *line,
+    size_t start,
+    struct d_batch_scanner_lexeme *lexeme
+)
+{
+    const char *text = line->text;
+    enum d_batch_scanner_kind kind = D_BATCH_SCANNER_INTEGER;
+    size_t end = start + d_batch_scanner_span(line, start,
+                                              D_BATCH_SCANNER_CLASS_DIGIT);
+    size_t decimals = 0;
+    unsigned char next = 0;
+
+
+    if(end < line->length && text[end] == '.') {
+
+        decimals = d_batch_scanner_span(line, end + 1,
+                                        D_BATCH_SCANNER_CLASS_DIGIT);
+        kind = D_BATCH_SCANNER_FLOAT;
+
+        if(decimals == 0) {
+
+            // A lone decimal dot is not a number
+            if(end == start) {
+                return _d_batch_scanner_set(lexeme,
+                                            D_BATCH_SCANNER_CHARACTER, 1);
+            }
+
+            if(end + 1 < line->length &&
+               _d_batch_scanner_is_alpha((unsigned char) text[end + 1])) {
+
+                return _d_batch_scanner_set_bad(lexeme,
+                                                D_BATCH_SCANNER_FLOAT_BAD_DOT,
+                                                line, start,
+                                                end + 2 - start);
+            }
+
+            return _d_batch_scanner_set(lexeme, kind, end + 1 - start);
+        }
+
+        end += 1 + decimals;
+    }
+
+
+    if(end == line->length) {
+        return _d_batch_scanner_set(lexeme, kind, end - start);
+    }
+
+    next = (unsigned char) text[end];
+
+    if((next | 0x20) == 'e') {
+        return _d_batch_scanner_exponent(line, start, end - start, kind,
+                                         lexeme);
+    }
+
+    // Any other letter makes the number malformed, but a 'B' -OR- 'b' after
+    // an integer, which is kept for binary numbers
+    if(_d_batch_scanner_is_alpha(next) && kind == D_BATCH_SCANNER_FLOAT) {
+        return _d_batch_scanner_set_bad(lexeme,
+                                        D_BATCH_SCANNER_FLOAT_BAD_DECIMALS,
+                                        line, start, end + 1 - start);
+    }
+
+    if(_d_batch_scanner_is_alpha(next) && (next | 0x20) != 'b') {
+        return _d_batch_scanner_set_bad(lexeme, D_BATCH_SCANNER_INTEGER_BAD,
+                                        line, start, end + 1 - start);
+    }
+
+
+    return _d_batch_scanner_set(lexeme, kind, end - start);
+}
+
+
+/**
+ * @brief Recognizes the string at the given offset of the given line.
+ *
+ * @details
+ *  As in lexical.l, the string spans up to the last double quote of the
+ *  line's run of printable characters.
+ *
+ * @param[in,out] line The line.
+ * @param[in] start Where the string, which begins with a double quote,
+ *                  starts.
+ * @param[out] lexeme The lexeme.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_batch_scanner_string(
+    struct d_batch_scanner_line *line,
+    size_t start,
+    struct d_batch_scanner_lexeme *lexeme
+)
+{
+    const char *text = line->text + start;
+    size_t last_quote = d_batch_scanner_span(line, start + 1,
+                                             D_BATCH_SCANNER_CLASS_PRINT);
+
+
+    while(last_quote > 0 && text[last_quote] != '"') {
+        --last_quote;
+    }
+
+
+    // Without a closing quote, only the opening one is kept
+    if(last_quote == 0) {
+        return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_CHARACTER, 1);
+    }
+
+
+    return _d_batch_scanner_set(lexeme, last_quote == 1 ?
+                                            D_BATCH_SCANNER_STRING_EMPTY :
+                                            D_BATCH_SCANNER_STRING,
+                                last_quote + 1);
+}
+
+
+/**
+ * @brief Implementation of batch_scanner.h/d_batch_scanner_scan
+ */
+int d_batch_scanner_scan(
+    struct d_batch_scanner_line *line,
+    size_t offset,
+    struct d_batch_scanner_lexeme *lexeme
+)
+{
+    unsigned char first = 0;
+
+
+    if(line == NULL || lexeme == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "batch_scanner.c", "d_batch_scanner_scan",
+                               "'line' or 'lexeme'");
+        return -1;
+    }
+
+    if(offset >= line->length) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                               "batch_scanner.c", "d_batch_scanner_scan",
+                               "'offset' must be < the line's length");
+        return -1;
+    }
+
+
+    lexeme->lexical_component = 0;
+    lexeme->continues = 0;
+
+    // Blanks are skipped along with the lexeme that follows them, but for
+    // those at the end of the line, which are a lexeme by themselves
+    lexeme->blanks = d_batch_scanner_span(line, offset,
+                                          D_BATCH_SCANNER_CLASS_BLANK);
+
+    if(offset + lexeme->blanks == line->length) {
+
+        lexeme->blanks = 0;
+
+        return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_BLANKS,
+                                    line->length - offset);
+    }
+
+    offset += lexeme->blanks;
+
+    lexeme->kind = D_BATCH_SCANNER_COMPONENT;
+    lexeme->length = 1;
+
+    first = (unsigned char) line->text[offset];
+
+    switch(first) {
+
+        case '+':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_PLUS;
+            return 0;
+        case '-':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_MINUS;
+            return 0;
+        case '*':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_TIMES;
+            return 0;
+        case '/':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_DIV;
+            return 0;
+        case '%':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_MOD;
+            return 0;
+        case '^':
+            lexeme->lexical_component = D_LC_OP_ARITHMETIC_EXPONENT;
+            return 0;
+        case '=':
+            lexeme->lexical_component = D_LC_OP_ASSIGNMENT_ASSIGN;
+            return 0;
+        case ';':
+            lexeme->lexical_component = D_LC_SEPARATOR_SEMICOL;
+            return 0;
+        case '(':
+            lexeme->lexical_component = D_LC_SEPARATOR_L_PARENTHESIS;
+            return 0;
+        case ')':
+            lexeme->lexical_component = D_LC_SEPARATOR_R_PARENTHESIS;
+            return 0;
+        case '[':
+            lexeme->lexical_component = D_LC_SEPARATOR_L_BRACKET;
+            return 0;
+        case ']':
+            lexeme->lexical_component = D_LC_SEPARATOR_R_BRACKET;
+            return 0;
+        case ',':
+            lexeme->lexical_component = D_LC_SEPARATOR_COMMA;
+            return 0;
+
+        case '\n':
+            return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_EOL, 1);
+
+        case '"':
+            return _d_batch_scanner_string(line, offset, lexeme);
+
+        case '.':
+            return _d_batch_scanner_number(line, offset, lexeme);
+    }
+
+
+    if(_d_batch_scanner_is(first, D_BATCH_SCANNER_CLASS_DIGIT)) {
+        return _d_batch_scanner_number(line, offset, lexeme);
+    }
+
+    if(_d_batch_scanner_is_alpha(first) || first == '_') {
+        return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_IDENTIFIER,
+                                    d_batch_scanner_span(line, offset,
+                                        D_BATCH_SCANNER_CLASS_WORD));
+    }
+
+
+    // Any other character is not supported
+    return _d_batch_scanner_set(lexeme, D_BATCH_SCANNER_CHARACTER, 1);
+}
+
+
+/**
+ * @brief Implementation of batch_scanner.h/d_batch_scanner_release
+ */
+int d_batch_scanner_release(
+    struct d_batch_scanner_line *line
+)
+{
+    if(line == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "batch_scanner.c", "d_batch_scanner_release",
+                               "'line'");
+        return -1;
+    }
+
+
+    free(line->masks);
+
+    line->masks = NULL;
+    line->mask_capacity = 0;
+
+
+    return 0;
+}
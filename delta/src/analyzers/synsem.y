@@ -16,10 +16,22 @@
 
     #include "analyzers/synsem.h"
 
+    #include "common/arena.h"
+    #include "common/context.h"
     #include "common/errors.h"
     #include "common/help.h"
     #include "common/symbol_table.h"
 
+    #include "interpreter/ast.h"
+    #include "interpreter/bytecode.h"
+    #include "interpreter/cache.h"
+    #include "interpreter/notebook.h"
+    #include "interpreter/optimizer.h"
+    #include "interpreter/vm.h"
+
+    #include "math/dec_arrays.h"
+    #include "math/dec_format.h"
+
 
     #include <stdio.h>
     #include <stdlib.h>
@@ -27,18 +39,12 @@
     /* For some basic operations that are expected to be available in a
        calculator */
     #include <math.h>
-    // To print int64_t data type
-    #include <inttypes.h>
 
 
     /* ═══════════════ */
     /* ═══ Defines ═══ */
     /* ═══════════════ */
 
-    /** Max length of string literals. Setting a static buffer for these
-        literals will avoid having to constantly reserve and free memory. */
-    #define D_LC_LITERAL_STR_MAX_LENGTH 256
-
     /** Which string is shown as prompt when delta is waiting for orders. */
     #define D_SYNSEM_PROMPT ">> "
 }
@@ -51,12 +57,20 @@
 /** Bison requires specifying all possible semantic data types, for both
     terminal and non-terminal symbols, through a single union. */
 %union {
-    /** Literal strings. */
-    char string[D_LC_LITERAL_STR_MAX_LENGTH];
+    /** Literal strings, which live in the string pool of the lexical
+        analyzer until the next sentence starts. */
+    struct {
+        /** The string, without its double quotes, '\0' terminated. */
+        const char *text;
+        /** The length of the string. */
+        size_t length;
+    } string;
     /** Literal base 10 numbers. */
     struct d_dec_number dec_number;
     /** Identifiers. */
     struct d_symbol_table_entry *st_entry;
+    /** Mathematical expressions. */
+    struct d_ast_node *ast_node;
 }
 
 
@@ -65,6 +79,11 @@
 /* Symbol location tracking */
 %locations
 
+/* No global state: the parser, and the lexical analyzer that it calls, work
+   on the context that they are given */
+%define api.pure full
+%param {struct d_context *context}
+
 
 /* ═══════════════════════════ Bison declarations ═════════════════════════ */
 
@@ -126,6 +145,8 @@
 
 /* ** Separators ** */
 %token D_LC_SEPARATOR_L_PARENTHESIS D_LC_SEPARATOR_R_PARENTHESIS
+%token D_LC_SEPARATOR_L_BRACKET D_LC_SEPARATOR_R_BRACKET
+%token D_LC_SEPARATOR_COMMA
 
 /* ** Higher precedence arithmetic operators ** */
 %precedence D_LC_OP_ARITHMETIC_NEG /* This precedence rule will be used in a following section to negate expresions */
@@ -138,11 +159,32 @@
 
 /* Only those that may have semantic values need to be declared, in order to
    know their associated data types. */
-%type <dec_number> expression;
+%type <ast_node> expression elements;
 
 /* The other non-terminal symbols do not need to be explicitely declared. */
 
 
+/* ═══════════════════════════ Exported functions ═════════════════════════ */
+
+%code provides {
+    /**
+     * @brief The lexical analyzer identifies the next lexical component
+     *        (see analyzers/lexical.h).
+     *
+     * @param[out] value The semantic value of the lexical component, if any.
+     * @param[out] location Where the lexical component has been found.
+     * @param[in,out] context The context.
+     *
+     * @return The category of the lexical component.
+     */
+    int yylex(
+        YYSTYPE *value,
+        YYLTYPE *location,
+        struct d_context *context
+    );
+}
+
+
 /* ═══════════════════════ Local functions/variables ══════════════════════ */
 
 %code {
@@ -158,31 +200,115 @@
      *  If this function were to be called, it would be due to some kind of
      *  unexpected error.
      *
+     * @param[in] location Where the error has been found.
+     * @param[in,out] context The context.
      * @param[in] msg The error message.
      */
-    void yyerror(char const *msg);
+    void yyerror(
+        YYLTYPE *location,
+        struct d_context *context,
+        char const *msg
+    );
+
+
+    /**
+     * @brief Implementation of synsem.h/d_synsem_state
+     */
+    struct d_synsem_state {
+        /**
+         * @brief Arena from which the ASTs of the current line are allocated.
+         *
+         * @details
+         *  Each mathematical expression is recognized as an AST, which is
+         *  only evaluated once the whole sentence that contains it has been
+         *  recognized. As trees are not needed any more after that, the arena
+         *  gets reset after each line.
+         */
+        struct d_arena ast_arena;
+
+        /**
+         * @brief Program of the current line that may be added to the
+         *        compiled-expressions cache (see interpreter/cache.h).
+         *
+         * @details
+         *  It is only set when the line's sentence is a mathematical
+         *  expression. Once the whole line has been recognized, the program
+         *  is cached if no errors were raised while analyzing the line.
+         */
+        struct d_bytecode cacheable_program;
+
+        /** If "cacheable_program" holds the current line's program. */
+        int has_cacheable_program;
+
+        /** If the value of the cacheable program's expression must be
+            shown. */
+        int cacheable_echo;
+
+        /** The AST from which the cacheable program was compiled. */
+        struct d_ast_node *cacheable_root;
+
+        /** The compiled notebook to which the programs of lines are added,
+            instead of caching them, or NULL if the input is being run (see
+            "d_synsem_analyzer_compile"). */
+        struct d_notebook_writer *writer;
+
+        /** How many errors had been shown when the current line started to
+            be analyzed (see common/context.h/error_count). */
+        size_t line_start_errors;
+    };
+
 
+    /**
+     * @brief Computes the value of the given mathematical expression.
+     *
+     * @details
+     *  The expression's AST is optimized and compiled into a program, which
+     *  is run right away by the virtual machine. Any semantic errors are
+     *  reported. While compiling a notebook, the program is not run, and the
+     *  value is always 0.
+     *
+     * @param[in,out] context The context.
+     * @param[in] root The root of the expression's AST.
+     * @param[out] bytecode The program into which the expression has been
+     *                      compiled. It is freed along with the AST.
+     * @param[out] value The expression's value.
+     *
+     * @return 0 if successful, any other value otherwise.
+     */
+    int _d_synsem_evaluate(
+        struct d_context *context,
+        struct d_ast_node *root,
+        struct d_bytecode *bytecode,
+        struct d_dec_number *value
+    );
 
     /**
-     * @brief Flag that tells the syntactic & semantic analyzer if it must
-     *        request the lexical analyzer to read another file.
+     * @brief Reports the value of a mathematical expression.
      *
      * @details
-     *  Flag that tells the syntactic & semantic analyzer if it must request
-     *  the lexical analyzer to read another file. Depending on its value:
+     *  The value is kept in the context as its last value. It is also shown
+     *  if so requested, providing that a user is driving the interpreter; it
+     *  is written through math/dec_format.h straight into stdout's buffer.
      *
-     *    - 0: no other file needs to be read.
-     *    - Otherwise: after reading the whole current line, the request will
-     *                 be issued to the lexical analyzer and the flag's value
-     *                 will be reset.
+     * @param[in,out] context The context.
+     * @param[in] value The value.
+     * @param[in] echo If the value must be shown.
      */
-     int d_synsem_load_file;
+    void _d_synsem_report_value(
+        struct d_context *context,
+        const struct d_dec_number *value,
+        int echo
+    );
 
-     /**
-      * @brief Path of the other file that the lexical analyzer must read, if
-      *        any.
-      */
-     const char *d_synsem_load_file_path;
+    /**
+     * @brief Shows the prompt, providing that a user is typing in statements
+     *        through stdin.
+     *
+     * @param[in] context The context.
+     */
+    void _d_synsem_show_prompt(
+        struct d_context *context
+    );
 }
 
 
@@ -199,22 +325,30 @@ input:
     |   /* Read as many lines as possible. */
         input  line
         {
+            /* The ASTs of the line, and their programs, have already been
+               evaluated (and cached, if possible) */
+            d_arena_reset(&(context->synsem->ast_arena));
+            context->synsem->has_cacheable_program = 0;
+
             /* If the analyzer has been requested to point the lexical one to
                load another file */
-            if(d_synsem_load_file) {
+            if(context->load_file_path != NULL) {
 
-                d_synsem_load_file = 0;
-
-                if(d_lexical_analyzer_new_file(d_synsem_load_file_path)
+                if(d_lexical_analyzer_new_file(context,
+                                               context->load_file_path)
                    == 0) {
                     printf("   File successfully loaded\n");
                 }
+
+                free(context->load_file_path);
+                context->load_file_path = NULL;
             }
 
             /* Shown after each line that the user types in */
-            if(d_lex_is_stdin) {
-                printf(D_SYNSEM_PROMPT);            
-            }
+            _d_synsem_show_prompt(context);
+
+            /* Errors from now on will belong to the next line */
+            context->synsem->line_start_errors = context->error_count;
         }
     ;
 
@@ -236,6 +370,36 @@ line:
 
     |   /* A sentence + '\n' */
         sentence  D_LC_WHITESPACE_EOL
+            {
+                const char *text = NULL;
+                size_t length = 0;
+
+                /* Clean mathematical expressions are remembered, so that the
+                   whole line can be skipped when it is input again (or
+                   whenever the notebook that is being compiled is loaded) */
+                if(context->synsem->has_cacheable_program &&
+                   context->error_count ==
+                   context->synsem->line_start_errors) {
+
+                    text = d_lexical_analyzer_get_current_line(context,
+                                                               &length);
+
+                    if(context->synsem->writer != NULL) {
+                        d_notebook_writer_add(
+                            context->synsem->writer, text, length,
+                            context->synsem->cacheable_root,
+                            &(context->synsem->cacheable_program),
+                            context->synsem->cacheable_echo
+                        );
+                    }
+
+                    else {
+                        d_cache_add(context->cache, text, length,
+                                    &(context->synsem->cacheable_program),
+                                    context->synsem->cacheable_echo);
+                    }
+                }
+            }
 
 
     /* ═══ Dangling parentheses ═══ */
@@ -243,7 +407,8 @@ line:
     |   /* An unmatched left parenthesis. */
         D_LC_SEPARATOR_L_PARENTHESIS  sentence  D_LC_WHITESPACE_EOL
             {
-                d_errors_parse_show(3, D_ERR_SYN_UNMATCHED_PARENTHESIS,
+                d_errors_parse_show(context, 3,
+                                    D_ERR_SYN_UNMATCHED_PARENTHESIS,
                                     @1.last_line, @1.last_column);
                 /* Raises the error to discard the whole input line */
                 //YYERROR;
@@ -252,7 +417,8 @@ line:
     |   /* An unmatched right parenthesis. */
         sentence  D_LC_SEPARATOR_R_PARENTHESIS  D_LC_WHITESPACE_EOL
             {
-                d_errors_parse_show(3, D_ERR_SYN_UNMATCHED_PARENTHESIS,
+                d_errors_parse_show(context, 3,
+                                    D_ERR_SYN_UNMATCHED_PARENTHESIS,
                                     @2.last_line, @2.last_column);
                 /* Raises the error to discard the whole input line */
                 //YYERROR;
@@ -280,20 +446,44 @@ sentence:
        /* A mathematical expression + '\n'. */
         expression 
             {
-                /* Always shows the value of the expression */
+                struct d_dec_number value;
 
-                if($1.is_floating) {
-                    printf("   %.15g\n", $1.values.floating);
-                }
-                else {
-                    printf("   %" PRId64 "\n", $1.values.integer);
+                /* The whole expression has been recognized, so it can be
+                   evaluated */
+                if(_d_synsem_evaluate(context, $1,
+                                      &(context->synsem->cacheable_program),
+                                      &value) != 0) {
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
                 }
+
+                context->synsem->has_cacheable_program = 1;
+                context->synsem->cacheable_echo = 1;
+                context->synsem->cacheable_root = $1;
+
+                /* Always shows the value of the expression */
+                _d_synsem_report_value(context, &value, 1);
             }
 
     |   /* A mathematical expression + ';' + '\n'. */
         expression  D_LC_SEPARATOR_SEMICOL 
             {
-                /* ';' disables the echo */
+                struct d_dec_number value;
+
+                /* ';' disables the echo, but the expression still needs to
+                   be evaluated */
+                if(_d_synsem_evaluate(context, $1,
+                                      &(context->synsem->cacheable_program),
+                                      &value) != 0) {
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
+                }
+
+                context->synsem->has_cacheable_program = 1;
+                context->synsem->cacheable_echo = 0;
+                context->synsem->cacheable_root = $1;
+
+                _d_synsem_report_value(context, &value, 0);
             }
 
 
@@ -306,10 +496,12 @@ sentence:
                 /* Checking if the specified command is indeed a 0-arg one */
                 if($1->attribute.command.arg_count == 0) {
 
-                    /* If so, the command gets executed; the return value is 
-                       checked just to be able to tell if the user has
-                       requested that delta exits */
-                    if($1->attribute.command.implementation.argc_0()
+                    /* If so, the command gets executed (unless a notebook is
+                       being compiled); the return value is checked just to be
+                       able to tell if the user has requested that delta
+                       exits */
+                    if(context->synsem->writer == NULL &&
+                       $1->attribute.command.implementation.argc_0(context)
                        == D_COMMAND_QUIT_REQUEST) {
 
                         return 0;
@@ -317,7 +509,7 @@ sentence:
                 }
 
                 else {
-                    d_errors_parse_show(4,
+                    d_errors_parse_show(context, 4,
                                         D_ERR_SEM_INCORRECT_ARG_COUNT,
                                         @1.last_line, @1.last_column, "1");
                 }
@@ -329,9 +521,10 @@ sentence:
                 /* Checking if the specified command is indeed a 0-arg one */
                 if($1->attribute.command.arg_count == 0) {
 
-                    /* If so, the command gets executed; the return value is checked just to be able to tell if
-                       the user has requested that delta exits */
-                    if($1->attribute.command.implementation.argc_0()
+                    /* If so, the command gets executed (unless a notebook is being compiled); the return value is
+                       checked just to be able to tell if the user has requested that delta exits */
+                    if(context->synsem->writer == NULL &&
+                       $1->attribute.command.implementation.argc_0(context)
                        == D_COMMAND_QUIT_REQUEST) {
 
                         return 0;
@@ -339,7 +532,7 @@ sentence:
                 }
 
                 else {
-                    d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_COUNT, @1.last_line, @1.last_column, "1");
+                    d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_COUNT, @1.last_line, @1.last_column, "1");
                 }
             }
 
@@ -347,14 +540,24 @@ sentence:
            It will always be an error, as commands may only take one string as argument at most. */
         D_LC_IDENTIFIER_COMMAND  D_LC_SEPARATOR_L_PARENTHESIS  expression  D_LC_SEPARATOR_R_PARENTHESIS 
             {
+                struct d_bytecode bytecode;
+                struct d_dec_number value;
+
+                /* The expression is still evaluated, just as if it had been
+                   given anywhere else */
+                if(_d_synsem_evaluate(context, $3, &bytecode, &value) != 0) {
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
+                }
+
                 /* If the command is not even supposed to take an argument */
                 if($1->attribute.command.arg_count == 0) {
-                    d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_COUNT, @3.last_line, @3.last_column, "0");
+                    d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_COUNT, @3.last_line, @3.last_column, "0");
                 }
 
                 /* Command that receives 1 argument, but a string-type one, not a mathematical expression */
                 else {
-                    d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_TYPE, @3.last_line, @3.last_column, "string");
+                    d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_TYPE, @3.last_line, @3.last_column, "string");
                 }
             }
 
@@ -363,18 +566,23 @@ sentence:
             {
                 /* Checking if the specified command is indeed a 1-arg one */
                 if($1->attribute.command.arg_count == 1) {
-                    /* The command gets executed */
-                    $1->attribute.command.implementation.argc_1($3);
+                    /* The command gets executed, unless a notebook is being
+                       compiled */
+                    if(context->synsem->writer == NULL) {
+                        $1->attribute.command.implementation.argc_1(context,
+                                                                    $3.text);
+                    }
                 }
 
                 else {
-                    d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_COUNT, @3.last_line, @3.last_column, "0");
+                    d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_COUNT, @3.last_line, @3.last_column, "0");
                 }
             }
     ;
 
 
-/* Mathematical expressions. They are always represented by a base 10 number.
+/* Mathematical expressions. They are always represented by an AST, whose
+   value is a base 10 number.
    
    The last rule in this subsection allows generic error recovery from syntax
    errors.
@@ -385,44 +593,83 @@ expression:
 
         /* A base 10 integer. */
         D_LC_LITERAL_INT
-        /* Its value is implicitely copied to the recognized expression */
+            {
+                if(($$ = d_ast_new_literal(&(context->synsem->ast_arena),
+                                           &($1), @$.last_line,
+                                           @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     |   /* A base 10 floating point number. */
         D_LC_LITERAL_FP
-        /* Its value is implicitely copied to the recognized expression */
+            {
+                if(($$ = d_ast_new_literal(&(context->synsem->ast_arena),
+                                           &($1), @$.last_line,
+                                           @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
 
     /* ═══ Constants & variables, assignments ═══ */
 
     |   /* A predefined constant. */
         D_LC_IDENTIFIER_CONSTANT
-            /* Its value gets directly set as the one of the recognized
-               expression */
-            { $$ = $1->attribute.dec_number; }
+            /* Its value will be read when evaluating the expression */
+            {
+                if(($$ = d_ast_new_identifier(&(context->synsem->ast_arena),
+                                              D_AST_CONSTANT, $1, @$.last_line,
+                                              @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     |   /* A base 10 variable. */
         D_LC_IDENTIFIER_VARIABLE
-            /* Its value gets directly set as the one of the recognized
-               expression */
-            { $$ = $1->attribute.dec_number; }
+            /* Its value will be read when evaluating the expression */
+            {
+                if(($$ = d_ast_new_identifier(&(context->synsem->ast_arena),
+                                              D_AST_VARIABLE, $1, @$.last_line,
+                                              @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     
     |   /* Assigning an expression to a variable. */
         D_LC_IDENTIFIER_VARIABLE  D_LC_OP_ASSIGNMENT_ASSIGN  expression
+            /* The expression's value will be set as the variable's one, and
+               also as the value of the recognized expression */
             {
-                /* The expression's value is set as the variable's one */
-                $1->attribute.dec_number = $3;
-                /* And it is also set as the value of the recognized
-                   expression */
-                $$ = $3;
+                if(($$ = d_ast_new_unary(&(context->synsem->ast_arena),
+                                         D_AST_ASSIGNMENT, $1, $3,
+                                         @$.last_line, @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
             }
 
     |   /* Assigning an expression to a constant.
            This is not allowed. */
         D_LC_IDENTIFIER_CONSTANT  D_LC_OP_ASSIGNMENT_ASSIGN  expression
             {
-                d_errors_parse_show(3, D_ERR_SYN_WRITE_CONSTANT, @1.last_line,
-                                    @1.last_column);
+                struct d_bytecode bytecode;
+                struct d_dec_number value;
+
+                /* The assigned expression is still evaluated, just as if it
+                   had been given anywhere else */
+                if(_d_synsem_evaluate(context, $3, &bytecode, &value) != 0) {
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
+                }
+
+                d_errors_parse_show(context, 3, D_ERR_SYN_WRITE_CONSTANT,
+                                    @1.last_line, @1.last_column);
                 /* Raises the error to discard the whole input line */
                 YYERROR;
             }
@@ -434,8 +681,8 @@ expression:
            This is an error as math functions take exactly one argument. */
         D_LC_IDENTIFIER_FUNCTION  D_LC_SEPARATOR_L_PARENTHESIS  D_LC_SEPARATOR_R_PARENTHESIS
             {
-                d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_COUNT, @3.last_line,
-                                    @3.last_column, "1");
+                d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_COUNT,
+                                    @3.last_line, @3.last_column, "1");
                 /* Raises the error to discard the whole input line */
                 YYERROR;
             }
@@ -444,18 +691,22 @@ expression:
            This is an error as math functions take exactly a "double" argument. */
         D_LC_IDENTIFIER_FUNCTION  D_LC_SEPARATOR_L_PARENTHESIS  D_LC_LITERAL_STR  D_LC_SEPARATOR_R_PARENTHESIS
             {
-                d_errors_parse_show(4, D_ERR_SEM_INCORRECT_ARG_TYPE, @3.last_line, @3.last_column, "double");
+                d_errors_parse_show(context, 4, D_ERR_SEM_INCORRECT_ARG_TYPE, @3.last_line, @3.last_column, "double");
                 /* Raises the error to discard the whole input line */
                 YYERROR;
             }
 
     |   /* Calling a mathematical function with one expression as argument. */
     D_LC_IDENTIFIER_FUNCTION  D_LC_SEPARATOR_L_PARENTHESIS  expression  D_LC_SEPARATOR_R_PARENTHESIS
+        /* The function will be executed when evaluating the expression, and
+           its result will be set as the recognized expression's one */
         {
-            /* The function gets executed and its result is set as the recognized expression's
-                one; math functions always return "double" (floating) values */
-            $$.values.floating = $1->attribute.function(d_dec_numbers_get_floating_value(&($3)));
-            $$.is_floating = 1;
+            if(($$ = d_ast_new_unary(&(context->synsem->ast_arena),
+                                     D_AST_FUNCTION_CALL, $1, $3, @$.last_line,
+                                     @$.last_column))
+               == NULL) {
+                YYABORT;
+            }
         }
 
 
@@ -463,78 +714,163 @@ expression:
 
     |   /* Adding two expressions. */
         expression  D_LC_OP_ARITHMETIC_PLUS  expression
-            /* The value of the recognized expression is computed through an
-               auxiliar function */
-            { $$ =  d_dec_numbers_compute_operation('+', &($1), &($3)); }
+            /* The value of the recognized expression will be computed
+               when evaluating it */
+            {
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '+', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     |   /* Subtracting two expressions. */
         expression  D_LC_OP_ARITHMETIC_MINUS  expression
-            /* The value of the recognized expression is computed through an
-               auxiliar function */
-            { $$ =  d_dec_numbers_compute_operation('-', &($1), &($3)); }
+            /* The value of the recognized expression will be computed
+               when evaluating it */
+            {
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '-', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     |   /* Multiplying two expressions. */
         expression  D_LC_OP_ARITHMETIC_TIMES  expression
-            /* The value of the recognized expression is computed through an
-               auxiliar function */
-            { $$ =  d_dec_numbers_compute_operation('*', &($1), &($3)); }
+            /* The value of the recognized expression will be computed
+               when evaluating it */
+            {
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '*', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
     |   /* Dividing two expressions. */
         expression  D_LC_OP_ARITHMETIC_DIV  expression
+            /* The value of the recognized expression will be computed
+               when evaluating it; that is also when a division by 0 will be
+               caught */
             {
-                if(d_dec_numbers_get_floating_value(&($3)) != 0.0) {
-
-                    /* The value of the recognized expression is computed
-                       through an auxiliar function */
-                    $$ =  d_dec_numbers_compute_operation('/', &($1), &($3));
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '/', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
                 }
-
-                else {
-                    d_errors_parse_show(3, D_ERR_SEM_DIVISION_BY_ZERO,
-                                        @3.last_line, @3.last_column);
-                    /* Raises the error to discard the whole input line */
-                    YYERROR;
-                }   
             }
 
     |   /* Modulus between two expressions. */
         expression  D_LC_OP_ARITHMETIC_MOD  expression
+            /* The value of the recognized expression will be computed
+               when evaluating it; that is also when a division by 0 will be
+               caught */
             {
-                if(d_dec_numbers_get_floating_value(&($3)) != 0.0) {
-
-                    /* The value of the recognized expression is computed
-                       through an auxiliar function */
-                    $$ =  d_dec_numbers_compute_operation('%', &($1), &($3));
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '%', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
                 }
-
-                else {
-                    d_errors_parse_show(3, D_ERR_SEM_DIVISION_BY_ZERO,
-                                        @3.last_line, @3.last_column);
-                    /* Raises the error to discard the whole input line */
-                    YYERROR;
-                }   
             }
 
     |   /* Exponentiation using two expressions. */
         expression  D_LC_OP_ARITHMETIC_EXPONENT  expression
-            /* The value of the recognized expression is computed through an
-               auxiliar function */
-            { $$ =  d_dec_numbers_compute_operation('^', &($1), &($3)); }
+            /* The value of the recognized expression will be computed
+               when evaluating it */
+            {
+                if(($$ = d_ast_new_operation(&(context->synsem->ast_arena),
+                                             '^', $1, $3, @$.last_line,
+                                             @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
 
     |   /* Negating a expression. */
         D_LC_OP_ARITHMETIC_MINUS  expression  %prec  D_LC_OP_ARITHMETIC_NEG
             /* The "%prec" attribute specifies a special rule precedence */
-            { $$ = d_dec_numbers_get_negated_value(&($2)); }
+            {
+                if(($$ = d_ast_new_negation(&(context->synsem->ast_arena), $2,
+                                            @$.last_line, @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
 
 
     /* ═══ Parentheses usage ═══ */
 
     |   /* A expression between parentheses. */
         D_LC_SEPARATOR_L_PARENTHESIS  expression  D_LC_SEPARATOR_R_PARENTHESIS
-            /* Its value gets directly set as the one of the recognized
-               expression */
-            { $$ = $2; }
+            /* Its tree gets directly set as the one of the recognized
+               expression, although it now ends at the right parenthesis */
+            {
+                $$ = $2;
+                $$->line = @$.last_line;
+                $$->column = @$.last_column;
+            }
+
+
+    /* ═══ Arrays ═══ */
+
+    |   /* A list of expressions between brackets. */
+        D_LC_SEPARATOR_L_BRACKET  elements  D_LC_SEPARATOR_R_BRACKET
+            /* The array will be built out of their values when evaluating
+               the expression; it now ends at the right bracket */
+            {
+                $$ = $2;
+                $$->line = @$.last_line;
+                $$->column = @$.last_column;
+            }
+    ;
+
+
+elements:
+        /* The first element of an array. */
+        expression
+            {
+                /* Arrays hold single numbers only */
+                if($1->value_type == D_AST_VALUE_ARRAY) {
+
+                    d_errors_parse_show(context, 3, D_ERR_SEM_ARRAY_NESTED,
+                                        @1.last_line, @1.last_column);
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
+                }
+
+                if(($$ = d_ast_new_array(&(context->synsem->ast_arena), $1,
+                                         @$.last_line, @$.last_column))
+                   == NULL) {
+                    YYABORT;
+                }
+            }
+
+    |   /* Any other element, after a comma. */
+        elements  D_LC_SEPARATOR_COMMA  expression
+            {
+                /* Arrays hold single numbers only */
+                if($3->value_type == D_AST_VALUE_ARRAY) {
+
+                    d_errors_parse_show(context, 3, D_ERR_SEM_ARRAY_NESTED,
+                                        @3.last_line, @3.last_column);
+                    /* Raises the error to discard the whole input line */
+                    YYERROR;
+                }
+
+                if(d_ast_add_element(&(context->synsem->ast_arena), $1, $3)
+                   != 0) {
+                    YYABORT;
+                }
+
+                $$ = $1;
+            }
     ;
 
 
@@ -547,15 +883,50 @@ expression:
  * @brief Implementation of synsem.h/d_synsem_analyzer_initialize
  */
 int d_synsem_analyzer_initialize(
-    void
+    struct d_context *context
 )
 {
+    struct d_synsem_state *state = NULL;
+
+
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "synsem.y", "d_synsem_analyzer_initialize",
+                               "'context'");
+        return -1;
+    }
+
+
+    if((state = malloc(sizeof(struct d_synsem_state))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "synsem.y", "d_synsem_analyzer_initialize",
+                               "'malloc' for the state");
+        return -1;
+    }
+
     // Flags get set to a false state
-    d_synsem_load_file = 0;
-    d_synsem_load_file_path = NULL;
+    state->has_cacheable_program = 0;
+    state->cacheable_echo = 0;
+    state->cacheable_root = NULL;
+    state->writer = NULL;
+    state->line_start_errors = context->error_count;
+
+    // ASTs will be allocated from their own arena
+    if(d_arena_initialize(&(state->ast_arena), D_ARENA_DEFAULT_BLOCK_SIZE)
+       != 0) {
+
+        free(state);
+        return -1;
+    }
+
+    context->synsem = state;
 
     // And shows the user the initial tip
-    d_help_show_topic_help(D_HELP_INTRO);
+    if(context->mode == D_CONTEXT_MODE_INTERACTIVE) {
+        d_help_show_topic_help(D_HELP_INTRO);
+    }
 
 
     return 0;
@@ -566,14 +937,45 @@ int d_synsem_analyzer_initialize(
  * @brief Implementation of synsem.h/d_synsem_analyzer_parse
  */
 int d_synsem_analyzer_parse(
-    void
+    struct d_context *context
 )
 {
     // Shows the promtp and starts the parsing process
-    printf(D_SYNSEM_PROMPT);
+    _d_synsem_show_prompt(context);
 
 
-    return yyparse();
+    return yyparse(context);
+}
+
+
+/**
+ * @brief Implementation of synsem.h/d_synsem_analyzer_compile
+ */
+int d_synsem_analyzer_compile(
+    struct d_context *context,
+    struct d_notebook_writer *writer
+)
+{
+    int result = 0;
+
+
+    if(context == NULL || context->synsem == NULL || writer == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "synsem.y", "d_synsem_analyzer_compile",
+                               "'context->synsem' -OR- 'writer'");
+        return -1;
+    }
+
+
+    context->synsem->writer = writer;
+
+    result = yyparse(context);
+
+    context->synsem->writer = NULL;
+
+
+    return result;
 }
 
 
@@ -581,21 +983,208 @@ int d_synsem_analyzer_parse(
  * @brief Implementation of synsem.h/d_synsem_analyzer_destroy
  */
 int d_synsem_analyzer_destroy(
-    void
+    struct d_context *context
+)
+{
+    int result = 0;
+
+
+    if(context == NULL || context->synsem == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "synsem.y", "d_synsem_analyzer_destroy",
+                               "'context->synsem'");
+        return -1;
+    }
+
+
+    // Any ASTs that may be left are freed along with their arena
+    result = d_arena_destroy(&(context->synsem->ast_arena));
+
+    free(context->synsem);
+    context->synsem = NULL;
+
+
+    return result;
+}
+
+
+/**
+ * @brief Implementation of synsem.h/d_synsem_analyzer_run_cached_line
+ */
+int d_synsem_analyzer_run_cached_line(
+    struct d_context *context,
+    const char *line,
+    size_t length
+)
+{
+    struct d_cache_entry *entry = NULL;
+    struct d_dec_number value;
+
+
+    // While compiling a notebook, every line must be analyzed
+    if(context->synsem->writer != NULL ||
+       (entry = d_cache_search(context->cache, line, length)) == NULL) {
+        return 1;
+    }
+
+
+    // Just as if the line had been analyzed once again
+    if(d_cache_run(context, entry, (int) context->current_line, &value)
+       == 0) {
+
+        _d_synsem_report_value(context, &value, entry->echo);
+    }
+
+    _d_synsem_show_prompt(context);
+
+    context->synsem->line_start_errors = context->error_count;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of synsem.h/d_synsem_analyzer_run_compiled_line
+ */
+int d_synsem_analyzer_run_compiled_line(
+    struct d_context *context,
+    struct d_notebook *notebook,
+    const struct d_notebook_statement *statement
 )
 {
-    // No clean-up is needed as of now
+    struct d_bytecode bytecode;
+    struct d_dec_number value;
+    int echo = 0;
+
+
+    if(notebook == NULL || statement->program == NULL ||
+       d_notebook_resolve(notebook, statement, context->symbol_table,
+                          &bytecode, &echo) != 0) {
+        return 1;
+    }
+
+
+    // Just as if the line had been analyzed
+    if(d_vm_execute(context, &bytecode, (int) context->current_line, &value)
+       == 0) {
+
+        _d_synsem_report_value(context, &value, echo);
+    }
+
+    _d_synsem_show_prompt(context);
+
+    context->synsem->line_start_errors = context->error_count;
 
 
     return 0;
 }
 
 
+/**
+ * @brief Implementation of synsem.y/_d_synsem_evaluate
+ */
+int _d_synsem_evaluate(
+    struct d_context *context,
+    struct d_ast_node *root,
+    struct d_bytecode *bytecode,
+    struct d_dec_number *value
+)
+{
+    struct d_arena *arena = &(context->synsem->ast_arena);
+
+
+    if(d_optimizer_optimize(root, arena) != 0) {
+        return -1;
+    }
+
+    // The program will be freed alongside the AST that it comes from
+    if(d_bytecode_compile(root, arena, bytecode) != 0) {
+        return -1;
+    }
+
+    // Lines of notebooks that are being compiled are not run
+    if(context->synsem->writer != NULL) {
+
+        value->is_floating = 0;
+        value->is_array = 0;
+        value->values.integer = 0;
+
+        return 0;
+    }
+
+
+    return d_vm_execute(context, bytecode, root->line, value);
+}
+
+
+/**
+ * @brief Implementation of synsem.y/_d_synsem_report_value
+ */
+void _d_synsem_report_value(
+    struct d_context *context,
+    const struct d_dec_number *value,
+    int echo
+)
+{
+    // The indentation, the number and its '\n'
+    char text[3 + D_DEC_FORMAT_MAX_ELEMENT_LENGTH + 1] = "   ";
+    size_t length = 0;
+    size_t i = 0;
+
+
+    context->last_value = *value;
+    context->has_last_value = 1;
+
+    if(!echo || context->mode == D_CONTEXT_MODE_EMBEDDED) {
+        return;
+    }
+
+
+    if(!value->is_array) {
+        length = 3 + d_dec_format_number(value, text + 3);
+        text[length++] = '\n';
+
+        fwrite(text, 1, length, stdout);
+        return;
+    }
+
+    // Arrays are written one element at a time, as they may be of any
+    // length
+    fwrite(text, 1, 3, stdout);
+
+    for(i = 0; i < value->values.array->length; ++i) {
+        length = d_dec_format_element(value, i, text);
+        fwrite(text, 1, length, stdout);
+    }
+
+    putchar('\n');
+}
+
+
+/**
+ * @brief Implementation of synsem.y/_d_synsem_show_prompt
+ */
+void _d_synsem_show_prompt(
+    struct d_context *context
+)
+{
+    if(context->is_stdin && context->mode == D_CONTEXT_MODE_INTERACTIVE) {
+        printf(D_SYNSEM_PROMPT);
+    }
+}
+
+
 /**
  * @brief Implementation of synsem.y/yyerror 
  */
-void yyerror(char const *msg)
+void yyerror(
+    YYLTYPE *location,
+    struct d_context *context,
+    char const *msg
+)
 {
-    d_errors_parse_show(3, D_ERR_SYN, d_lex_current_line,
-                        d_lex_current_column);
+    d_errors_parse_show(context, 3, D_ERR_SYN, context->current_line,
+                        context->current_column);
 }
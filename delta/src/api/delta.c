@@ -0,0 +1,287 @@
+/**
+ * @file delta.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of api/delta.h
+ */
+
+
+#include "api/delta.h"
+
+#include "analyzers/lexical.h"
+#include "analyzers/synsem.h"
+#include "common/errors.h"
+#include "common/lexical_comp.h"
+#include "common/symbol_table.h"
+#include "math/dec_arrays.h"
+
+
+// isalpha, isalnum
+#include <ctype.h>
+#include <stdlib.h>
+
+
+/**
+ * @brief Checks if the given name is a valid identifier.
+ *
+ * @details
+ *  Just as the lexical analyzer, identifiers start with a letter or '_', and
+ *  are followed by zero or more letters, digits or '_'.
+ *
+ * @param[in] name '\0' terminated name.
+ *
+ * @return 1 if it is valid, 0 otherwise.
+ */
+int _d_api_is_identifier(
+    const char *name
+);
+
+
+/**
+ * @brief Implementation of delta.h/d_ctx_new
+ */
+struct d_context *d_ctx_new(
+    void
+)
+{
+    struct d_context *context = NULL;
+
+
+    if((context = malloc(sizeof(struct d_context))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "delta.c",
+                               "d_ctx_new", "'malloc' for the context");
+        return NULL;
+    }
+
+    if(d_context_initialize(context, D_CONTEXT_MODE_EMBEDDED) != 0) {
+
+        free(context);
+        return NULL;
+    }
+
+
+    return context;
+}
+
+
+/**
+ * @brief Implementation of delta.h/d_ctx_eval
+ */
+int d_ctx_eval(
+    struct d_context *context,
+    const char *text,
+    size_t length,
+    struct d_dec_number *result
+)
+{
+    size_t previous_errors = 0;
+    int parse_result = 0;
+
+
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_eval", "'context'");
+        return -1;
+    }
+
+    if(result == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_eval", "'result'");
+        return -1;
+    }
+
+
+    previous_errors = context->error_count;
+    context->has_last_value = 0;
+
+    // The statements are read as a text, which ends the parsing process once
+    // it has been read
+    if(d_lexical_analyzer_new_string(context, text, length) != 0) {
+        return -1;
+    }
+
+    parse_result = d_synsem_analyzer_parse(context);
+
+    // A "quit" stops the parsing process before the whole text (and any
+    // notebooks that it loads) have been read
+    while(!context->is_stdin) {
+
+        if(d_lexical_analyzer_pop_file(context) != 0) {
+            return -1;
+        }
+    }
+
+
+    if(parse_result != 0 || context->error_count != previous_errors) {
+        return -1;
+    }
+
+    if(!context->has_last_value) {
+        return 1;
+    }
+
+    *result = context->last_value;
+
+    // Any array is kept from being freed until the caller releases it
+    d_dec_arrays_hold(result);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of delta.h/d_ctx_set_var
+ */
+int d_ctx_set_var(
+    struct d_context *context,
+    const char *name,
+    const struct d_dec_number *value
+)
+{
+    struct d_symbol_table_entry entry;
+    struct d_symbol_table_entry *entry_in_table = NULL;
+
+
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_set_var", "'context'");
+        return -1;
+    }
+
+    if(name == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_set_var", "'name'");
+        return -1;
+    }
+
+    if(value == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_set_var", "'value'");
+        return -1;
+    }
+
+    // Otherwise, the variable could never be read
+    if(!_d_api_is_identifier(name)) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID, "delta.c",
+                               "d_ctx_set_var", "'name' is not a valid "
+                               "identifier");
+        return -1;
+    }
+
+
+    entry_in_table = d_symbol_table_search(context->symbol_table, name);
+
+    if(entry_in_table == NULL) {
+
+        // The variable gets declared, just as the lexical analyzer does
+        entry.lexeme = name;
+        entry.lexical_component = D_LC_IDENTIFIER_VARIABLE;
+        entry.attribute.dec_number = *value;
+
+
+        return d_symbol_table_add(context->symbol_table, &entry);
+    }
+
+    if(entry_in_table->lexical_component != D_LC_IDENTIFIER_VARIABLE) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID, "delta.c",
+                               "d_ctx_set_var", "'name' is not a variable");
+        return -1;
+    }
+
+    // Cached programs read variables from their slots when they are run, so
+    // they do not need to be invalidated
+    *d_symbol_table_get_variable(context->symbol_table, entry_in_table) =
+                                                                      *value;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of delta.h/d_ctx_release
+ */
+int d_ctx_release(
+    struct d_context *context,
+    const struct d_dec_number *value
+)
+{
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_release", "'context'");
+        return -1;
+    }
+
+    if(value == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_release", "'value'");
+        return -1;
+    }
+
+
+    d_dec_arrays_release(value);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of delta.h/d_ctx_free
+ */
+int d_ctx_free(
+    struct d_context *context
+)
+{
+    int result = 0;
+
+
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "delta.c",
+                               "d_ctx_free", "'context'");
+        return -1;
+    }
+
+
+    result = d_context_destroy(context);
+    free(context);
+
+
+    return result;
+}
+
+
+/**
+ * @brief Implementation of delta.c/_d_api_is_identifier
+ */
+int _d_api_is_identifier(
+    const char *name
+)
+{
+    if(!isalpha((unsigned char) *name) && *name != '_') {
+        return 0;
+    }
+
+    for(++name; *name != '\0'; ++name) {
+
+        if(!isalnum((unsigned char) *name) && *name != '_') {
+            return 0;
+        }
+    }
+
+
+    return 1;
+}
@@ -0,0 +1,262 @@
+/**
+ * @file arena.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of common/arena.h
+ */
+
+
+#include "common/arena.h"
+
+#include "common/errors.h"
+
+
+#include <stdlib.h>
+// memcpy
+#include <string.h>
+
+
+/**
+ * @brief Returns a block of the given arena in which the given amount of
+ *        bytes fits, requesting a new one if needed.
+ *
+ * @param[in,out] arena The arena.
+ * @param[in] size How many bytes are requested.
+ * @param[in] alignment To which alignment the next free byte of the block
+ *                      will be rounded up before handing them out.
+ *
+ * @return The block, or NULL if failed.
+ */
+struct d_arena_block *_d_arena_reserve(
+    struct d_arena *arena,
+    size_t size,
+    size_t alignment
+)
+{
+    struct d_arena_block *block = arena->current_block;
+    size_t block_size = 0;
+    size_t used = 0;
+
+
+    if(block != NULL) {
+
+        used = (block->used + alignment - 1) & ~(alignment - 1);
+
+        if(used <= block->size && block->size - used >= size) {
+            return block;
+        }
+    }
+
+
+    // A new block is needed if there is none yet, or if the current one
+    // cannot hold the requested size
+    block_size = size > arena->block_size ? size : arena->block_size;
+
+    // Some extra room is requested so that the data can be aligned right
+    // after the block's header
+    if((block = malloc(sizeof(struct d_arena_block) + block_size +
+                       D_ARENA_ALIGNMENT)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "arena.c",
+                               "_d_arena_reserve",
+                               "'malloc' for struct d_arena_block");
+        return NULL;
+    }
+
+    block->previous_block = arena->current_block;
+    block->data = (unsigned char *) (
+                      ((size_t) (block + 1) + D_ARENA_ALIGNMENT - 1) &
+                      ~((size_t) D_ARENA_ALIGNMENT - 1)
+                  );
+    block->size = block_size;
+    block->used = 0;
+
+    arena->current_block = block;
+
+
+    return block;
+}
+
+
+/**
+ * @brief Implementation of arena.h/d_arena_initialize
+ */
+int d_arena_initialize(
+    struct d_arena *arena,
+    size_t block_size
+)
+{
+    if(arena == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_initialize", "'arena'");
+        return -1;
+    }
+
+
+    arena->current_block = NULL;
+    arena->block_size = block_size > 0 ? block_size :
+                                         D_ARENA_DEFAULT_BLOCK_SIZE;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of arena.h/d_arena_allocate
+ */
+void *d_arena_allocate(
+    struct d_arena *arena,
+    size_t size
+)
+{
+    struct d_arena_block *block = NULL;
+
+    void *allocation = NULL;
+
+
+    if(arena == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_allocate", "'arena'");
+        return NULL;
+    }
+
+
+    // Every allocation keeps the next free byte aligned
+    size = (size + D_ARENA_ALIGNMENT - 1) &
+           ~((size_t) D_ARENA_ALIGNMENT - 1);
+
+    if((block = _d_arena_reserve(arena, size, D_ARENA_ALIGNMENT)) == NULL) {
+        return NULL;
+    }
+
+    // Strings may have left the next free byte unaligned
+    block->used = (block->used + D_ARENA_ALIGNMENT - 1) &
+                  ~((size_t) D_ARENA_ALIGNMENT - 1);
+
+    allocation = block->data + block->used;
+    block->used += size;
+
+
+    return allocation;
+}
+
+
+/**
+ * @brief Implementation of arena.h/d_arena_copy_string
+ */
+char *d_arena_copy_string(
+    struct d_arena *arena,
+    const char *string,
+    size_t length
+)
+{
+    struct d_arena_block *block = NULL;
+
+    char *copy = NULL;
+
+
+    if(arena == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_copy_string", "'arena'");
+        return NULL;
+    }
+
+    if(string == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_copy_string", "'string'");
+        return NULL;
+    }
+
+
+    // Strings are packed one after another, as they need no alignment
+    if((block = _d_arena_reserve(arena, length + 1, 1)) == NULL) {
+        return NULL;
+    }
+
+    copy = (char *) (block->data + block->used);
+    memcpy(copy, string, length);
+    copy[length] = '\0';
+
+    block->used += length + 1;
+
+
+    return copy;
+}
+
+
+/**
+ * @brief Implementation of arena.h/d_arena_reset
+ */
+int d_arena_reset(
+    struct d_arena *arena
+)
+{
+    struct d_arena_block *current_block = NULL;
+    struct d_arena_block *previous_block = NULL;
+
+
+    if(arena == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_reset", "'arena'");
+        return -1;
+    }
+
+
+    if(arena->current_block == NULL) {
+        return 0;
+    }
+
+    // Only the most recent block is kept, as it is the one that will be
+    // reused
+    current_block = arena->current_block->previous_block;
+
+    while(current_block != NULL) {
+
+        previous_block = current_block->previous_block;
+        free(current_block);
+        current_block = previous_block;
+    }
+
+    arena->current_block->previous_block = NULL;
+    arena->current_block->used = 0;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of arena.h/d_arena_destroy
+ */
+int d_arena_destroy(
+    struct d_arena *arena
+)
+{
+    struct d_arena_block *previous_block = NULL;
+
+
+    if(arena == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "arena.c",
+                               "d_arena_destroy", "'arena'");
+        return -1;
+    }
+
+
+    while(arena->current_block != NULL) {
+
+        previous_block = arena->current_block->previous_block;
+        free(arena->current_block);
+        arena->current_block = previous_block;
+    }
+
+
+    return 0;
+}
@@ -7,15 +7,28 @@
  */
 
 
+// strdup
+#define _POSIX_C_SOURCE 200809L
+
+
 #include "common/commands.h"
 
 #include "common/lexical_comp.h"
 #include "common/symbol_table.h"
 
+#include "interpreter/cache.h"
+#include "interpreter/jit.h"
+#include "interpreter/notebook.h"
+
 #include "lib/uthash.h"
 
+#include "math/dec_format.h"
+
 
 #include <stdio.h>
+#include <stdlib.h>
+// strcmp
+#include <string.h>
 // For dynamic library loading
 #include <dlfcn.h>
 
@@ -27,9 +40,9 @@
  * @details
  *  Delta will rely on a hash table to keep track of each dynamic library that
  *  has been loaded. In order to do so, this structure represents an entry in
- *  that table.
+ *  that table, which each context keeps on its own.
  */
-struct _d_commands_table_entry {
+struct d_commands_library {
 
     /** '\0' terminated string which is the given path through which the
         library has been found and loaded. */
@@ -40,15 +53,6 @@ struct _d_commands_table_entry {
     UT_hash_handle hh;
 };
 
-/** The library requires the hash table to be a pointer to its entry
-    type, initialized to NULL. */
-struct _d_commands_table_entry *_d_commands_table = NULL;
-
-/**
- * The last selected library.
- */
-struct _d_commands_table_entry *_last_library = NULL;
-
 
 /**
  * @brief Clears the current workspace.
@@ -57,13 +61,23 @@ struct _d_commands_table_entry *_last_library = NULL;
  *  Clears the current workspace; that is, all registered variables are
  *  deleted.
  * 
+ * @param[in,out] context The context.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int _d_commands_clear_workspace(
-    void
+    struct d_context *context
 )
 {
-    int result = d_symbol_table_delete(D_LC_IDENTIFIER_VARIABLE);
+    int result = 0;
+
+
+    // Cached programs may reference the variables that are about to be
+    // deleted
+    d_cache_clear(context->cache);
+
+    result = d_symbol_table_delete(context->symbol_table,
+                                   D_LC_IDENTIFIER_VARIABLE);
 
     if(result == 0) {
         printf("   Workspace successfully cleared\n");
@@ -82,14 +96,23 @@ int _d_commands_clear_workspace(
  *  Opens a file which contains statements written in the delta's language.
  *  They are all executed as they are read.
  *
+ * @param[in,out] context The context.
  * @param[in] filename Relative or absolute path to the file.
  *
  * @return 0 if sucessful, any other value otherwise.
  */
 int _d_commands_load_file(
+    struct d_context *context,
     const char *filename
 )
 {
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_load_file",
+                               "\"load\"");
+        return -1;
+    }
+
     if(filename == NULL) {
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
                                "commands.c", "_d_commands_load_file",
@@ -103,9 +126,62 @@ int _d_commands_load_file(
     #endif
 
     // Tells the syntactic & semantic analyzer to load the file when it is
-    // ready
-    d_synsem_load_file = 1;
-    d_synsem_load_file_path = filename;
+    // ready. The path is copied, as the given one only lives as long as the
+    // current sentence
+    free(context->load_file_path);
+
+    if((context->load_file_path = strdup(filename)) == NULL) {
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "commands.c", "_d_commands_load_file",
+                               "'strdup' of given path");
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Compiles a file which contains statements written in the delta's
+ *        language.
+ *
+ * @details
+ *  The file is analyzed, but not run, and the programs of its lines are
+ *  written next to it (see interpreter/notebook.h), so that loading the
+ *  compiled file skips analyzing them.
+ *
+ * @param[in,out] context The context.
+ * @param[in] filename Relative or absolute path to the file, which must end
+ *                     with ".delta".
+ *
+ * @return 0 if sucessful, any other value otherwise.
+ */
+int _d_commands_compile_file(
+    struct d_context *context,
+    const char *filename
+)
+{
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_compile_file",
+                               "\"compile\"");
+        return -1;
+    }
+
+    if(filename == NULL) {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "commands.c", "_d_commands_compile_file",
+                               "'filename'");
+        return -1;
+    }
+
+
+    if(d_notebook_compile(filename) != 0) {
+        return -1;
+    }
+
+    printf("   File successfully compiled\n");
 
 
     return 0;
@@ -121,6 +197,7 @@ int _d_commands_load_file(
  *  library. The function must follow the "math_functions/d_dec_function"
  *  prototype.
  * 
+ * @param[in,out] context The context.
  * @param[in] function Name by which the function can be identified. A
  *                     function that goes by the same name must not be present
  *                     yet in the symbol table.
@@ -128,6 +205,7 @@ int _d_commands_load_file(
  * @return 0 if sucessful, any other value otherwise.
  */
 int _d_commands_load_function(
+    struct d_context *context,
     const char *function
 )
 {
@@ -135,7 +213,14 @@ int _d_commands_load_function(
     void *loaded_object = NULL;
 
 
-    if(_d_commands_table == NULL) {
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_load_function",
+                               "\"import\"");
+        return -1;
+    }
+
+    if(context->libraries == NULL) {
 
         d_errors_internal_show(3, D_ERR_USER_IO_NO_DYN_LIBRARY_SELECTED,
                                "commands.c", "_d_commands_load_function");
@@ -161,10 +246,11 @@ int _d_commands_load_function(
 
 
     // If the function has not been loaded yet
-    if((entry_in_table = d_symbol_table_search(function)) == NULL) {
+    if((entry_in_table = d_symbol_table_search(context->symbol_table,
+                                                 function)) == NULL) {
 
         // If the library is not already loaded, there we go
-        if((loaded_object = dlsym(_last_library->library, function))
+        if((loaded_object = dlsym(context->last_library->library, function))
            == NULL) {
 
             d_errors_internal_show(3, D_ERR_USER_IO_FUNCTION_INACCESSIBLE,
@@ -177,7 +263,7 @@ int _d_commands_load_function(
         }
 
         // Now the library can be added to the symbol table
-        d_symbol_table_add_math_function(function,
+        d_symbol_table_add_math_function(context->symbol_table, function,
                                          (d_dec_function)loaded_object);
 
         #ifdef D_DEBUG
@@ -218,17 +304,26 @@ int _d_commands_load_function(
  *  Searches for a dynamic library and loads it, if it is not yet, while also
  *  setting it as the selected opened dynamic library. 
  * 
+ * @param[in,out] context The context.
  * @param[in] path Relative or absolute path to the library.
  *
  * @return 0 if sucessful, any other value otherwise.
  */
 int _d_commands_load_library(
+    struct d_context *context,
     const char *path
 )
 {
-    struct _d_commands_table_entry entry;
-    struct _d_commands_table_entry *entry_in_table = NULL;
+    struct d_commands_library entry;
+    struct d_commands_library *entry_in_table = NULL;
+
 
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_load_library",
+                               "\"from\"");
+        return -1;
+    }
 
     if(path == NULL) {
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
@@ -253,7 +348,7 @@ int _d_commands_load_library(
 
     // In order to do so, let's check first if a corresponding entry is
     // already present
-    HASH_FIND_STR(_d_commands_table, (const char *)path, entry_in_table);
+    HASH_FIND_STR(context->libraries, (const char *)path, entry_in_table);
 
     if(entry_in_table == NULL) {
 
@@ -285,13 +380,13 @@ int _d_commands_load_library(
         // Now the library can be added to the table
         // With each new entry, a new internally-managed structure is
         // allocated
-        if((entry_in_table = malloc(sizeof(struct _d_commands_table_entry)))
+        if((entry_in_table = malloc(sizeof(struct d_commands_library)))
            == NULL) {
 
             d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
                                    "commands.c", "_d_commands_load_library",
                                    "'malloc' for struct "
-                                   "_d_commands_table_entry");
+                                   "d_commands_library");
             return -1;
         }
 
@@ -300,7 +395,7 @@ int _d_commands_load_library(
         // There is no need to copy the library's handle, it just needs to be
         // present
 
-        HASH_ADD_KEYPTR(hh, _d_commands_table, entry_in_table->path,
+        HASH_ADD_KEYPTR(hh, context->libraries, entry_in_table->path,
                         strlen((const char *)entry_in_table->path),
                         entry_in_table);
 
@@ -314,7 +409,7 @@ int _d_commands_load_library(
 
     // Anyways, the resulting entry, be it new or not, is set as the last
     // selected library
-    _last_library = entry_in_table;
+    context->last_library = entry_in_table;
 
 
     return 0;
@@ -324,10 +419,12 @@ int _d_commands_load_library(
 /**
  * @brief Shows generic help about delta.
  * 
+ * @param[in,out] context The context.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int _d_commands_show_help(
-    void
+    struct d_context *context
 )
 {
     d_help_show_topic_help(D_HELP_FEATURES_HELP);
@@ -340,11 +437,13 @@ int _d_commands_show_help(
 /**
  * @brief Shows detailed help about the specified delta section.
  * 
+ * @param[in,out] context The context.
  * @param[in] topic The section.
  *
  * @return 0 if successful, any other value otherwise.
  */
 int _d_commands_show_detailed_help(
+    struct d_context *context,
     const char *topic
 )
 {
@@ -369,63 +468,169 @@ int _d_commands_show_detailed_help(
  * @details
  *  Shows the current workspace; that is, shows the symbol table.
  * 
+ * @param[in,out] context The context.
+ *
  * @return 0 if successful, any other value otherwise.
  */
 int _d_commands_show_workspace(
-    void
+    struct d_context *context
 )
 {
-    return d_symbol_table_show();
+    return d_symbol_table_show(context->symbol_table);
 }
 
 
 /**
- * @brief Returns the "quit" numeric code so that the lexical and semantic
- *        analyzer stops parsing.
+ * @brief Shows the statistics of the compiled-expressions cache.
  *
  * @details
- *  Returns the "quit" numeric code so that the lexical and semantic analyzer
- *  stops parsing. Naturally, as delta is supposed to quit, all dynamically
- *  loaded libraries while parsing are closed.
- * 
- * @return The "quit" numeric code, -1 if failed.
+ *  Shows how many programs are in the compiled-expressions cache, and how
+ *  many times input lines have been found (hits) or not (misses) in it.
+ *
+ * @param[in,out] context The context.
+ *
+ * @return 0 if successful, any other value otherwise.
  */
-int _d_commands_quit(
-    void
+int _d_commands_show_cache(
+    struct d_context *context
 )
 {
-    struct _d_commands_table_entry *current_entry;
-    struct _d_commands_table_entry *tmp;
-
+    return d_cache_show(context->cache);
+}
 
-    if(_d_commands_table != NULL) {
 
-        HASH_ITER(hh, _d_commands_table, current_entry, tmp) {
+/**
+ * @brief Enables or disables the JIT compiler.
+ *
+ * @details
+ *  Enables or disables the compilation of hot expressions into native code,
+ *  which allows comparing its performance with the virtual machine's one.
+ *
+ * @param[in,out] context The context.
+ * @param[in] mode "on" or "off".
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_commands_set_jit(
+    struct d_context *context,
+    const char *mode
+)
+{
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_set_jit",
+                               "\"jit\"");
+        return -1;
+    }
 
-            // Closes the library and deletes its entry before proceeding to
-            // the next one
-            HASH_DEL(_d_commands_table, current_entry);
+    if(mode == NULL) {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "commands.c", "_d_commands_set_jit",
+                               "'mode'");
+        return -1;
+    }
 
-            // Closing the library implies automatically closing all loaded
-            // functions that are present in it
-            if(dlclose(current_entry->library) != 0) {
 
-                d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                                       "commands.c", "_d_commands_quit",
-                                       "'dlclose' on a dynamically loaded "
-                                       "library");
-                return -1;
-            }
+    if(strcmp(mode, "on") == 0) {
 
-            free((char *) current_entry->path);
-            free(current_entry);
+        if(!d_jit_is_supported()) {
+            printf("   The JIT compiler is not supported on this platform\n");
+            return 0;
         }
+
+        d_jit_enabled = 1;
     }
 
-    _d_commands_table = NULL;
-    _last_library = NULL;
+    else if(strcmp(mode, "off") == 0) {
+        d_jit_enabled = 0;
+    }
+
+    else {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                               "commands.c", "_d_commands_set_jit",
+                               "'mode' must be \"on\" or \"off\"");
+        return -1;
+    }
+
+    printf("   JIT compiler %s\n", d_jit_enabled ? "enabled" : "disabled");
 
 
+    return 0;
+}
+
+
+/**
+ * @brief Chooses how floating point values are shown.
+ *
+ * @details
+ *  Chooses between the fewest digits that are read back as the same value,
+ *  and the "%.15g" that older versions of delta used (see
+ *  math/dec_format.h).
+ *
+ * @param[in,out] context The context.
+ * @param[in] mode "shortest" or "compat".
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_commands_set_format(
+    struct d_context *context,
+    const char *mode
+)
+{
+    if(context->is_sandboxed) {
+        d_errors_internal_show(4, D_ERR_USER_IO_SANDBOXED,
+                               "commands.c", "_d_commands_set_format",
+                               "\"format\"");
+        return -1;
+    }
+
+    if(mode == NULL) {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "commands.c", "_d_commands_set_format",
+                               "'mode'");
+        return -1;
+    }
+
+
+    if(strcmp(mode, "shortest") == 0) {
+        d_dec_format_is_compatible = 0;
+    }
+
+    else if(strcmp(mode, "compat") == 0) {
+        d_dec_format_is_compatible = 1;
+    }
+
+    else {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                               "commands.c", "_d_commands_set_format",
+                               "'mode' must be \"shortest\" or \"compat\"");
+        return -1;
+    }
+
+    printf("   Number format set to %s\n", mode);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns the "quit" numeric code so that the lexical and semantic
+ *        analyzer stops parsing.
+ *
+ * @details
+ *  Returns the "quit" numeric code so that the lexical and semantic analyzer
+ *  stops parsing. Any dynamically loaded libraries are closed along with the
+ *  context.
+ *
+ * @param[in,out] context The context.
+ *
+ * @return The "quit" numeric code.
+ */
+int _d_commands_quit(
+    struct d_context *context
+)
+{
     return D_COMMAND_QUIT_REQUEST;
 }
 
@@ -437,7 +642,8 @@ const char *D_COMMANDS_NAMES_0[] = {
     "help",
     "quit",
     "ws",
-    "wsc"
+    "wsc",
+    "cache"
 };
 
 /** Pointers to the implementations of the no arg built-in commands. */
@@ -446,6 +652,7 @@ const comm_function_0 D_COMMANDS_IMPLEMENTATIONS_0[] = {
     &_d_commands_quit,
     &_d_commands_show_workspace,
     &_d_commands_clear_workspace,
+    &_d_commands_show_cache,
 };
 
 
@@ -457,6 +664,9 @@ const char *D_COMMANDS_NAMES_1[] = {
     "import",
     "from",
     "load",
+    "jit",
+    "compile",
+    "format",
 };
 
 /** Pointers to the implementations of the 1 arg built-in commands. */
@@ -465,4 +675,54 @@ const comm_function_1 D_COMMANDS_IMPLEMENTATIONS_1[] = {
     &_d_commands_load_function,
     &_d_commands_load_library,
     &_d_commands_load_file,
+    &_d_commands_set_jit,
+    &_d_commands_compile_file,
+    &_d_commands_set_format,
 };
+
+
+/**
+ * @brief Implementation of commands.h/d_commands_close_libraries
+ */
+int d_commands_close_libraries(
+    struct d_context *context
+)
+{
+    struct d_commands_library *current_entry;
+    struct d_commands_library *tmp;
+
+
+    if(context == NULL) {
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "commands.c", "d_commands_close_libraries",
+                               "'context'");
+        return -1;
+    }
+
+
+    HASH_ITER(hh, context->libraries, current_entry, tmp) {
+
+        // Closes the library and deletes its entry before proceeding to the
+        // next one
+        HASH_DEL(context->libraries, current_entry);
+
+        // Closing the library implies automatically closing all loaded
+        // functions that are present in it
+        if(dlclose(current_entry->library) != 0) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                   "commands.c", "d_commands_close_libraries",
+                                   "'dlclose' on a dynamically loaded "
+                                   "library");
+        }
+
+        free((char *) current_entry->path);
+        free(current_entry);
+    }
+
+    context->libraries = NULL;
+    context->last_library = NULL;
+
+
+    return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ * @file context.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of common/context.h
+ */
+
+
+#include "common/context.h"
+
+#include "analyzers/lexical.h"
+#include "analyzers/synsem.h"
+#include "common/commands.h"
+#include "common/errors.h"
+#include "common/symbol_table.h"
+#include "interpreter/cache.h"
+#include "math/dec_arrays.h"
+
+
+#include <stdlib.h>
+// memset
+#include <string.h>
+
+
+/**
+ * @brief Implementation of context.h/d_context_initialize
+ */
+int d_context_initialize(
+    struct d_context *context,
+    enum d_context_mode mode
+)
+{
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "context.c",
+                               "d_context_initialize", "'context'");
+        return -1;
+    }
+
+
+    // Everything starts empty, so that a partially initialized context can
+    // still be destroyed
+    memset(context, 0, sizeof(struct d_context));
+    context->mode = mode;
+
+    if(d_symbol_table_initialize(&(context->symbol_table)) != 0 ||
+       d_cache_initialize(&(context->cache), D_CACHE_DEFAULT_CAPACITY) != 0 ||
+       d_dec_arrays_initialize(&(context->arrays)) != 0 ||
+       d_lexical_analyzer_initialize(context) != 0 ||
+       d_synsem_analyzer_initialize(context) != 0) {
+
+        d_context_destroy(context);
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of context.h/d_context_destroy
+ */
+int d_context_destroy(
+    struct d_context *context
+)
+{
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "context.c",
+                               "d_context_destroy", "'context'");
+        return -1;
+    }
+
+
+    // The analyzers go first, as they may reference entries in the symbol
+    // table, and so do cached programs
+    if(context->synsem != NULL) {
+        d_synsem_analyzer_destroy(context);
+    }
+
+    if(context->lexical != NULL) {
+        d_lexical_analyzer_destroy(context);
+    }
+
+    if(context->cache != NULL) {
+        d_cache_destroy(context->cache);
+        context->cache = NULL;
+    }
+
+    // Values just point to arrays, so all of them are freed at once
+    if(context->arrays != NULL) {
+        d_dec_arrays_destroy(context->arrays);
+        context->arrays = NULL;
+    }
+
+    // Loaded math functions become dangling pointers once their libraries
+    // are closed, so the symbol table must not be used afterwards
+    d_commands_close_libraries(context);
+
+    if(context->symbol_table != NULL) {
+        d_symbol_table_destroy(context->symbol_table);
+        context->symbol_table = NULL;
+    }
+
+    free(context->load_file_path);
+    context->load_file_path = NULL;
+
+
+    return 0;
+}
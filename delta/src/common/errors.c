@@ -12,7 +12,7 @@
 #include "common/errors.h"
 
 // To know which file is currently begin parsed
-#include "analyzers/lexical.h"
+#include "common/context.h"
 
 
 #include <stdio.h>
@@ -20,9 +20,9 @@
 #include <string.h>
 
 
-/** Global buffer that should be plenty for any metadata. It avoids allocating
-    new memory each time that a message must be shown. */
-char _char_buffer[128];
+/** Size of the buffer that holds the metadata of a message, which should be
+    plenty for any of them. */
+#define D_ERRORS_METADATA_SIZE 128
 
 
 /**
@@ -64,6 +64,9 @@ const char *d_errors_get_template(
         case D_ERR_LEX_LITERALS_INTEGERS_BINARY_BAD:
             return "malformed binary integer number, [..]";
 
+        case D_ERR_LEX_LITERALS_INTEGERS_RANGE:
+            return "integer number out of range, [..]";
+
         case D_ERR_LEX_LITERALS_STRING_EMPTY:
             return "a string cannot be empty";
 
@@ -91,6 +94,12 @@ const char *d_errors_get_template(
         case D_ERR_SEM_INCORRECT_ARG_TYPE:
             return "incorrect argument type, expected a [..]";
 
+        case D_ERR_SEM_ARRAY_LENGTHS_DIFFER:
+            return "the arrays have different lengths, [..]";
+
+        case D_ERR_SEM_ARRAY_NESTED:
+            return "an array may not be an element of another array";
+
 
         /* Category: other user errors */
 
@@ -111,6 +120,18 @@ const char *d_errors_get_template(
         case D_ERR_USER_IO_FUNCTION_NAME_TAKEN:
             return "a [..] that goes by the same name is already loaded";
 
+        case D_ERR_USER_IO_SANDBOXED:
+            return "the [..] command is not available in a sandboxed "
+                   "interpreter";
+
+        case D_ERR_USER_IO_NOT_A_NOTEBOOK:
+            return "only notebooks whose path ends with \".delta\" may be "
+                   "compiled";
+
+        case D_ERR_USER_IO_FILE_UNWRITABLE:
+            return "the output file could not be written; check if the "
+                   "permissions of its directory allow writing to it";
+
 
         /* No match */
 
@@ -235,12 +256,14 @@ void _d_errors_show(
  * @brief Implementation of errors.h/d_errors_parse_show 
  */
 void d_errors_parse_show(
+    struct d_context *context,
     int arg_count,
     ...
 )
 {
     // List that contains all variable arguments
     va_list valist;
+    char metadata[D_ERRORS_METADATA_SIZE];
     
     int error_code = 0;
     size_t line;
@@ -261,11 +284,14 @@ void d_errors_parse_show(
     // Generating metadata about the error...
     line = va_arg(valist, size_t);
     col = va_arg(valist, size_t);
-    snprintf(_char_buffer, sizeof(_char_buffer), "%s : ln %zu : col %zu",
-             d_lex_current_file, line, col);
+    snprintf(metadata, sizeof(metadata), "%s : ln %zu : col %zu",
+             context->current_file, line, col);
 
     // Showing the whole error...
-    _d_errors_show(error_code, _char_buffer, arg_count - 3, &valist);
+    if(!context->are_errors_hidden) {
+        _d_errors_show(error_code, metadata, arg_count - 3, &valist);
+    }
+    ++(context->error_count);
 
     // Cleaning up...
     va_end(valist);
@@ -282,6 +308,7 @@ void d_errors_internal_show(
 {
     // List that contains all variable arguments
     va_list valist;
+    char metadata[D_ERRORS_METADATA_SIZE];
     
     int error_code = 0;
     char file[32];
@@ -302,11 +329,11 @@ void d_errors_internal_show(
     // Generating metadata about the error...
     strncpy(file, va_arg(valist, const char *), sizeof(file) - 1);
     strncpy(function, va_arg(valist, const char *), sizeof(function) - 1);
-    snprintf(_char_buffer, sizeof(_char_buffer), "internal file : %s : %s()",
+    snprintf(metadata, sizeof(metadata), "internal file : %s : %s()",
              file, function);
 
     // Showing the whole error...
-    _d_errors_show(error_code, _char_buffer, arg_count - 3, &valist);
+    _d_errors_show(error_code, metadata, arg_count - 3, &valist);
 
     // Cleaning up...
     va_end(valist);
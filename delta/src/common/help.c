@@ -63,7 +63,7 @@ void d_help_show_topic_help(
             printf(
                 "### Data types\n"
                 "\n"
-                "As of now, only **base-10 numbers are supported**.\n"
+                "As of now, only **base-10 numbers**, and arrays of them, **are supported**.\n"
                 "\n"
                 "-   **Integer numbers** contain one or more digits. They are represented\n"
                 "    with the `int64_t` data type.\n"
@@ -97,6 +97,23 @@ void d_help_show_topic_help(
                 "    only have 'digits' -AND- '_'\n"
                 "     --> stdin : ln 2 : col 8\n"
                 "\n"
+                "-   **Arrays** of numbers are written between brackets. All of their\n"
+                "    elements are integers, unless any of them is a floating point number.\n"
+                "    Operations and mathematical functions are applied element by element,\n"
+                "    and a single number is used with every element of an array; two\n"
+                "    arrays must have the same length. Arrays hold single numbers only,\n"
+                "    so they may not be nested.\n"
+                "\n"
+                "    >> [1, 2, 3] * 2\n"
+                "       [2, 4, 6]\n"
+                "    >> [1, 2, 3] + [0.5, 0.5, 0.5]\n"
+                "       [1.5, 2.5, 3.5]\n"
+                "    >> sqrt([4, 9])\n"
+                "       [2, 3]\n"
+                "    >> [1, 2] + [1, 2, 3]\n"
+                "    error[E4004]: the arrays have different lengths, 2 and 3\n"
+                "     --> stdin : ln 4 : col 19\n"
+                "\n"
             );
 
             break;
@@ -136,7 +153,7 @@ void d_help_show_topic_help(
                 "    >> 4 * 3\n"
                 "       12\n"
                 "    >> 2^0.5\n"
-                "       1.4142135623731\n"
+                "       1.4142135623730951\n"
                 "\n"
                 "Beware that if the result of a floating point operation has no decimal\n"
                 "digits, they will not be shown:\n"
@@ -231,9 +248,9 @@ void d_help_show_topic_help(
                 "value:\n"
                 "\n"
                 "    >> sqrt(2)\n"
-                "       1.4142135623731\n"
+                "       1.4142135623730951\n"
                 "    >> log(5.2)\n"
-                "       1.64865862558738\n"
+                "       1.6486586255873816\n"
                 "    >> exp()\n"
                 "    error[E4002]: incorrect amount of arguments, expected 1 args\n"
                 "     --> stdin : ln 23 : col 6\n"
@@ -242,7 +259,7 @@ void d_help_show_topic_help(
                 "in radians:\n"
                 "\n"
                 "    >> sin(3.14)\n"
-                "       0.00159265291648683\n"
+                "       0.0015926529164868282\n"
                 "\n"
             );
 
@@ -332,7 +349,7 @@ void d_help_show_topic_help(
                 "    >> a = 2\n"
                 "       2\n"
                 "    >> a * pi\n"
-                "       6.28318530717959\n"
+                "       6.283185307179586\n"
                 "\n"
                 "But trying to overwrite them will result in an error:\n"
                 "\n"
@@ -388,6 +405,30 @@ void d_help_show_topic_help(
                 "It is worth noting that commands that take no arguments can be called\n"
                 "with or without `()`.\n"
                 "\n"
+                "Delta also **remembers the compiled form of the mathematical\n"
+                "expressions that it has recently read**, so that any line that is\n"
+                "typed in again (or that appears again in a notebook) is run right\n"
+                "away, without having to analyze it once more. **The `cache` built-in\n"
+                "command shows how many lines have been found (*hits*) or not\n"
+                "(*misses*) in it**:\n"
+                "\n"
+                "    >> cache\n"
+                "       Compiled expressions cache:\n"
+                "          entries => 3/1024\n"
+                "          native => 1 (JIT on)\n"
+                "          hits => 40\n"
+                "          misses => 4\n"
+                "\n"
+                "Expressions that are run many times are **compiled into native x86-64\n"
+                "code**, which is then run instead of the bytecode. **The `jit()`\n"
+                "built-in command turns this on or off**, which may be useful to\n"
+                "compare both:\n"
+                "\n"
+                "    >> jit(\"off\")\n"
+                "       JIT compiler disabled\n"
+                "\n"
+                "Clearing the WorkSpace also clears this cache.\n"
+                "\n"
             );
 
             break;
@@ -454,7 +495,7 @@ void d_help_show_topic_help(
                 "    function:\n"
                 "\n"
                 "    >> radians(180)\n"
-                "       3.14159265358979\n"
+                "       3.141592653589793\n"
                 "\n"
                 "Beware that if a variable or a mathematical function that goes by the\n"
                 "same name is already defined, it will result in an error. In any case,\n"
@@ -515,7 +556,7 @@ void d_help_show_topic_help(
                 "    >> load(\"../test/notebooks/notebook_1.delta\")\n"
                 "       File successfully loaded\n"
                 "       3.14\n"
-                "       -0.743284239769269\n"
+                "       -0.7432842397692688\n"
                 "    >> ws\n"
                 "       1. Mathematical constants:\n"
                 "          e => 2.718282\n"
@@ -577,6 +618,24 @@ void d_help_show_topic_help(
                 "          [integer] hello_from_notebook_3 => 1\n"
                 "          [integer] result => 2\n"
                 "\n"
+                "Loading a Notebook spends most of its time analyzing its lines, even\n"
+                "though they are the same each time. **A Notebook can be compiled\n"
+                "beforehand using the `compile()` built-in command**, which analyzes it\n"
+                "without running it and writes the programs of its lines into a\n"
+                "`.deltac` file next to it. Loading the compiled Notebook just runs them,\n"
+                "and shows the same values and errors as loading its source:\n"
+                "\n"
+                "    >> compile(\"../test/notebooks/notebook_1.delta\")\n"
+                "       File successfully compiled\n"
+                "    >> load(\"../test/notebooks/notebook_1.deltac\")\n"
+                "       File successfully loaded\n"
+                "\n"
+                "Only the Notebooks whose name ends with `.delta` may be compiled.\n"
+                "Notebooks may also be compiled without starting the interpreter,\n"
+                "through `./delta --compile <notebook>`. A compiled Notebook whose source\n"
+                "has changed since then, or that comes from another version of Delta, is\n"
+                "ignored, and its source is loaded instead.\n"
+                "\n"
             );
 
             break;
@@ -606,6 +665,18 @@ void d_help_show_topic_help(
                 "       3. Your variables:\n"
                 "          [floating] value => 0.1411200081\n"
                 "\n"
+                "Floating point values are shown with **the fewest digits that are read\n"
+                "back as the very same value**. **The `format()` built-in command**\n"
+                "switches between this (`\"shortest\"`) and **the 15 significant digits\n"
+                "that older versions of Delta showed** (`\"compat\"`):\n"
+                "\n"
+                "    >> 0.1 + 0.2\n"
+                "       0.30000000000000004\n"
+                "    >> format(\"compat\")\n"
+                "       Number format set to compat\n"
+                "    >> 0.1 + 0.2\n"
+                "       0.3\n"
+                "\n"
             );
 
             break;
@@ -8,184 +8,967 @@
 
 #include "common/symbol_table.h"
 
+#include "common/arena.h"
 #include "common/errors.h"
 #include "common/lexical_comp.h"
 
 #include "common/commands.h"
+#include "math/dec_arrays.h"
 #include "math/math_constants.h"
 #include "math/math_functions.h"
 
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
-// strcpy, strlen
+// memset, strlen, strncmp
 #include <string.h>
 
 // To print int64_t data type
 #include <inttypes.h>
 
+// To compare the control bytes of a whole group at once
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+
+/** How many categories of entries there are (see
+    "_d_symbol_table_get_category"). */
+#define D_SYMBOL_TABLE_CATEGORY_COUNT 4
+
+/** Size in bytes of the blocks in which variables are allocated, as there
+    may be lots of them. */
+#define D_SYMBOL_TABLE_VARIABLES_BLOCK_SIZE (64 * 1024)
+
+/** How many math constants there are. */
+#define D_SYMBOL_TABLE_CONSTANT_COUNT \
+    (sizeof(D_MATH_CONSTANTS_NAMES) / sizeof(D_MATH_CONSTANTS_NAMES[0]))
+
+/** How many preloaded math functions there are. */
+#define D_SYMBOL_TABLE_FUNCTION_COUNT \
+    (sizeof(D_MATH_FUNCTIONS_NAMES) / sizeof(D_MATH_FUNCTIONS_NAMES[0]))
+
+/** How many built-in commands that take no arguments there are. */
+#define D_SYMBOL_TABLE_COMMAND_0_COUNT \
+    (sizeof(D_COMMANDS_NAMES_0) / sizeof(D_COMMANDS_NAMES_0[0]))
+
+/** How many built-in commands that take 1 argument there are. */
+#define D_SYMBOL_TABLE_COMMAND_1_COUNT \
+    (sizeof(D_COMMANDS_NAMES_1) / sizeof(D_COMMANDS_NAMES_1[0]))
+
+/** How many built-ins there are: math constants, preloaded math functions
+    and built-in commands. */
+#define D_SYMBOL_TABLE_BUILTIN_COUNT 34
+
+/** How many slots the perfect hash table of built-ins has. It must be a
+    power of 2. */
+#define D_SYMBOL_TABLE_BUILTIN_CAPACITY 128
+
+/** From which bit of its lexeme's hash the slot of a built-in is taken. */
+#define D_SYMBOL_TABLE_BUILTIN_SHIFT 52
+
+/** Slot of the perfect hash table of built-ins that holds none. */
+#define D_SYMBOL_TABLE_BUILTIN_NONE 255
+
+/** How many variables' values the table can hold at first. */
+#define D_SYMBOL_TABLE_MIN_VARIABLE_CAPACITY 64
+
+/** How many slots are probed at once. */
+#define D_SYMBOL_TABLE_GROUP_SIZE 16
+
+/** How many slots the hash table has at least. It must be a power of 2, and
+    a multiple of the group size. */
+#define D_SYMBOL_TABLE_MIN_CAPACITY 64
+
+/** Control byte of a slot that has never held an entry. Those of the slots
+    that hold one are the 7 lowest bits of their hashes, so they never match
+    it. */
+#define D_SYMBOL_TABLE_SLOT_EMPTY 0x80
+
+/** Control byte of a slot whose entry has been deleted. Just as an empty
+    slot, it has its highest bit set, so both are told apart from used slots
+    by that bit alone. */
+#define D_SYMBOL_TABLE_SLOT_DELETED 0xFE
+
+
+/**
+ * @brief Perfect hash table of the built-ins.
+ *
+ * @details
+ *  Each slot holds the index of the built-in whose lexeme's hash selects it
+ *  (see D_SYMBOL_TABLE_BUILTIN_SHIFT), or D_SYMBOL_TABLE_BUILTIN_NONE. The
+ *  built-ins are indexed in the order in which they are declared: math
+ *  constants, math functions, and built-in commands with no arguments and
+ *  with 1 argument.
+ *
+ *  No two built-ins select the same slot, so looking one up takes a single
+ *  probe. Whenever the built-ins change, the table must be generated again
+ *  (debug builds check it when a symbol table is initialized).
+ */
+const uint8_t D_SYMBOL_TABLE_BUILTIN_SLOTS[D_SYMBOL_TABLE_BUILTIN_CAPACITY] = {
+      6, 255,   9, 255,  22,  14, 255, 255,
+    255, 255, 255, 255, 255,  10, 255, 255,
+     19, 255,  23, 255, 255, 255, 255,  24,
+    255, 255,  27, 255,  12,  29,  28, 255,
+    255, 255, 255, 255,   0, 255,   8, 255,
+    255,  15, 255, 255, 255, 255,  21, 255,
+    255, 255,  17, 255, 255, 255,  25, 255,
+     30, 255, 255, 255, 255,  20, 255,  13,
+      1, 255, 255, 255, 255,   7, 255, 255,
+    255, 255,  33,   3, 255, 255, 255, 255,
+      2, 255,   4, 255, 255, 255, 255, 255,
+     26, 255, 255,  18, 255, 255, 255, 255,
+    255, 255, 255, 255,   5, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255,
+    255,  31, 255, 255, 255,  16, 255, 255,
+     32, 255, 255,  11, 255, 255, 255, 255,
+};
+
+
+/** Fails to compile if any built-ins are added or removed without
+    generating the perfect hash table again. */
+typedef char _d_symbol_table_builtin_count_check[
+    (D_SYMBOL_TABLE_CONSTANT_COUNT + D_SYMBOL_TABLE_FUNCTION_COUNT +
+     D_SYMBOL_TABLE_COMMAND_0_COUNT + D_SYMBOL_TABLE_COMMAND_1_COUNT ==
+     D_SYMBOL_TABLE_BUILTIN_COUNT) ? 1 : -1
+];
+
+
+/**
+ * @brief Holds the memory of all the entries that belong to a lexical
+ *        component category.
+ *
+ * @details
+ *  Entries and their lexemes are allocated from arenas, so that a whole
+ *  category can be freed at once by just resetting them. As all the entries
+ *  have the same size, they are laid out as arrays inside the blocks of their
+ *  arena, which allows walking them without the hash table.
+ *
+ *  Therefore, the entries arena is the index of its category: showing a
+ *  category walks its own entries, and deleting it walks them too, in order
+ *  to mark their slots of the hash table as deleted. Neither reads the
+ *  entries of the other categories.
+ */
+struct _d_symbol_table_category {
+    /** The entries. */
+    struct d_arena entries;
+    /** Pool in which the lexemes of the entries are interned: each one is
+        stored once, packed next to the others. */
+    struct d_arena lexemes;
+    /** How many entries belong to the category. */
+    size_t count;
+};
+
+
+/**
+ * @brief Represents a slot of the hash table.
+ */
+struct _d_symbol_table_slot {
+    /** The hash of the entry's lexeme, so that it does not need to be
+        computed again when the table grows, and so that most mismatches are
+        told apart without reading the lexeme. */
+    uint64_t hash;
+    /** The entry. */
+    struct d_symbol_table_entry *entry;
+};
+
 
 /**
  * @brief Represents a symbol table.
  *
  * @details
  *  Data type which represents a symbol table, composed of multiple entries.
+ *
+ *  The entries are indexed by an open-addressing hash table, which is split
+ *  into groups of D_SYMBOL_TABLE_GROUP_SIZE slots. Each slot has a control
+ *  byte, which is either D_SYMBOL_TABLE_SLOT_EMPTY or the 7 lowest bits of
+ *  its entry's hash, and all the control bytes of a group are compared at
+ *  once against the searched hash. Therefore, a search usually reads a
+ *  single group of control bytes and a single slot.
+ *
+ *  Groups are probed in triangular order, starting from the one that the
+ *  remaining bits of the hash point to, until a group with an empty slot is
+ *  found. When a category is deleted, the slots of its entries become
+ *  tombstones (D_SYMBOL_TABLE_SLOT_DELETED), which searches probe past, and
+ *  new entries may take. Tombstones count towards the load of the hash
+ *  table, so they are dropped whenever it has to be rebuilt.
+ *
+ *  Built-ins do not belong to the hash table, but to a perfect hash table
+ *  that is known at compile time, so no memory is reserved for them.
  */
 struct d_symbol_table {
-    /** The library requires the hash table to be a pointer to its entry
-        type. */
-    struct d_symbol_table_entry *table;
+    /** The entries of the built-ins, which are indexed by
+        D_SYMBOL_TABLE_BUILTIN_SLOTS instead of the hash table. */
+    struct d_symbol_table_entry builtins[D_SYMBOL_TABLE_BUILTIN_COUNT];
+
+    /** The control byte of each slot, or NULL if no entry has been added
+        yet. */
+    uint8_t *control;
+    /** The slots. */
+    struct _d_symbol_table_slot *slots;
+    /** How many slots there are. It is a power of 2. */
+    size_t capacity;
+    /** How many slots hold an entry. */
+    size_t count;
+    /** How many slots are tombstones. */
+    size_t deleted_count;
+
+    /** The memory of the entries, by lexical component category. */
+    struct _d_symbol_table_category categories[D_SYMBOL_TABLE_CATEGORY_COUNT];
+
+    /** The values of the variables, indexed by their slots. */
+    struct d_dec_number *variables;
+    /** How many variables there are. */
+    size_t variable_count;
+    /** How many variables the array can hold. */
+    size_t variable_capacity;
 };
 
 
 /**
- * @brief Globally accessible symbol table that will be used.
+ * @brief Returns the category to which the given lexical component belongs.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] lexical_component The lexical component.
+ *
+ * @return The category, or NULL if entries may not belong to the lexical
+ *         component.
  */
-struct d_symbol_table *_symbol_table = NULL;
+struct _d_symbol_table_category *_d_symbol_table_get_category(
+    struct d_symbol_table *table,
+    int lexical_component
+)
+{
+    switch(lexical_component) {
+
+        case D_LC_IDENTIFIER_VARIABLE:
+            return &(table->categories[0]);
+
+        case D_LC_IDENTIFIER_CONSTANT:
+            return &(table->categories[1]);
+
+        case D_LC_IDENTIFIER_FUNCTION:
+            return &(table->categories[2]);
+
+        case D_LC_IDENTIFIER_COMMAND:
+            return &(table->categories[3]);
+
+        default:
+            return NULL;
+    }
+}
 
 
 /**
- * @brief Implementation of symbol_table.h/d_symbol_table_initialize
+ * @brief Computes the hash of the given key.
+ *
+ * @details
+ *  FNV-1a, whose result is mixed afterwards (as MurmurHash3 does), so that
+ *  both its lowest bits (control bytes) and its remaining bits (groups)
+ *  depend on every character of the key.
+ *
+ * @param[in] key The key, which does not need to be '\0' terminated.
+ * @param[in] length The length of the key.
+ *
+ * @return The hash.
  */
-int d_symbol_table_initialize(
-    void
+uint64_t _d_symbol_table_hash(
+    const char *key,
+    size_t length
 )
 {
-    struct d_symbol_table_entry tmp_entry;
+    uint64_t hash = UINT64_C(0xcbf29ce484222325);
+    size_t i = 0;
+
+
+    for(i = 0; i < length; ++i) {
 
+        hash ^= (uint8_t) key[i];
+        hash *= UINT64_C(0x100000001b3);
+    }
+
+    hash ^= hash >> 33;
+    hash *= UINT64_C(0xff51afd7ed558ccd);
+    hash ^= hash >> 33;
+
+
+    return hash;
+}
+
+
+/**
+ * @brief Compares all the control bytes of a group against the given one.
+ *
+ * @param[in] group The control bytes of the group.
+ * @param[in] control_byte The control byte.
+ *
+ * @return Bit mask in which the i-th bit is set if the i-th slot matches.
+ */
+uint32_t _d_symbol_table_match(
+    const uint8_t *group,
+    uint8_t control_byte
+)
+{
+    #ifdef __SSE2__
+
+    __m128i control_bytes = _mm_loadu_si128((const __m128i *) group);
+
+
+    return (uint32_t) _mm_movemask_epi8(
+                          _mm_cmpeq_epi8(control_bytes,
+                                         _mm_set1_epi8((char) control_byte))
+                      );
+
+    #else
+
+    uint32_t mask = 0;
+    int i = 0;
+
+
+    for(i = 0; i < D_SYMBOL_TABLE_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) (group[i] == control_byte) << i;
+    }
+
+
+    return mask;
+
+    #endif
+}
+
+
+/**
+ * @brief Finds the slots of a group that hold no entry, whether they are
+ *        empty or tombstones.
+ *
+ * @param[in] group The control bytes of the group.
+ *
+ * @return Bit mask in which the i-th bit is set if the i-th slot is free.
+ */
+uint32_t _d_symbol_table_match_free(
+    const uint8_t *group
+)
+{
+    #ifdef __SSE2__
+
+    // Only the control bytes of free slots have their highest bit set
+    return (uint32_t) _mm_movemask_epi8(
+                          _mm_loadu_si128((const __m128i *) group)
+                      );
+
+    #else
+
+    uint32_t mask = 0;
+    int i = 0;
+
+
+    for(i = 0; i < D_SYMBOL_TABLE_GROUP_SIZE; ++i) {
+        mask |= (uint32_t) (group[i] >> 7) << i;
+    }
+
+
+    return mask;
+
+    #endif
+}
+
+
+/**
+ * @brief Puts the given entry in the first free slot of its probe sequence,
+ *        whether it is empty or a tombstone.
+ *
+ * @details
+ *  The entry must not be present yet, and there must be room for it.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] hash The hash of the entry's lexeme.
+ * @param[in] entry The entry.
+ */
+void _d_symbol_table_place(
+    struct d_symbol_table *table,
+    uint64_t hash,
+    struct d_symbol_table_entry *entry
+)
+{
+    size_t group_mask = table->capacity / D_SYMBOL_TABLE_GROUP_SIZE - 1;
+    size_t group = (hash >> 7) & group_mask;
+    size_t step = 0;
+
+    uint32_t free_slots = 0;
+    size_t slot = 0;
+
+
+    while((free_slots = _d_symbol_table_match_free(
+                            table->control + group * D_SYMBOL_TABLE_GROUP_SIZE
+                        )) == 0) {
+
+        group = (group + ++step) & group_mask;
+    }
+
+    slot = group * D_SYMBOL_TABLE_GROUP_SIZE + __builtin_ctz(free_slots);
+
+    if(table->control[slot] == D_SYMBOL_TABLE_SLOT_DELETED) {
+        --(table->deleted_count);
+    }
+
+    table->control[slot] = hash & 0x7F;
+    table->slots[slot].hash = hash;
+    table->slots[slot].entry = entry;
+
+    ++(table->count);
+}
+
+
+/**
+ * @brief Replaces the hash table by an empty one with the given capacity,
+ *        moving all of its entries to it, and dropping its tombstones.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] capacity The new capacity, which must be a power of 2, and at
+ *                     least D_SYMBOL_TABLE_MIN_CAPACITY.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_resize(
+    struct d_symbol_table *table,
+    size_t capacity
+)
+{
+    uint8_t *old_control = table->control;
+    struct _d_symbol_table_slot *old_slots = table->slots;
+    size_t old_capacity = table->capacity;
     size_t i = 0;
 
-    size_t constant_count = sizeof(D_MATH_CONSTANTS_NAMES) /
-                            sizeof(D_MATH_CONSTANTS_NAMES[0]);
 
-    // All math functions take 1 parameter
-    size_t function_count = sizeof(D_MATH_FUNCTIONS_NAMES) /
-                            sizeof(D_MATH_FUNCTIONS_NAMES[0]);
+    if((table->control = malloc(capacity)) == NULL ||
+       (table->slots = malloc(capacity * sizeof(struct _d_symbol_table_slot)))
+       == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "symbol_table.c", "_d_symbol_table_resize",
+                               "'malloc' for the hash table");
+
+        free(table->control);
+        table->control = old_control;
+        table->slots = old_slots;
+        return -1;
+    }
+
+    memset(table->control, D_SYMBOL_TABLE_SLOT_EMPTY, capacity);
+    table->capacity = capacity;
+    table->count = 0;
+    table->deleted_count = 0;
+
+
+    // The stored hashes are reused
+    for(i = 0; i < old_capacity; ++i) {
+
+        if(!(old_control[i] & 0x80)) {
+            _d_symbol_table_place(table, old_slots[i].hash,
+                                  old_slots[i].entry);
+        }
+    }
+
+    free(old_control);
+    free(old_slots);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Computes how many slots the hash table needs to hold the given
+ *        amount of entries.
+ *
+ * @param[in] count The amount of entries.
+ *
+ * @return The capacity, a power of 2 no lower than
+ *         D_SYMBOL_TABLE_MIN_CAPACITY.
+ */
+size_t _d_symbol_table_get_capacity(
+    size_t count
+)
+{
+    size_t capacity = D_SYMBOL_TABLE_MIN_CAPACITY;
+
+
+    // At most 7/8 of the slots are used, so that probe sequences are short,
+    // and so that they always reach an empty slot
+    while(count * 8 > capacity * 7) {
+        capacity *= 2;
+    }
+
+
+    return capacity;
+}
+
+
+/**
+ * @brief Rebuilds the hash table if there is no room for another entry.
+ *
+ * @details
+ *  Tombstones take room as well, so the hash table may be rebuilt with the
+ *  same capacity, or even a lower one, if enough of them are dropped.
+ *
+ * @param[in,out] table The symbol table.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_reserve(
+    struct d_symbol_table *table
+)
+{
+    // Which also allocates the hash table for the first entry
+    if(_d_symbol_table_get_capacity(table->count + table->deleted_count + 1)
+       > table->capacity) {
+
+        return _d_symbol_table_resize(
+                   table, _d_symbol_table_get_capacity(table->count + 1)
+               );
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Makes the array of variables' values grow if there is no room for
+ *        another variable.
+ *
+ * @param[in,out] table The symbol table.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_reserve_variable(
+    struct d_symbol_table *table
+)
+{
+    struct d_dec_number *new_variables = NULL;
+    size_t new_capacity = 0;
 
-    // There are built-in commands that take no parameters, and there those
-    // that take 1 parameter
-    size_t command_count = sizeof(D_COMMANDS_NAMES_0) /
-                           sizeof(D_COMMANDS_NAMES_0[0]);
-    size_t command_count_1 = sizeof(D_COMMANDS_NAMES_1) /
-                             sizeof(D_COMMANDS_NAMES_1[0]);
 
+    if(table->variable_count < table->variable_capacity) {
+        return 0;
+    }
 
 
-    // The structure that represents the symbol table gets initialized, as
-    // well as all its only member, which must point to NULL in order for the
-    // library to properly work
+    new_capacity = table->variable_capacity == 0 ?
+                       D_SYMBOL_TABLE_MIN_VARIABLE_CAPACITY :
+                       table->variable_capacity * 2;
 
-    if((_symbol_table = malloc(sizeof(struct d_symbol_table))) == NULL) {
+    if((new_variables = realloc(table->variables,
+                                new_capacity * sizeof(struct d_dec_number)))
+       == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                               "symbol_table.c", "d_symbol_table_initialize",
-                               "'malloc' for struct d_symbol_table");
+                               "symbol_table.c",
+                               "_d_symbol_table_reserve_variable",
+                               "'realloc' for the variables");
+        return -1;
+    }
+
+    table->variables = new_variables;
+    table->variable_capacity = new_capacity;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Adds the given entry, which already belongs to the symbol table,
+ *        to its hash table.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] entry The entry, whose lexeme must not be present yet.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_index(
+    struct d_symbol_table *table,
+    struct d_symbol_table_entry *entry
+)
+{
+    if(_d_symbol_table_reserve(table) != 0) {
         return -1;
     }
 
-    _symbol_table->table = NULL;
+    _d_symbol_table_place(table,
+                          _d_symbol_table_hash(entry->lexeme,
+                                               strlen(entry->lexeme)),
+                          entry);
+
 
+    return 0;
+}
 
-    // TODO It would be nice to not replicate all the code lines in the
-    // following loops. A generic function could iterate a given array's
-    // values, create the entries, store the lexemes, and set the specified
-    // lex. component category. Meanwhile, a specialized function would be
-    // called for each entry that spawns from the array, to fill up the
-    // entry's attributes that are expected.
 
-    for(i = 0; i < constant_count; ++i) {
+/**
+ * @brief Turns the slot of the given entry into a tombstone.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] entry The entry, which must be present in the hash table.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_unindex(
+    struct d_symbol_table *table,
+    struct d_symbol_table_entry *entry
+)
+{
+    uint64_t hash = _d_symbol_table_hash(entry->lexeme,
+                                         strlen(entry->lexeme));
+    uint8_t control_byte = hash & 0x7F;
 
-        if((tmp_entry.lexeme = strdup(D_MATH_CONSTANTS_NAMES[i])) == NULL) {
+    size_t group_mask = table->capacity / D_SYMBOL_TABLE_GROUP_SIZE - 1;
+    size_t group = (hash >> 7) & group_mask;
+    size_t step = 0;
 
-            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                                   "symbol_table.c",
-                                   "d_symbol_table_initialize",
-                                   "'strdup' on math constant's lexeme");
+    const uint8_t *control = NULL;
+    uint32_t candidates = 0;
+    size_t slot = 0;
+
+
+    while(1) {
+
+        control = table->control + group * D_SYMBOL_TABLE_GROUP_SIZE;
+        candidates = _d_symbol_table_match(control, control_byte);
+
+        // The very same entry is looked for, so lexemes are not compared
+        while(candidates != 0) {
+
+            slot = group * D_SYMBOL_TABLE_GROUP_SIZE +
+                   __builtin_ctz(candidates);
+
+            if(table->slots[slot].entry == entry) {
+
+                table->control[slot] = D_SYMBOL_TABLE_SLOT_DELETED;
+                --(table->count);
+                ++(table->deleted_count);
+                return 0;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        if(_d_symbol_table_match(control, D_SYMBOL_TABLE_SLOT_EMPTY) != 0) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "symbol_table.c",
+                                   "_d_symbol_table_unindex",
+                                   "the entry is not in the hash table");
             return -1;
         }
 
-        tmp_entry.lexical_component = D_LC_IDENTIFIER_CONSTANT;
+        group = (group + ++step) & group_mask;
+    }
+}
 
-        // They are all floating point numbers
-        tmp_entry.attribute.dec_number.values.floating =
-                                                   D_MATH_CONSTANTS_VALUES[i];
-        tmp_entry.attribute.dec_number.is_floating = 1;
 
-        d_symbol_table_add(&tmp_entry);
+/**
+ * @brief Shows the given math constant's entry.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] entry The entry.
+ *
+ * @return 0.
+ */
+int _d_symbol_table_show_constant(
+    struct d_symbol_table *table,
+    struct d_symbol_table_entry *entry
+)
+{
+    printf("      %s => %f\n", entry->lexeme,
+           entry->attribute.dec_number.values.floating);
 
-        #ifdef D_DEBUG
-        printf("[symbol_table][initialize] Added constant: %s %f\n",
-               tmp_entry.lexeme,
-               tmp_entry.attribute.dec_number.values.floating);
-        #endif
-    }
 
+    return 0;
+}
 
-    for(i = 0; i < function_count; ++i) {
 
-        d_symbol_table_add_math_function(D_MATH_FUNCTIONS_NAMES[i],
-                                         D_MATH_FUNCTIONS_IMPLEMENTATIONS[i]);
+/**
+ * @brief Shows the given math function's entry.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] entry The entry.
+ *
+ * @return 0.
+ */
+int _d_symbol_table_show_function(
+    struct d_symbol_table *table,
+    struct d_symbol_table_entry *entry
+)
+{
+    printf("      %s\n", entry->lexeme);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Shows the given variable's entry.
+ *
+ * @param[in] table The symbol table.
+ * @param[in] entry The entry.
+ *
+ * @return 0.
+ */
+int _d_symbol_table_show_variable(
+    struct d_symbol_table *table,
+    struct d_symbol_table_entry *entry
+)
+{
+    struct d_dec_number *value =
+        &(table->variables[entry->attribute.variable_slot]);
+
 
-        #ifdef D_DEBUG
-        printf("[symbol_table][initialize] Added function: %s %p\n",
-               tmp_entry.lexeme, D_MATH_FUNCTIONS_IMPLEMENTATIONS[i]);
-        #endif
+    // Arrays may be of any length, so just their lengths are shown
+    if(value->is_array) {
+        printf("      [%s array] %s => %zu elements\n",
+               value->is_floating ? "floating" : "integer", entry->lexeme,
+               value->values.array->length);
     }
 
+    else if(value->is_floating) {
+        printf("      [%s] %s => %.10g\n", "floating", entry->lexeme,
+               value->values.floating);
+    }
 
-    for(i = 0; i < command_count; ++i) {
+    else {
+        printf("      [%s] %s => %" PRId64 "\n", "integer", entry->lexeme,
+               value->values.integer);
+    }
 
-        if((tmp_entry.lexeme = strdup(D_COMMANDS_NAMES_0[i])) == NULL) {
 
-            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                                   "symbol_table.c",
-                                   "d_symbol_table_initialize",
-                                   "'strdup' on 0 arg command's lexeme");
+    return 0;
+}
+
+
+/**
+ * @brief Calls the given function on each built-in of the given lexical
+ *        component, in the order in which they are declared.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] lexical_component The lexical component.
+ * @param[in] visit The function, which returns 0 if successful.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_walk_builtins(
+    struct d_symbol_table *table,
+    int lexical_component,
+    int (*visit)(struct d_symbol_table *, struct d_symbol_table_entry *)
+)
+{
+    size_t i = 0;
+
+
+    for(i = 0; i < D_SYMBOL_TABLE_BUILTIN_COUNT; ++i) {
+
+        if(table->builtins[i].lexical_component == lexical_component &&
+           visit(table, &(table->builtins[i])) != 0) {
             return -1;
         }
+    }
 
-        tmp_entry.lexical_component = D_LC_IDENTIFIER_COMMAND;
 
-        tmp_entry.attribute.command.implementation.argc_0 =
-                                              D_COMMANDS_IMPLEMENTATIONS_0[i];
-        tmp_entry.attribute.command.arg_count = 0;
+    return 0;
+}
+
+
+/**
+ * @brief Calls the given function on each entry of the given category, in
+ *        the same order in which they were added.
+ *
+ * @details
+ *  Blocks are chained from the most recent one to the oldest one, so they
+ *  are gathered first, in order to walk them the other way round.
+ *
+ * @param[in,out] table The symbol table.
+ * @param[in] category The category.
+ * @param[in] visit The function, which returns 0 if successful.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_symbol_table_walk(
+    struct d_symbol_table *table,
+    struct _d_symbol_table_category *category,
+    int (*visit)(struct d_symbol_table *, struct d_symbol_table_entry *)
+)
+{
+    // Entries are rounded up just as the arena does
+    size_t entry_size = (sizeof(struct d_symbol_table_entry) +
+                         D_ARENA_ALIGNMENT - 1) &
+                        ~((size_t) D_ARENA_ALIGNMENT - 1);
+    size_t offset = 0;
+
+    struct d_arena_block *block = NULL;
+    struct d_arena_block **blocks = NULL;
+    size_t block_count = 0;
+    size_t i = 0;
 
-        d_symbol_table_add(&tmp_entry);
+    int result = 0;
 
-        #ifdef D_DEBUG
-        printf("[symbol_table][initialize] Added 0 arg command: %s %p %p\n",
-               tmp_entry.lexeme, D_COMMANDS_IMPLEMENTATIONS_0[i],
-               tmp_entry.attribute.command.implementation.argc_0);
-        #endif
+
+    if(category->count == 0) {
+        return 0;
     }
 
+    for(block = category->entries.current_block; block != NULL;
+        block = block->previous_block) {
+        ++block_count;
+    }
 
-    for(i = 0; i < command_count_1; ++i) {
+    if(block_count == 0) {
+        return 0;
+    }
 
-        if((tmp_entry.lexeme = strdup(D_COMMANDS_NAMES_1[i])) == NULL) {
+    if((blocks = malloc(block_count * sizeof(struct d_arena_block *)))
+       == NULL) {
 
-            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                                   "symbol_table.c",
-                                   "d_symbol_table_initialize",
-                                   "'strdup' on 1 arg command's lexeme");
-            return -1;
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "symbol_table.c", "_d_symbol_table_walk",
+                               "'malloc' for the blocks");
+        return -1;
+    }
+
+    i = block_count;
+
+    for(block = category->entries.current_block; block != NULL;
+        block = block->previous_block) {
+        blocks[--i] = block;
+    }
+
+
+    for(i = 0; i < block_count && result == 0; ++i) {
+
+        for(offset = 0; offset + entry_size <= blocks[i]->used &&
+                        result == 0; offset += entry_size) {
+
+            result = visit(table,
+                           (struct d_symbol_table_entry *)
+                               (blocks[i]->data + offset));
         }
+    }
+
+    free(blocks);
+
+
+    return result;
+}
+
+
+/**
+ * @brief Implementation of symbol_table.h/d_symbol_table_initialize
+ */
+int d_symbol_table_initialize(
+    struct d_symbol_table **table
+)
+{
+    struct _d_symbol_table_category *variables = NULL;
+    struct d_symbol_table_entry *builtin = NULL;
+
+    size_t i = 0;
+
 
-        tmp_entry.lexical_component = D_LC_IDENTIFIER_COMMAND;
+    if(table == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "symbol_table.c", "d_symbol_table_initialize",
+                               "'table'");
+        return -1;
+    }
+
+
+    // The structure that represents the symbol table gets initialized; its
+    // hash table is not allocated until the first entry is added
+
+    if((*table = calloc(1, sizeof(struct d_symbol_table))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "symbol_table.c", "d_symbol_table_initialize",
+                               "'calloc' for struct d_symbol_table");
+        return -1;
+    }
+
+    for(i = 0; i < D_SYMBOL_TABLE_CATEGORY_COUNT; ++i) {
+
+        d_arena_initialize(&((*table)->categories[i].entries), 0);
+        d_arena_initialize(&((*table)->categories[i].lexemes), 0);
+    }
 
-        tmp_entry.attribute.command.implementation.argc_1 =
+    // Variables get bigger blocks, as there may be lots of them
+    variables = _d_symbol_table_get_category(*table,
+                                             D_LC_IDENTIFIER_VARIABLE);
+    d_arena_initialize(&(variables->entries),
+                       D_SYMBOL_TABLE_VARIABLES_BLOCK_SIZE);
+    d_arena_initialize(&(variables->lexemes),
+                       D_SYMBOL_TABLE_VARIABLES_BLOCK_SIZE);
+
+
+    // Built-ins are neither allocated nor indexed: their entries are just
+    // filled in, in the order that D_SYMBOL_TABLE_BUILTIN_SLOTS expects, and
+    // their lexemes are the names themselves
+    builtin = (*table)->builtins;
+
+    for(i = 0; i < D_SYMBOL_TABLE_CONSTANT_COUNT; ++i, ++builtin) {
+
+        builtin->lexeme = D_MATH_CONSTANTS_NAMES[i];
+        builtin->lexical_component = D_LC_IDENTIFIER_CONSTANT;
+
+        // They are all floating point numbers
+        builtin->attribute.dec_number.values.floating =
+                                                   D_MATH_CONSTANTS_VALUES[i];
+        builtin->attribute.dec_number.is_floating = 1;
+        builtin->attribute.dec_number.is_array = 0;
+    }
+
+    for(i = 0; i < D_SYMBOL_TABLE_FUNCTION_COUNT; ++i, ++builtin) {
+
+        builtin->lexeme = D_MATH_FUNCTIONS_NAMES[i];
+        builtin->lexical_component = D_LC_IDENTIFIER_FUNCTION;
+        builtin->attribute.function = D_MATH_FUNCTIONS_IMPLEMENTATIONS[i];
+    }
+
+    for(i = 0; i < D_SYMBOL_TABLE_COMMAND_0_COUNT; ++i, ++builtin) {
+
+        builtin->lexeme = D_COMMANDS_NAMES_0[i];
+        builtin->lexical_component = D_LC_IDENTIFIER_COMMAND;
+        builtin->attribute.command.implementation.argc_0 =
+                                              D_COMMANDS_IMPLEMENTATIONS_0[i];
+        builtin->attribute.command.arg_count = 0;
+    }
+
+    for(i = 0; i < D_SYMBOL_TABLE_COMMAND_1_COUNT; ++i, ++builtin) {
+
+        builtin->lexeme = D_COMMANDS_NAMES_1[i];
+        builtin->lexical_component = D_LC_IDENTIFIER_COMMAND;
+        builtin->attribute.command.implementation.argc_1 =
                                               D_COMMANDS_IMPLEMENTATIONS_1[i];
-        tmp_entry.attribute.command.arg_count = 1;
+        builtin->attribute.command.arg_count = 1;
+    }
+
+
+    #ifdef D_DEBUG
+    // The perfect hash table must be generated again whenever the built-ins
+    // change
+    for(i = 0; i < D_SYMBOL_TABLE_BUILTIN_COUNT; ++i) {
 
-        d_symbol_table_add(&tmp_entry);
+        if(d_symbol_table_search(*table, (*table)->builtins[i].lexeme) !=
+           &((*table)->builtins[i])) {
 
-        #ifdef D_DEBUG
-        printf("[symbol_table][initialize] Added 1 arg command: %s %p %p\n",
-               tmp_entry.lexeme, D_COMMANDS_IMPLEMENTATIONS_1[i],
-               tmp_entry.attribute.command.implementation.argc_1);
-        #endif
+            d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "symbol_table.c",
+                                   "d_symbol_table_initialize",
+                                   "the built-ins' perfect hash table is "
+                                   "outdated");
+            d_symbol_table_destroy(*table);
+            return -1;
+        }
     }
+    #endif
 
 
     return 0;
@@ -196,34 +979,111 @@ int d_symbol_table_initialize(
  * @brief Implementation of symbol_table.h/d_symbol_table_search
  */
 struct d_symbol_table_entry *d_symbol_table_search(
+    struct d_symbol_table *table,
     const char* key
 )
 {
-    struct d_symbol_table_entry *entry = NULL;
+    if(key == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "symbol_table.c", "d_symbol_table_search",
+                               "'key'");
+        return NULL;
+    }
+
+
+    return d_symbol_table_search_lexeme(table, key, strlen(key));
+}
+
+
+/**
+ * @brief Implementation of symbol_table.h/d_symbol_table_search_lexeme
+ */
+struct d_symbol_table_entry *d_symbol_table_search_lexeme(
+    struct d_symbol_table *table,
+    const char *lexeme,
+    size_t length
+)
+{
+    uint64_t hash = 0;
+    uint8_t control_byte = 0;
+    uint8_t builtin = 0;
+
+    size_t group_mask = 0;
+    size_t group = 0;
+    size_t step = 0;
+
+    const uint8_t *control = NULL;
+    uint32_t candidates = 0;
+    struct _d_symbol_table_slot *slot = NULL;
 
 
-    if(_symbol_table == NULL) {
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
-                               "symbol_table.c", "d_symbol_table_search",
-                               "'_symbol_table'");
+                               "symbol_table.c", "d_symbol_table_search_lexeme",
+                               "'table'");
         return NULL;
     }
 
-    if(key == NULL) {
+    if(lexeme == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
-                               "symbol_table.c", "d_symbol_table_search",
-                               "'key'");
+                               "symbol_table.c",
+                               "d_symbol_table_search_lexeme", "'lexeme'");
+        return NULL;
+    }
+
+    hash = _d_symbol_table_hash(lexeme, length);
+
+    // Built-ins are checked first, which takes a single probe
+    builtin = D_SYMBOL_TABLE_BUILTIN_SLOTS[(hash >>
+                                            D_SYMBOL_TABLE_BUILTIN_SHIFT) &
+                                           (D_SYMBOL_TABLE_BUILTIN_CAPACITY -
+                                            1)];
+
+    if(builtin != D_SYMBOL_TABLE_BUILTIN_NONE &&
+       strncmp(table->builtins[builtin].lexeme, lexeme, length) == 0 &&
+       table->builtins[builtin].lexeme[length] == '\0') {
+        return &(table->builtins[builtin]);
+    }
+
+    if(table->capacity == 0) {
         return NULL;
     }
 
+    group_mask = table->capacity / D_SYMBOL_TABLE_GROUP_SIZE - 1;
+    control_byte = hash & 0x7F;
+    group = (hash >> 7) & group_mask;
 
-    // Returns NULL if no corresponding entry is found
-    HASH_FIND_STR(_symbol_table->table, (const char *)key, entry);
+    while(1) {
 
+        control = table->control + group * D_SYMBOL_TABLE_GROUP_SIZE;
+        candidates = _d_symbol_table_match(control, control_byte);
+
+        while(candidates != 0) {
+
+            slot = table->slots + group * D_SYMBOL_TABLE_GROUP_SIZE +
+                   __builtin_ctz(candidates);
+
+            // The stored lexemes are '\0' terminated, so the comparison
+            // stops at a shorter one, and a longer one does not match
+            if(slot->hash == hash &&
+               strncmp(slot->entry->lexeme, lexeme, length) == 0 &&
+               slot->entry->lexeme[length] == '\0') {
+                return slot->entry;
+            }
+
+            candidates &= candidates - 1;
+        }
+
+        // The entry would have been placed in this group's empty slot
+        if(_d_symbol_table_match(control, D_SYMBOL_TABLE_SLOT_EMPTY) != 0) {
+            return NULL;
+        }
 
-    return entry;
+        group = (group + ++step) & group_mask;
+    }
 }
 
 
@@ -231,17 +1091,21 @@ struct d_symbol_table_entry *d_symbol_table_search(
  * @brief Implementation of symbol_table.h/d_symbol_table_add
  */
 int d_symbol_table_add(
+    struct d_symbol_table *table,
     struct d_symbol_table_entry *entry
 )
 {
     struct d_symbol_table_entry *internal_entry;
+    struct _d_symbol_table_category *category = NULL;
+    size_t lexeme_length = 0;
+    char *lexeme = NULL;
 
 
-    if(_symbol_table == NULL) {
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
                                "symbol_table.c", "d_symbol_table_add",
-                               "'_symbol_table'");
+                               "'table'");
         return -1;
     }
 
@@ -257,7 +1121,7 @@ int d_symbol_table_add(
     #ifdef D_DEBUG
     // Should already be checked from the caller
     // No entry with the same key can be already present in the table
-    if(d_symbol_table_search(entry->lexeme) != NULL) {
+    if(d_symbol_table_search(table, entry->lexeme) != NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "symbol_table.c",
                                "d_symbol_table_add", "key already present");
@@ -265,27 +1129,55 @@ int d_symbol_table_add(
     }
     #endif
 
-    // With each new entry, a new internally-managed structure is allocated
-    if((internal_entry = malloc(sizeof(struct d_symbol_table_entry))) ==
-       NULL) {
+    if((category = _d_symbol_table_get_category(table,
+                                                entry->lexical_component))
+       == NULL) {
 
-        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
                                "symbol_table.c", "d_symbol_table_add",
-                                "'malloc' for struct d_symbol_table_entry");
+                               "'entry' has an unexpected lexical component");
+        return -1;
+    }
+
+    // The hash table and the variables' values grow beforehand, so that
+    // entries are never left in the arenas without being indexed
+    if(_d_symbol_table_reserve(table) != 0 ||
+       (entry->lexical_component == D_LC_IDENTIFIER_VARIABLE &&
+        _d_symbol_table_reserve_variable(table) != 0)) {
+        return -1;
+    }
+
+    // With each new entry, a new internally-managed structure is allocated
+    // from the arena of its category, and its lexeme is interned in the pool
+    // of its category
+    lexeme_length = strlen(entry->lexeme);
+
+    if((internal_entry = d_arena_allocate(&(category->entries),
+                                          sizeof(struct d_symbol_table_entry)))
+       == NULL ||
+       (lexeme = d_arena_copy_string(&(category->lexemes), entry->lexeme,
+                                     lexeme_length)) == NULL) {
         return -1;
     }
 
     // The new struture just copies value by value the given struct's members
-    internal_entry->lexeme = entry->lexeme;
+    internal_entry->lexeme = lexeme;
     internal_entry->lexical_component = entry->lexical_component;
     internal_entry->attribute = entry->attribute;
-    // There is no need to copy the library's handle, it just needs to be
-    // present
+    ++(category->count);
+
+    // Except for variables, whose initial values are moved to a new slot
+    if(entry->lexical_component == D_LC_IDENTIFIER_VARIABLE) {
+
+        table->variables[table->variable_count] =
+                                                entry->attribute.dec_number;
+        internal_entry->attribute.variable_slot = table->variable_count++;
+    }
+
 
     // As previously said, the "lexeme" member is used as the key
-    HASH_ADD_KEYPTR(hh, _symbol_table->table, internal_entry->lexeme,
-                    strlen((const char *)internal_entry->lexeme),
-                    internal_entry);
+    _d_symbol_table_place(table, _d_symbol_table_hash(lexeme, lexeme_length),
+                          internal_entry);
 
 
     return 0;
@@ -296,6 +1188,7 @@ int d_symbol_table_add(
  * @brief Implementation of symbol_table.h/d_symbol_table_add_math_function
  */
 int d_symbol_table_add_math_function(
+    struct d_symbol_table *table,
     const char *function_name,
     d_dec_function function_implementation
 )
@@ -303,12 +1196,12 @@ int d_symbol_table_add_math_function(
     struct d_symbol_table_entry internal_entry;
 
 
-    if(_symbol_table == NULL) {
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
                                "symbol_table.c",
                                "d_symbol_table_add_math_function",
-                               "'_symbol_table'");
+                               "'table'");
         return -1;
     }
 
@@ -323,97 +1216,131 @@ int d_symbol_table_add_math_function(
 
 
     // The function's name is its lexeme
-    if((internal_entry.lexeme = strdup(function_name)) == NULL) {
-
-        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
-                                "symbol_table.c",
-                                "d_symbol_table_add_math_function",
-                                "'strdup' on 1 math function's lexeme");
-        return -1;
-    }
-
+    internal_entry.lexeme = function_name;
     internal_entry.lexical_component = D_LC_IDENTIFIER_FUNCTION;
 
     internal_entry.attribute.function = function_implementation;
 
 
-    return d_symbol_table_add(&internal_entry);
+    return d_symbol_table_add(table, &internal_entry);
 }
 
 
 /**
- * @brief Implementation of symbol_table.h/d_symbol_table_show
+ * @brief Implementation of symbol_table.h/d_symbol_table_get_variables
  */
-int d_symbol_table_show(
-    void
+struct d_dec_number *d_symbol_table_get_variables(
+    struct d_symbol_table *table
 )
 {
-    struct d_symbol_table_entry *current_entry;
-    struct d_symbol_table_entry *tmp;
+    if(table == NULL) {
 
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "symbol_table.c",
+                               "d_symbol_table_get_variables", "'table'");
+        return NULL;
+    }
+
+
+    return table->variables;
+}
 
-    if(_symbol_table == NULL) {
+
+/**
+ * @brief Implementation of symbol_table.h/d_symbol_table_get_variable_count
+ */
+size_t d_symbol_table_get_variable_count(
+    const struct d_symbol_table *table
+)
+{
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
-                               "symbol_table.c", "d_symbol_table_show",
-                               "'_symbol_table'");
-        return -1;
+                               "symbol_table.c",
+                               "d_symbol_table_get_variable_count",
+                               "'table'");
+        return 0;
     }
 
 
-    // TODO This is not the most efficient way of showing the symbol table, as
-    // it needs to iterate it as many times as categories will be shown. It
-    // has been done this way just to quickly avoid mixing-up the categories'
-    // entries, but it would need to be rewritten in order to be efficient for
-    // larger use-cases
-
-    printf("   1. Mathematical constants:\n");
+    return table->variable_count;
+}
 
-    // This iteration procedure is directly taken from the library's
-    // reference
-    HASH_ITER(hh, _symbol_table->table, current_entry, tmp) {   
 
-        if(current_entry->lexical_component == D_LC_IDENTIFIER_CONSTANT) {
+/**
+ * @brief Implementation of symbol_table.h/d_symbol_table_get_variable
+ */
+struct d_dec_number *d_symbol_table_get_variable(
+    struct d_symbol_table *table,
+    const struct d_symbol_table_entry *entry
+)
+{
+    if(table == NULL || entry == NULL) {
 
-            printf("      %s => %f\n", current_entry->lexeme,
-                   current_entry->attribute.dec_number.values.floating);
-        }
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "symbol_table.c",
+                               "d_symbol_table_get_variable",
+                               "'table' or 'entry'");
+        return NULL;
     }
 
 
-    printf("   2. Loaded mathematical functions:\n");
+    return &(table->variables[entry->attribute.variable_slot]);
+}
 
-    HASH_ITER(hh, _symbol_table->table, current_entry, tmp) {   
 
-        if(current_entry->lexical_component == D_LC_IDENTIFIER_FUNCTION) {
+/**
+ * @brief Implementation of symbol_table.h/d_symbol_table_show
+ */
+int d_symbol_table_show(
+    struct d_symbol_table *table
+)
+{
+    if(table == NULL) {
 
-            printf("      %s\n", current_entry->lexeme);
-        }
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
+                               "symbol_table.c", "d_symbol_table_show",
+                               "'table'");
+        return -1;
     }
 
 
-    printf("   3. Your variables:\n");
+    // Each category is walked on its own, in the order in which its entries
+    // were added, after its built-ins
 
-    HASH_ITER(hh, _symbol_table->table, current_entry, tmp) {   
+    printf("   1. Mathematical constants:\n");
 
-        if(current_entry->lexical_component == D_LC_IDENTIFIER_VARIABLE) {
+    if(_d_symbol_table_walk_builtins(table, D_LC_IDENTIFIER_CONSTANT,
+                                     &_d_symbol_table_show_constant) != 0 ||
+       _d_symbol_table_walk(table,
+                            _d_symbol_table_get_category(
+                                table, D_LC_IDENTIFIER_CONSTANT
+                            ),
+                            &_d_symbol_table_show_constant) != 0) {
+        return -1;
+    }
 
-            if(current_entry->attribute.dec_number.is_floating) {
-                printf("      [%s] %s => %.10g\n", "floating",
-                       current_entry->lexeme,
-                       current_entry->attribute.dec_number.values.floating);
-            }
 
-            else {
-                printf("      [%s] %s => %" PRId64 "\n", "integer",
-                       current_entry->lexeme,
-                       current_entry->attribute.dec_number.values.integer);
-            }
-        }
+    printf("   2. Loaded mathematical functions:\n");
+
+    if(_d_symbol_table_walk_builtins(table, D_LC_IDENTIFIER_FUNCTION,
+                                     &_d_symbol_table_show_function) != 0 ||
+       _d_symbol_table_walk(table,
+                            _d_symbol_table_get_category(
+                                table, D_LC_IDENTIFIER_FUNCTION
+                            ),
+                            &_d_symbol_table_show_function) != 0) {
+        return -1;
     }
 
 
-    return 0;
+    printf("   3. Your variables:\n");
+
+    return _d_symbol_table_walk(table,
+                                _d_symbol_table_get_category(
+                                    table, D_LC_IDENTIFIER_VARIABLE
+                                ),
+                                &_d_symbol_table_show_variable);
 }
 
 
@@ -421,36 +1348,89 @@ int d_symbol_table_show(
  * @brief Implementation of symbol_table.h/d_symbol_table_delete
  */
 int d_symbol_table_delete(
+    struct d_symbol_table *table,
     int lexical_component
 )
 {
-    struct d_symbol_table_entry *current_entry;
-    struct d_symbol_table_entry *tmp;
+    struct _d_symbol_table_category *deleted_category = NULL;
+    size_t kept_count = 0;
+    size_t i = 0;
 
 
-    if(_symbol_table == NULL) {
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
                                "symbol_table.c", "d_symbol_table_delete",
-                               "'_symbol_table'");
+                               "'table'");
         return -1;
     }
 
-    
-    // This iteration procedure is directly taken from the library's reference
-    HASH_ITER(hh, _symbol_table->table, current_entry, tmp) {
+    if((deleted_category = _d_symbol_table_get_category(table,
+                                                        lexical_component))
+       == NULL) {
+
+        // No entry may belong to it
+        return 0;
+    }
+
+
+    if(deleted_category->count == 0) {
+        return 0;
+    }
+
 
-        // Deletes the entry, if applicable
-        if(current_entry->lexical_component == lexical_component) {
+    kept_count = table->count - deleted_category->count;
 
-            HASH_DEL(_symbol_table->table, current_entry);
+    // Either the slots of the deleted entries become tombstones, or the hash
+    // table is rebuilt from the entries that are kept, whichever has fewer
+    // entries to visit. Both walk the arenas of the categories, so the cost
+    // never exceeds the size of the deleted category
+    if(deleted_category->count <= kept_count) {
 
-            // Each internally-managed entry must be properly freed
-            free((char *) current_entry->lexeme);
-            free(current_entry);
+        if(_d_symbol_table_walk(table, deleted_category,
+                                &_d_symbol_table_unindex) != 0) {
+            return -1;
         }
     }
 
+    else {
+
+        // As it is known how many entries are kept, the new hash table is
+        // sized for them right away
+        free(table->control);
+        free(table->slots);
+        table->control = NULL;
+        table->slots = NULL;
+        table->capacity = 0;
+        table->count = 0;
+        table->deleted_count = 0;
+
+        if(kept_count > 0 &&
+           _d_symbol_table_resize(table,
+                                  _d_symbol_table_get_capacity(kept_count))
+           != 0) {
+            return -1;
+        }
+
+        for(i = 0; i < D_SYMBOL_TABLE_CATEGORY_COUNT; ++i) {
+
+            if(&(table->categories[i]) != deleted_category &&
+               _d_symbol_table_walk(table, &(table->categories[i]),
+                                    &_d_symbol_table_index) != 0) {
+                return -1;
+            }
+        }
+    }
+
+    d_arena_reset(&(deleted_category->entries));
+    d_arena_reset(&(deleted_category->lexemes));
+    deleted_category->count = 0;
+
+    // Slots are handed out again from the first one, keeping the memory
+    if(lexical_component == D_LC_IDENTIFIER_VARIABLE) {
+        table->variable_count = 0;
+    }
+
 
     return 0;
 }
@@ -460,36 +1440,36 @@ int d_symbol_table_delete(
  * @brief Implementation of symbol_table.h/d_symbol_table_destroy
  */
 int d_symbol_table_destroy(
-    void
+    struct d_symbol_table *table
 )
 {
-    struct d_symbol_table_entry *current_entry;
-    struct d_symbol_table_entry *tmp;
+    size_t i = 0;
 
 
-    if(_symbol_table == NULL) {
+    if(table == NULL) {
 
         d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL,
                                "symbol_table.c", "d_symbol_table_destroy",
-                               "'_symbol_table'");
+                               "'table'");
         return -1;
     }
 
-    
-    // This "all deletion" procedure is directly taken from the library's
-    // reference
-    HASH_ITER(hh, _symbol_table->table, current_entry, tmp) {
 
-        // Deletes the entry before proceeding to the next one
-        HASH_DEL(_symbol_table->table, current_entry);
+    // The entries are not freed by the hash table, but along with the arenas
+    // from which they were allocated
+    free(table->control);
+    free(table->slots);
+
+    for(i = 0; i < D_SYMBOL_TABLE_CATEGORY_COUNT; ++i) {
 
-        // Each internally-managed entry must be properly freed
-        free((char *) current_entry->lexeme);
-        free(current_entry);
+        d_arena_destroy(&(table->categories[i].entries));
+        d_arena_destroy(&(table->categories[i].lexemes));
     }
 
+    free(table->variables);
+
     // The symbol table structure itself must also be freed
-    free(_symbol_table);
+    free(table);
 
 
     return 0;
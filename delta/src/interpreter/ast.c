@@ -0,0 +1,379 @@
+/**
+ * @file ast.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/ast.h
+ */
+
+
+#include "interpreter/ast.h"
+
+#include "common/errors.h"
+
+
+#include <stddef.h>
+// memcpy
+#include <string.h>
+
+
+/** How many elements an array's node can hold at first. */
+#define D_AST_INITIAL_ARRAY_CAPACITY 4
+
+
+/**
+ * @brief Allocates a new node from the given arena, and fills up the members
+ *        that all nodes share.
+ *
+ * @param[in,out] arena The arena.
+ * @param[in] type The node's type.
+ * @param[in] line Line in which the node's expression ends.
+ * @param[in] column Column in which the node's expression ends.
+ *
+ * @return The new node, or NULL if failed.
+ */
+struct d_ast_node *_d_ast_new_node(
+    struct d_arena *arena,
+    enum d_ast_node_type type,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if((node = d_arena_allocate(arena, sizeof(struct d_ast_node))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "ast.c",
+                               "_d_ast_new_node",
+                               "'d_arena_allocate' for struct d_ast_node");
+        return NULL;
+    }
+
+    node->type = (uint8_t) type;
+    node->value_type = D_AST_VALUE_UNKNOWN;
+    node->operation = '\0';
+    node->line = line;
+    node->column = column;
+    node->duplicate_of = NULL;
+    node->local_slot = -1;
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_literal
+ */
+struct d_ast_node *d_ast_new_literal(
+    struct d_arena *arena,
+    const struct d_dec_number *dec_number,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(dec_number == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_literal", "'dec_number'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, D_AST_LITERAL, line, column))
+       != NULL) {
+
+        node->attribute.dec_number = *dec_number;
+        node->value_type = dec_number->is_floating ? D_AST_VALUE_FLOATING :
+                                                     D_AST_VALUE_INTEGER;
+    }
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_identifier
+ */
+struct d_ast_node *d_ast_new_identifier(
+    struct d_arena *arena,
+    enum d_ast_node_type type,
+    struct d_symbol_table_entry *st_entry,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(st_entry == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_identifier", "'st_entry'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, type, line, column)) != NULL) {
+
+        node->attribute.st_entry = st_entry;
+
+        // Math constants are all floating point numbers, whereas variables
+        // may change their data type at any time
+        if(type == D_AST_CONSTANT) {
+            node->value_type = D_AST_VALUE_FLOATING;
+        }
+    }
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_unary
+ */
+struct d_ast_node *d_ast_new_unary(
+    struct d_arena *arena,
+    enum d_ast_node_type type,
+    struct d_symbol_table_entry *st_entry,
+    struct d_ast_node *operand,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(st_entry == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_unary", "'st_entry'");
+        return NULL;
+    }
+
+    if(operand == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_unary", "'operand'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, type, line, column)) != NULL) {
+
+        node->attribute.unary.st_entry = st_entry;
+        node->attribute.unary.operand = operand;
+
+        // Math functions always return floating point numbers (or arrays of
+        // them, if the argument is an array), while an assignment has the
+        // value of the assigned expression
+        node->value_type = (type == D_AST_FUNCTION_CALL &&
+                            operand->value_type != D_AST_VALUE_ARRAY) ?
+                               D_AST_VALUE_FLOATING : operand->value_type;
+    }
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_operation
+ */
+struct d_ast_node *d_ast_new_operation(
+    struct d_arena *arena,
+    char operation,
+    struct d_ast_node *left,
+    struct d_ast_node *right,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(left == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_operation", "'left'");
+        return NULL;
+    }
+
+    if(right == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_operation", "'right'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, D_AST_OPERATION, line, column))
+       != NULL) {
+
+        node->operation = operation;
+        node->attribute.binary.left = left;
+        node->attribute.binary.right = right;
+
+        // An array operand always results in an array, which needs the
+        // dynamically typed arithmetic. Otherwise, a floating point operand
+        // always results in floating point arithmetic, whereas integer
+        // arithmetic can only be guaranteed if both operands are known to be
+        // integers
+        if(left->value_type == D_AST_VALUE_ARRAY ||
+           right->value_type == D_AST_VALUE_ARRAY) {
+
+            node->value_type = D_AST_VALUE_ARRAY;
+        }
+
+        else if(left->value_type == D_AST_VALUE_FLOATING ||
+                right->value_type == D_AST_VALUE_FLOATING) {
+
+            node->value_type = D_AST_VALUE_FLOATING;
+        }
+
+        else if(left->value_type == D_AST_VALUE_INTEGER &&
+                right->value_type == D_AST_VALUE_INTEGER) {
+
+            node->value_type = D_AST_VALUE_INTEGER;
+        }
+    }
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_negation
+ */
+struct d_ast_node *d_ast_new_negation(
+    struct d_arena *arena,
+    struct d_ast_node *operand,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(operand == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_negation", "'operand'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, D_AST_NEGATION, line, column))
+       != NULL) {
+
+        node->attribute.operand = operand;
+        node->value_type = operand->value_type;
+    }
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_new_array
+ */
+struct d_ast_node *d_ast_new_array(
+    struct d_arena *arena,
+    struct d_ast_node *element,
+    int line,
+    int column
+)
+{
+    struct d_ast_node *node = NULL;
+
+
+    if(element == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_new_array", "'element'");
+        return NULL;
+    }
+
+
+    if((node = _d_ast_new_node(arena, D_AST_ARRAY, line, column)) == NULL) {
+        return NULL;
+    }
+
+    node->value_type = D_AST_VALUE_ARRAY;
+
+    if((node->attribute.array.elements = d_arena_allocate(
+            arena, D_AST_INITIAL_ARRAY_CAPACITY * sizeof(struct d_ast_node *)
+        )) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "ast.c",
+                               "d_ast_new_array",
+                               "'d_arena_allocate' for the elements");
+        return NULL;
+    }
+
+    node->attribute.array.elements[0] = element;
+    node->attribute.array.count = 1;
+    node->attribute.array.capacity = D_AST_INITIAL_ARRAY_CAPACITY;
+
+
+    return node;
+}
+
+
+/**
+ * @brief Implementation of ast.h/d_ast_add_element
+ */
+int d_ast_add_element(
+    struct d_arena *arena,
+    struct d_ast_node *array,
+    struct d_ast_node *element
+)
+{
+    struct d_ast_node **elements = NULL;
+
+
+    if(array == NULL || element == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "ast.c",
+                               "d_ast_add_element", "'array' or 'element'");
+        return -1;
+    }
+
+
+    // The arena cannot free the previous elements, but they are released
+    // along with the rest of the tree
+    if(array->attribute.array.count == array->attribute.array.capacity) {
+
+        if((elements = d_arena_allocate(
+                arena,
+                2 * array->attribute.array.capacity *
+                    sizeof(struct d_ast_node *)
+            )) == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "ast.c",
+                                   "d_ast_add_element",
+                                   "'d_arena_allocate' for the elements");
+            return -1;
+        }
+
+        memcpy(elements, array->attribute.array.elements,
+               array->attribute.array.count * sizeof(struct d_ast_node *));
+
+        array->attribute.array.elements = elements;
+        array->attribute.array.capacity *= 2;
+    }
+
+    array->attribute.array.elements[array->attribute.array.count++] =
+        element;
+
+
+    return 0;
+}
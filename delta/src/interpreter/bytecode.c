@@ -0,0 +1,454 @@
+/**
+ * @file bytecode.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/bytecode.h
+ */
+
+
+#include "interpreter/bytecode.h"
+
+#include "common/errors.h"
+
+
+#include <stddef.h>
+
+
+/**
+ * @brief Keeps track of the program that is being compiled.
+ */
+struct _d_bytecode_compiler {
+    /** Where the next instruction will be written. */
+    struct d_bytecode_instruction *next_instruction;
+
+    /** How many values will be in the stack after running the instructions
+        that have been emitted so far. */
+    size_t stack_depth;
+    /** Maximum value that "stack_depth" has reached. */
+    size_t max_stack_depth;
+
+    /** How many local slots have been used so far. */
+    size_t local_count;
+};
+
+
+/**
+ * @brief Counts how many nodes there are in the given AST.
+ *
+ * @param[in] node The root of the AST.
+ *
+ * @return How many nodes there are.
+ */
+size_t _d_bytecode_count_nodes(
+    const struct d_ast_node *node
+)
+{
+    size_t count = 0;
+    size_t i = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_ASSIGNMENT:
+        case D_AST_FUNCTION_CALL:
+            return 1 + _d_bytecode_count_nodes(node->attribute.unary.operand);
+
+        case D_AST_OPERATION:
+            return 1 + _d_bytecode_count_nodes(node->attribute.binary.left) +
+                   _d_bytecode_count_nodes(node->attribute.binary.right);
+
+        case D_AST_NEGATION:
+            return 1 + _d_bytecode_count_nodes(node->attribute.operand);
+
+        case D_AST_ARRAY:
+            count = 1;
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                count += _d_bytecode_count_nodes(
+                             node->attribute.array.elements[i]
+                         );
+            }
+            return count;
+
+        default:
+            return 1;
+    }
+}
+
+
+/**
+ * @brief Emits a new instruction.
+ *
+ * @param[in,out] compiler The compiler's state.
+ * @param[in] opcode The instruction's opcode.
+ * @param[in] stack_delta How many values the instruction pushes into the
+ *                        stack (negative if it pops them).
+ *
+ * @return The new instruction, so that its operand can be filled up.
+ */
+struct d_bytecode_instruction *_d_bytecode_emit(
+    struct _d_bytecode_compiler *compiler,
+    enum d_bytecode_opcode opcode,
+    int stack_delta
+)
+{
+    struct d_bytecode_instruction *instruction = compiler->next_instruction;
+
+
+    instruction->opcode = (uint8_t) opcode;
+    ++(compiler->next_instruction);
+
+    compiler->stack_depth += stack_delta;
+
+    if(compiler->stack_depth > compiler->max_stack_depth) {
+        compiler->max_stack_depth = compiler->stack_depth;
+    }
+
+
+    return instruction;
+}
+
+
+/**
+ * @brief Emits the instruction, if any, that converts the value on top of
+ *        the stack into a floating point number.
+ *
+ * @param[in,out] compiler The compiler's state.
+ * @param[in] value_type The data type that the value is known to have.
+ */
+void _d_bytecode_emit_to_floating(
+    struct _d_bytecode_compiler *compiler,
+    uint8_t value_type
+)
+{
+    if(value_type == D_AST_VALUE_INTEGER) {
+        _d_bytecode_emit(compiler, D_OP_TO_FLOATING_INTEGER, 0);
+    }
+
+    // Arrays may hold integer numbers too
+    else if(value_type != D_AST_VALUE_FLOATING) {
+        _d_bytecode_emit(compiler, D_OP_TO_FLOATING_ANY, 0);
+    }
+}
+
+
+/**
+ * @brief Returns the opcode that performs the given operation for the given
+ *        data type.
+ *
+ * @param[in] operation The symbol that represents the operation (+, -, *, /,
+ *                      %, ^).
+ * @param[in] value_type The data type of the operation's result.
+ *
+ * @return The opcode, or -1 if the operation is not supported.
+ */
+int _d_bytecode_get_operation_opcode(
+    char operation,
+    uint8_t value_type
+)
+{
+    // All arithmetic opcodes are listed in the same order for each data
+    // type, so only the first one needs to be known
+    int first_opcode = value_type == D_AST_VALUE_INTEGER ? D_OP_ADD_INTEGER :
+                       value_type == D_AST_VALUE_FLOATING ?
+                           D_OP_ADD_FLOATING : D_OP_ADD_ANY;
+
+
+    switch(operation) {
+        case '+':
+            return first_opcode;
+
+        case '-':
+            return first_opcode + (D_OP_SUB_INTEGER - D_OP_ADD_INTEGER);
+
+        case '*':
+            return first_opcode + (D_OP_MUL_INTEGER - D_OP_ADD_INTEGER);
+
+        case '/':
+            return first_opcode + (D_OP_DIV_INTEGER - D_OP_ADD_INTEGER);
+
+        case '%':
+            return first_opcode + (D_OP_MOD_INTEGER - D_OP_ADD_INTEGER);
+
+        case '^':
+            return first_opcode + (D_OP_POW_INTEGER - D_OP_ADD_INTEGER);
+
+        default:
+            return -1;
+    }
+}
+
+
+/**
+ * @brief Emits the instructions that compute the value of the given AST.
+ *
+ * @param[in,out] compiler The compiler's state.
+ * @param[in] node The root of the AST.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_bytecode_compile_node(
+    struct _d_bytecode_compiler *compiler,
+    const struct d_ast_node *node
+)
+{
+    struct d_bytecode_instruction *instruction = NULL;
+    int opcode = 0;
+    size_t i = 0;
+
+
+    // Its value has already been computed by the original node
+    if(node->duplicate_of != NULL) {
+
+        instruction = _d_bytecode_emit(compiler, D_OP_LOAD_LOCAL, 1);
+        instruction->operand.local_slot = node->duplicate_of->local_slot;
+
+        return 0;
+    }
+
+
+    switch(node->type) {
+
+        case D_AST_LITERAL:
+
+            if(node->attribute.dec_number.is_floating) {
+                instruction = _d_bytecode_emit(compiler, D_OP_PUSH_FLOATING,
+                                               1);
+                instruction->operand.floating =
+                                    node->attribute.dec_number.values.floating;
+            }
+
+            else {
+                instruction = _d_bytecode_emit(compiler, D_OP_PUSH_INTEGER,
+                                               1);
+                instruction->operand.integer =
+                                     node->attribute.dec_number.values.integer;
+            }
+
+            break;
+
+
+        case D_AST_CONSTANT:
+
+            instruction = _d_bytecode_emit(compiler, D_OP_LOAD_CONSTANT, 1);
+            instruction->operand.st_entry = node->attribute.st_entry;
+
+            break;
+
+
+        case D_AST_VARIABLE:
+
+            instruction = _d_bytecode_emit(compiler, D_OP_LOAD_VARIABLE, 1);
+            instruction->operand.variable_slot =
+                node->attribute.st_entry->attribute.variable_slot;
+
+            break;
+
+
+        case D_AST_ASSIGNMENT:
+
+            if(_d_bytecode_compile_node(compiler,
+                                        node->attribute.unary.operand) != 0) {
+                return -1;
+            }
+
+            instruction = _d_bytecode_emit(compiler, D_OP_STORE_VARIABLE, 0);
+            instruction->operand.variable_slot =
+                node->attribute.unary.st_entry->attribute.variable_slot;
+
+            break;
+
+
+        case D_AST_FUNCTION_CALL:
+
+            if(_d_bytecode_compile_node(compiler,
+                                        node->attribute.unary.operand) != 0) {
+                return -1;
+            }
+
+            // Math functions always take "double" (floating) values
+            _d_bytecode_emit_to_floating(
+                compiler, node->attribute.unary.operand->value_type
+            );
+
+            instruction = _d_bytecode_emit(compiler, D_OP_CALL_FUNCTION, 0);
+            instruction->operand.function =
+                node->attribute.unary.st_entry->attribute.function;
+
+            break;
+
+
+        case D_AST_OPERATION:
+
+            if((opcode = _d_bytecode_get_operation_opcode(node->operation,
+                                                          node->value_type))
+               < 0) {
+
+                d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                                       "bytecode.c",
+                                       "_d_bytecode_compile_node",
+                                       "the specified operation is not "
+                                       "supported");
+                return -1;
+            }
+
+            // If floating point arithmetic is known to be needed, any
+            // operand that may not be a floating point number is converted
+            // right after being computed
+            if(_d_bytecode_compile_node(compiler,
+                                        node->attribute.binary.left) != 0) {
+                return -1;
+            }
+
+            if(node->value_type == D_AST_VALUE_FLOATING) {
+                _d_bytecode_emit_to_floating(
+                    compiler, node->attribute.binary.left->value_type
+                );
+            }
+
+            if(_d_bytecode_compile_node(compiler,
+                                        node->attribute.binary.right) != 0) {
+                return -1;
+            }
+
+            if(node->value_type == D_AST_VALUE_FLOATING) {
+                _d_bytecode_emit_to_floating(
+                    compiler, node->attribute.binary.right->value_type
+                );
+            }
+
+            instruction = _d_bytecode_emit(compiler, opcode, -1);
+            instruction->operand.column = node->attribute.binary.right->column;
+
+            break;
+
+
+        case D_AST_NEGATION:
+
+            if(_d_bytecode_compile_node(compiler,
+                                        node->attribute.operand) != 0) {
+                return -1;
+            }
+
+            _d_bytecode_emit(
+                compiler,
+                node->value_type == D_AST_VALUE_INTEGER ? D_OP_NEG_INTEGER :
+                node->value_type == D_AST_VALUE_FLOATING ? D_OP_NEG_FLOATING :
+                                                           D_OP_NEG_ANY,
+                0
+            );
+
+            break;
+
+
+        case D_AST_ARRAY:
+
+            for(i = 0; i < node->attribute.array.count; ++i) {
+
+                if(_d_bytecode_compile_node(
+                       compiler, node->attribute.array.elements[i]
+                   ) != 0) {
+                    return -1;
+                }
+            }
+
+            instruction = _d_bytecode_emit(
+                              compiler, D_OP_MAKE_ARRAY,
+                              1 - (int) node->attribute.array.count
+                          );
+            instruction->operand.array.element_count =
+                (uint32_t) node->attribute.array.count;
+            instruction->operand.array.column = node->column;
+
+            break;
+
+
+        default:
+            d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                                   "bytecode.c", "_d_bytecode_compile_node",
+                                   "the specified type of node is not "
+                                   "supported");
+            return -1;
+    }
+
+
+    // Its value will be reused by its duplicates
+    if(node->local_slot >= 0) {
+
+        instruction = _d_bytecode_emit(compiler, D_OP_STORE_LOCAL, 0);
+        instruction->operand.local_slot = node->local_slot;
+
+        if((size_t) node->local_slot >= compiler->local_count) {
+            compiler->local_count = (size_t) node->local_slot + 1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of bytecode.h/d_bytecode_compile
+ */
+int d_bytecode_compile(
+    const struct d_ast_node *root,
+    struct d_arena *arena,
+    struct d_bytecode *bytecode
+)
+{
+    struct _d_bytecode_compiler compiler;
+
+    size_t max_instruction_count = 0;
+
+
+    if(root == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "bytecode.c",
+                               "d_bytecode_compile", "'root'");
+        return -1;
+    }
+
+    if(bytecode == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "bytecode.c",
+                               "d_bytecode_compile", "'bytecode'");
+        return -1;
+    }
+
+
+    // Each node results in one instruction, plus another one if its value
+    // needs to be converted into a floating point number, and another one if
+    // its value needs to be kept in a local slot
+    max_instruction_count = 3 * _d_bytecode_count_nodes(root);
+
+    if((bytecode->instructions = d_arena_allocate(
+            arena,
+            max_instruction_count * sizeof(struct d_bytecode_instruction)
+        )) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "bytecode.c",
+                               "d_bytecode_compile",
+                               "'d_arena_allocate' for instructions");
+        return -1;
+    }
+
+    compiler.next_instruction = bytecode->instructions;
+    compiler.stack_depth = 0;
+    compiler.max_stack_depth = 0;
+    compiler.local_count = 0;
+
+
+    if(_d_bytecode_compile_node(&compiler, root) != 0) {
+        return -1;
+    }
+
+
+    bytecode->instruction_count = compiler.next_instruction -
+                                  bytecode->instructions;
+    bytecode->stack_size = compiler.max_stack_depth;
+    bytecode->local_count = compiler.local_count;
+
+
+    return 0;
+}
@@ -0,0 +1,393 @@
+/**
+ * @file cache.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/cache.h
+ */
+
+
+#include "interpreter/cache.h"
+
+#include "common/errors.h"
+#include "interpreter/vm.h"
+
+
+#include <stdio.h>
+#include <stdlib.h>
+// memcpy
+#include <string.h>
+
+
+/**
+ * @brief Implementation of cache.h/d_cache
+ */
+struct d_cache {
+    /** The library requires the hash table to be a pointer to its entry
+        type, initialized to NULL. */
+    struct d_cache_entry *table;
+
+    /** How many entries the cache can hold, at most. */
+    size_t capacity;
+
+    /** How many times a line has been found in the cache. */
+    size_t hits;
+    /** How many times a line has not been found in the cache. */
+    size_t misses;
+};
+
+
+/**
+ * @brief Returns the length of the given line once normalized.
+ *
+ * @param[in] line The line.
+ * @param[in] length The length of the line.
+ *
+ * @return The length of the line without any trailing whitespace.
+ */
+size_t _d_cache_normalize(
+    const char *line,
+    size_t length
+)
+{
+    while(length > 0 && (line[length - 1] == ' ' || line[length - 1] == '\t'
+                         || line[length - 1] == '\n')) {
+        --length;
+    }
+
+
+    return length;
+}
+
+
+/**
+ * @brief Frees the given entry, which must not be in the table anymore.
+ *
+ * @param[in] entry The entry.
+ */
+void _d_cache_free_entry(
+    struct d_cache_entry *entry
+)
+{
+    free((char *) entry->line);
+    free(entry->bytecode.instructions);
+    d_jit_free(entry->native_code);
+    free(entry);
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_initialize
+ */
+int d_cache_initialize(
+    struct d_cache **cache,
+    size_t capacity
+)
+{
+    if(cache == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_initialize", "'cache'");
+        return -1;
+    }
+
+    if(capacity == 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID, "cache.c",
+                               "d_cache_initialize", "'capacity' must be > 0");
+        return -1;
+    }
+
+
+    if((*cache = malloc(sizeof(struct d_cache))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "cache.c",
+                               "d_cache_initialize", "'malloc' for the cache");
+        return -1;
+    }
+
+    (*cache)->table = NULL;
+    (*cache)->capacity = capacity;
+    (*cache)->hits = 0;
+    (*cache)->misses = 0;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_search
+ */
+struct d_cache_entry *d_cache_search(
+    struct d_cache *cache,
+    const char *line,
+    size_t length
+)
+{
+    struct d_cache_entry *entry = NULL;
+
+
+    if(line == NULL || (length = _d_cache_normalize(line, length)) == 0) {
+        return NULL;
+    }
+
+
+    HASH_FIND(hh, cache->table, line, length, entry);
+
+    if(entry == NULL) {
+        ++(cache->misses);
+        return NULL;
+    }
+
+    ++(cache->hits);
+
+    // Re-adding the entry moves it to the end of the table, which is where
+    // the most recently used entries are
+    HASH_DELETE(hh, cache->table, entry);
+    HASH_ADD_KEYPTR(hh, cache->table, entry->line, entry->line_length,
+                    entry);
+
+
+    return entry;
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_add
+ */
+int d_cache_add(
+    struct d_cache *cache,
+    const char *line,
+    size_t length,
+    const struct d_bytecode *bytecode,
+    int echo
+)
+{
+    struct d_cache_entry *entry = NULL;
+    size_t instructions_size = 0;
+    char *key = NULL;
+
+
+    if(line == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_add", "'line'");
+        return -1;
+    }
+
+    if(bytecode == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_add", "'bytecode'");
+        return -1;
+    }
+
+
+    if((length = _d_cache_normalize(line, length)) == 0) {
+        return 0;
+    }
+
+    // The line may have been added in the meantime (i.e. by a nested
+    // notebook)
+    HASH_FIND(hh, cache->table, line, length, entry);
+
+    if(entry != NULL) {
+        return 0;
+    }
+
+
+    // The least recently used entry is always the first one in the table
+    if(HASH_COUNT(cache->table) >= cache->capacity) {
+
+        entry = cache->table;
+        HASH_DELETE(hh, cache->table, entry);
+        _d_cache_free_entry(entry);
+    }
+
+
+    instructions_size = bytecode->instruction_count *
+                        sizeof(struct d_bytecode_instruction);
+
+    if((entry = malloc(sizeof(struct d_cache_entry))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "cache.c",
+                               "d_cache_add", "'malloc' for a new entry");
+        return -1;
+    }
+
+    if((key = malloc(length)) == NULL ||
+       (entry->bytecode.instructions = malloc(instructions_size)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "cache.c",
+                               "d_cache_add",
+                               "'malloc' for an entry's line or program");
+        free(key);
+        free(entry);
+        return -1;
+    }
+
+    memcpy(key, line, length);
+    memcpy(entry->bytecode.instructions, bytecode->instructions,
+           instructions_size);
+
+    entry->line = key;
+    entry->line_length = length;
+    entry->bytecode.instruction_count = bytecode->instruction_count;
+    entry->bytecode.stack_size = bytecode->stack_size;
+    entry->bytecode.local_count = bytecode->local_count;
+    entry->echo = echo;
+    entry->run_count = 0;
+    entry->native_code = NULL;
+    entry->has_jit_failed = 0;
+
+
+    HASH_ADD_KEYPTR(hh, cache->table, entry->line, entry->line_length,
+                    entry);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_run
+ */
+int d_cache_run(
+    struct d_context *context,
+    struct d_cache_entry *entry,
+    int line,
+    struct d_dec_number *result
+)
+{
+    int return_value = 0;
+
+
+    if(entry == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_run", "'entry'");
+        return -1;
+    }
+
+
+    if(d_jit_enabled) {
+
+        // If the program cannot be compiled, it would most likely fail again
+        // for the same reason, so it is not tried again
+        if(entry->native_code == NULL && !entry->has_jit_failed &&
+           ++(entry->run_count) > D_JIT_HOT_THRESHOLD &&
+           d_jit_compile(context, &(entry->bytecode),
+                         &(entry->native_code)) != 0) {
+
+            entry->has_jit_failed = 1;
+        }
+
+        if(entry->native_code != NULL) {
+
+            if((return_value = d_jit_execute(context, entry->native_code,
+                                             &(entry->bytecode), line,
+                                             result))
+               != D_JIT_TYPES_CHANGED) {
+
+                return return_value;
+            }
+
+            d_jit_free(entry->native_code);
+            entry->native_code = NULL;
+            entry->run_count = 0;
+        }
+    }
+
+
+    return d_vm_execute(context, &(entry->bytecode), line, result);
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_clear
+ */
+int d_cache_clear(
+    struct d_cache *cache
+)
+{
+    struct d_cache_entry *current_entry = NULL;
+    struct d_cache_entry *tmp = NULL;
+
+
+    if(cache == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_clear", "'cache'");
+        return -1;
+    }
+
+
+    HASH_ITER(hh, cache->table, current_entry, tmp) {
+
+        HASH_DELETE(hh, cache->table, current_entry);
+        _d_cache_free_entry(current_entry);
+    }
+
+    cache->table = NULL;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_show
+ */
+int d_cache_show(
+    struct d_cache *cache
+)
+{
+    struct d_cache_entry *entry = NULL;
+    size_t native_count = 0;
+
+
+    if(cache == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "cache.c",
+                               "d_cache_show", "'cache'");
+        return -1;
+    }
+
+
+    for(entry = cache->table; entry != NULL; entry = entry->hh.next) {
+        if(entry->native_code != NULL) {
+            ++native_count;
+        }
+    }
+
+
+    printf("   Compiled expressions cache:\n");
+    printf("      entries => %u/%zu\n", HASH_COUNT(cache->table),
+           cache->capacity);
+    printf("      native => %zu (JIT %s)\n", native_count,
+           d_jit_enabled ? "on" : "off");
+    printf("      hits => %zu\n", cache->hits);
+    printf("      misses => %zu\n", cache->misses);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of cache.h/d_cache_destroy
+ */
+int d_cache_destroy(
+    struct d_cache *cache
+)
+{
+    if(d_cache_clear(cache) != 0) {
+        return -1;
+    }
+
+    free(cache);
+
+
+    return 0;
+}
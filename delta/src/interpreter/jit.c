@@ -0,0 +1,1173 @@
+/**
+ * @file jit.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/jit.h
+ *
+ * @details
+ *  The native code has the following layout:
+ *
+ *    - Prologue. It saves RBX, which then points to the frame that the
+ *      caller gives, and jumps to the guards.
+ *    - Exit. Restores RBX and returns EAX, which every other part jumps back
+ *      to.
+ *    - Body. Each instruction of the program is translated on its own, using
+ *      the frame's 8-byte slots as the stack, followed by the local slots.
+ *      As data types are known, values are raw int64/double ones.
+ *      Variables are accessed through RCX, which is loaded from the last
+ *      slot of the frame, where the caller leaves the address of the
+ *      variables' values (see common/symbol_table.h), as they may have been
+ *      moved since the code was generated.
+ *    - Guards. They check that the variables still hold the data types for
+ *      which the body was specialized, and jump back to it. As the guards
+ *      are only known after translating the body, they are placed at the
+ *      end.
+ *
+ *  The code returns 0 if successful, -1 if any guard fails, and "k + 1" if
+ *  the k-th instruction has found a division by 0.
+ */
+
+
+// MAP_ANONYMOUS
+#define _DEFAULT_SOURCE
+
+
+#include "interpreter/jit.h"
+
+#include "common/errors.h"
+
+
+// pow, fmod
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+// memcpy
+#include <string.h>
+
+#if defined(__x86_64__)
+// mmap, mprotect, munmap
+#include <sys/mman.h>
+#endif
+
+
+/** How many slots the frame can have without needing to reserve memory for
+    it. */
+#define D_JIT_LOCAL_FRAME_SIZE 64
+
+
+/** Value that the native code returns when any guard fails. */
+#define D_JIT_GUARD_FAILED -1
+
+/** Highest variable slot that the native code can reach, as the offset of
+    its value must fit in a 32-bit displacement. */
+#define D_JIT_MAX_VARIABLE_SLOT \
+    ((INT32_MAX - sizeof(struct d_dec_number)) / sizeof(struct d_dec_number))
+
+
+/**
+ * @brief Implementation of jit.h/d_jit_enabled
+ */
+#if defined(__x86_64__)
+int d_jit_enabled = 1;
+#else
+int d_jit_enabled = 0;
+#endif
+
+
+/**
+ * @brief Signature of the native code.
+ */
+typedef int (*_d_jit_function) (uint64_t *frame);
+
+
+#if defined(__x86_64__)
+
+
+/* ═══ x86-64 encodings ═══ */
+
+// Instructions that access a frame slot, "[rbx + disp32]", which is appended
+// when emitting them
+#define _D_X64_MOV_RAX_SLOT     "\x48\x8B\x83"
+#define _D_X64_MOV_RCX_SLOT     "\x48\x8B\x8B"
+#define _D_X64_MOV_RSI_SLOT     "\x48\x8B\xB3"
+#define _D_X64_MOV_RDI_SLOT     "\x48\x8B\xBB"
+#define _D_X64_MOV_SLOT_RAX     "\x48\x89\x83"
+#define _D_X64_MOV_SLOT_RDX     "\x48\x89\x93"
+#define _D_X64_ADD_RAX_SLOT     "\x48\x03\x83"
+#define _D_X64_SUB_RAX_SLOT     "\x48\x2B\x83"
+#define _D_X64_IMUL_RAX_SLOT    "\x48\x0F\xAF\x83"
+#define _D_X64_NEG_SLOT         "\x48\xF7\x9B"
+#define _D_X64_MOVSD_XMM0_SLOT  "\xF2\x0F\x10\x83"
+#define _D_X64_MOVSD_XMM1_SLOT  "\xF2\x0F\x10\x8B"
+#define _D_X64_MOVSD_SLOT_XMM0  "\xF2\x0F\x11\x83"
+#define _D_X64_ADDSD_XMM0_SLOT  "\xF2\x0F\x58\x83"
+#define _D_X64_MULSD_XMM0_SLOT  "\xF2\x0F\x59\x83"
+#define _D_X64_SUBSD_XMM0_SLOT  "\xF2\x0F\x5C\x83"
+#define _D_X64_DIVSD_XMM0_SLOT  "\xF2\x0F\x5E\x83"
+#define _D_X64_CVTSI2SD_SLOT    "\xF2\x48\x0F\x2A\x83"
+#define _D_X64_UCOMISD_XMM1_SLOT "\x66\x0F\x2E\x8B"
+
+// Instructions followed by a 64-bit immediate
+#define _D_X64_MOV_RAX_IMM64    "\x48\xB8"
+
+// Instructions that access "[rcx + disp32]", which is appended when
+// emitting them
+#define _D_X64_MOV_RAX_RCX      "\x48\x8B\x81"
+#define _D_X64_MOV_RCX_RAX      "\x48\x89\x81"
+#define _D_X64_MOV_BYTE_RCX     "\xC6\x81"
+#define _D_X64_CMP_BYTE_RCX     "\x80\xB9"
+
+// Other instructions
+// "push rbx; mov rbx,rdi" and "pop rbx; ret"
+#define _D_X64_PROLOGUE         "\x53\x48\x89\xFB"
+#define _D_X64_EPILOGUE         "\x5B\xC3"
+#define _D_X64_LOAD_RAX         "\x48\x8B\x00"          // mov rax,[rax]
+#define _D_X64_CALL_RAX         "\xFF\xD0"              // call rax
+#define _D_X64_CQO_IDIV_RCX     "\x48\x99\x48\xF7\xF9"  // cqo; idiv rcx
+#define _D_X64_TEST_RCX         "\x48\x85\xC9"          // test rcx,rcx
+#define _D_X64_XORPD_XMM1       "\x66\x0F\x57\xC9"      // xorpd xmm1,xmm1
+#define _D_X64_BTC_RAX_SIGN     "\x48\x0F\xBA\xF8\x3F"  // btc rax,63
+#define _D_X64_XOR_EAX          "\x31\xC0"              // xor eax,eax
+#define _D_X64_MOV_EAX_IMM32    "\xB8"
+#define _D_X64_JMP_REL32        "\xE9"
+#define _D_X64_JNE_REL32        "\x0F\x85"
+#define _D_X64_JNE_SKIP_ERROR   "\x75\x0A"  // Over "mov eax,imm32; jmp rel32"
+#define _D_X64_JP_SKIP_ERROR    "\x7A\x0C"  // Same, and over a "jne" too
+
+/** Emits an instruction given by one of the encodings above. */
+#define _d_jit_emit_code(buffer, encoding) \
+    _d_jit_emit((buffer), (encoding), sizeof(encoding) - 1)
+
+/** Emits an instruction that accesses a frame slot. */
+#define _d_jit_emit_slot_code(buffer, encoding, slot) \
+    _d_jit_emit_slot((buffer), (encoding), sizeof(encoding) - 1, (slot))
+
+/** Emits an instruction that accesses a member of a variable's value. */
+#define _d_jit_emit_variable_code(translation, encoding, slot, member) \
+    _d_jit_emit_variable((translation), (encoding), sizeof(encoding) - 1, \
+                         (slot), offsetof(struct d_dec_number, member))
+
+
+/**
+ * @brief Represents the buffer in which native code is generated.
+ */
+struct _d_jit_buffer {
+    /** The generated code. */
+    uint8_t *bytes;
+    /** How many bytes have been generated. */
+    size_t size;
+    /** How many bytes the buffer can hold. */
+    size_t capacity;
+
+    /** If any memory could not be reserved. */
+    int failed;
+};
+
+
+/**
+ * @brief Represents what is known about a variable while translating a
+ *        program.
+ */
+struct _d_jit_variable {
+    /** The variable's slot. */
+    size_t slot;
+    /** If it holds a floating point number or an integer one, at the current
+        point of the program. */
+    int is_floating;
+    /** If the program loads its value before storing it, so it must be
+        guarded. */
+    int is_guarded;
+};
+
+
+/**
+ * @brief Represents the state of the translation of a program.
+ */
+struct _d_jit_translation {
+    /** The native code. */
+    struct _d_jit_buffer buffer;
+
+    /** For each stack position, if it holds a floating point number. */
+    int *stack_types;
+    /** How many values the stack holds at the current point. */
+    size_t stack_depth;
+
+    /** For each local slot, if it holds a floating point number. */
+    int *local_types;
+
+    /** The variables that the program has used so far. */
+    struct _d_jit_variable *variables;
+    /** How many variables that is. */
+    size_t variable_count;
+
+    /** The values that the variables hold right now. */
+    const struct d_dec_number *variable_values;
+    /** The frame slot that holds the address of the variables' values. */
+    size_t variables_frame_slot;
+
+    /** Where the exit stub starts. */
+    size_t exit_offset;
+};
+
+
+/**
+ * @brief Raises 'base' to 'exponent' just as the virtual machine does.
+ *
+ * @param[in] base The base.
+ * @param[in] exponent The exponent.
+ *
+ * @return The power, truncated.
+ */
+int64_t _d_jit_pow_integer(
+    int64_t base,
+    int64_t exponent
+)
+{
+    return (int64_t) pow(base, exponent);
+}
+
+
+/**
+ * @brief Appends the given bytes to the given buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] bytes The bytes.
+ * @param[in] length How many bytes.
+ */
+void _d_jit_emit(
+    struct _d_jit_buffer *buffer,
+    const void *bytes,
+    size_t length
+)
+{
+    uint8_t *new_bytes = NULL;
+    size_t new_capacity = 0;
+
+
+    if(buffer->failed) {
+        return;
+    }
+
+    if(buffer->size + length > buffer->capacity) {
+
+        new_capacity = buffer->capacity == 0 ? 256 : 2 * buffer->capacity;
+
+        while(new_capacity < buffer->size + length) {
+            new_capacity *= 2;
+        }
+
+        if((new_bytes = realloc(buffer->bytes, new_capacity)) == NULL) {
+            buffer->failed = 1;
+            return;
+        }
+
+        buffer->bytes = new_bytes;
+        buffer->capacity = new_capacity;
+    }
+
+    memcpy(buffer->bytes + buffer->size, bytes, length);
+    buffer->size += length;
+}
+
+
+/**
+ * @brief Appends a 32-bit value to the given buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] value The value.
+ */
+void _d_jit_emit_32(
+    struct _d_jit_buffer *buffer,
+    int32_t value
+)
+{
+    // x86-64 is little endian, just as the encoding of immediates
+    _d_jit_emit(buffer, &value, sizeof(value));
+}
+
+
+/**
+ * @brief Appends a 64-bit value to the given buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] value The value.
+ */
+void _d_jit_emit_64(
+    struct _d_jit_buffer *buffer,
+    const void *value
+)
+{
+    _d_jit_emit(buffer, value, 8);
+}
+
+
+/**
+ * @brief Appends an instruction that accesses a frame slot.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] encoding The instruction, without its displacement.
+ * @param[in] length The length of the instruction.
+ * @param[in] slot The slot.
+ */
+void _d_jit_emit_slot(
+    struct _d_jit_buffer *buffer,
+    const char *encoding,
+    size_t length,
+    size_t slot
+)
+{
+    _d_jit_emit(buffer, encoding, length);
+    _d_jit_emit_32(buffer, (int32_t) (8 * slot));
+}
+
+
+/**
+ * @brief Appends an instruction that accesses a member of a variable's value,
+ *        through RCX.
+ *
+ * @details
+ *  RCX gets loaded first with the address of the variables' values.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] encoding The instruction, without its displacement.
+ * @param[in] length The length of the instruction.
+ * @param[in] slot The variable's slot.
+ * @param[in] offset The offset of the member in "struct d_dec_number".
+ */
+void _d_jit_emit_variable(
+    struct _d_jit_translation *translation,
+    const char *encoding,
+    size_t length,
+    size_t slot,
+    size_t offset
+)
+{
+    _d_jit_emit_slot_code(&(translation->buffer), _D_X64_MOV_RCX_SLOT,
+                          translation->variables_frame_slot);
+    _d_jit_emit(&(translation->buffer), encoding, length);
+    _d_jit_emit_32(&(translation->buffer),
+                   (int32_t) (slot * sizeof(struct d_dec_number) + offset));
+}
+
+
+/**
+ * @brief Appends "mov <register>, <address>".
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] encoding The instruction, without its immediate.
+ * @param[in] address The address.
+ */
+void _d_jit_emit_address(
+    struct _d_jit_buffer *buffer,
+    const char *encoding,
+    const void *address
+)
+{
+    uint64_t value = (uint64_t) (uintptr_t) address;
+
+
+    _d_jit_emit(buffer, encoding, 2);
+    _d_jit_emit_64(buffer, &value);
+}
+
+
+/**
+ * @brief Appends a jump back to the given offset of the buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] encoding The jump, without its displacement.
+ * @param[in] length The length of the jump.
+ * @param[in] target The offset to jump to.
+ */
+void _d_jit_emit_jump(
+    struct _d_jit_buffer *buffer,
+    const char *encoding,
+    size_t length,
+    size_t target
+)
+{
+    // The displacement is relative to the end of the jump
+    _d_jit_emit(buffer, encoding, length);
+    _d_jit_emit_32(buffer, (int32_t) ((long) target - (long) buffer->size -
+                                      4));
+}
+
+
+/**
+ * @brief Appends "mov eax, <status>" and a jump to the exit stub.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] status The status to return.
+ */
+void _d_jit_emit_return(
+    struct _d_jit_translation *translation,
+    int32_t status
+)
+{
+    _d_jit_emit_code(&(translation->buffer), _D_X64_MOV_EAX_IMM32);
+    _d_jit_emit_32(&(translation->buffer), status);
+    _d_jit_emit_jump(&(translation->buffer), _D_X64_JMP_REL32,
+                     sizeof(_D_X64_JMP_REL32) - 1,
+                     translation->exit_offset);
+}
+
+
+/**
+ * @brief Appends a check that the given slot holds a non-zero value, which
+ *        makes the code return "index + 1" otherwise.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] slot The slot.
+ * @param[in] is_floating If the slot holds a floating point number.
+ * @param[in] index The index of the instruction that performs the check.
+ */
+void _d_jit_emit_zero_check(
+    struct _d_jit_translation *translation,
+    size_t slot,
+    int is_floating,
+    size_t index
+)
+{
+    struct _d_jit_buffer *buffer = &(translation->buffer);
+
+
+    if(is_floating) {
+        // NaN compares as unordered, which is not 0.0 either
+        _d_jit_emit_code(buffer, _D_X64_XORPD_XMM1);
+        _d_jit_emit_slot_code(buffer, _D_X64_UCOMISD_XMM1_SLOT, slot);
+        _d_jit_emit_code(buffer, _D_X64_JP_SKIP_ERROR);
+    }
+
+    else {
+        _d_jit_emit_slot_code(buffer, _D_X64_MOV_RCX_SLOT, slot);
+        _d_jit_emit_code(buffer, _D_X64_TEST_RCX);
+    }
+
+    _d_jit_emit_code(buffer, _D_X64_JNE_SKIP_ERROR);
+    _d_jit_emit_return(translation, (int32_t) (index + 1));
+}
+
+
+/**
+ * @brief Appends the conversion of the integer in the given slot into a
+ *        floating point number.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] position The stack position of the slot.
+ */
+void _d_jit_emit_to_floating(
+    struct _d_jit_translation *translation,
+    size_t position
+)
+{
+    if(translation->stack_types[position]) {
+        return;
+    }
+
+    _d_jit_emit_slot_code(&(translation->buffer), _D_X64_CVTSI2SD_SLOT,
+                          position);
+    _d_jit_emit_slot_code(&(translation->buffer), _D_X64_MOVSD_SLOT_XMM0,
+                          position);
+    translation->stack_types[position] = 1;
+}
+
+
+/**
+ * @brief Finds what is known about the given variable, adding it if it is
+ *        the first time that the program uses it.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] slot The variable's slot.
+ * @param[in] is_load If the program is loading its value.
+ *
+ * @return What is known about the variable.
+ */
+struct _d_jit_variable *_d_jit_get_variable(
+    struct _d_jit_translation *translation,
+    size_t slot,
+    int is_load
+)
+{
+    struct _d_jit_variable *variable = NULL;
+    size_t i = 0;
+
+
+    for(i = 0; i < translation->variable_count; ++i) {
+        if(translation->variables[i].slot == slot) {
+            return &(translation->variables[i]);
+        }
+    }
+
+    // Its current data type is the one for which the code gets specialized
+    variable = &(translation->variables[translation->variable_count++]);
+    variable->slot = slot;
+    variable->is_floating = translation->variable_values[slot].is_floating;
+    variable->is_guarded = is_load;
+
+
+    return variable;
+}
+
+
+/**
+ * @brief Appends an arithmetic operation over the two values on top of the
+ *        stack, whose data types have been already made equal.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] operation The operation, as '+', '-', '*', '/', '%' or '^'.
+ * @param[in] index The index of the instruction.
+ */
+void _d_jit_emit_arithmetic(
+    struct _d_jit_translation *translation,
+    char operation,
+    size_t index
+)
+{
+    struct _d_jit_buffer *buffer = &(translation->buffer);
+
+    size_t top = translation->stack_depth - 1;
+    size_t below = translation->stack_depth - 2;
+    int is_floating = translation->stack_types[top];
+
+
+    if(operation == '/' || operation == '%') {
+        _d_jit_emit_zero_check(translation, top, is_floating, index);
+    }
+
+
+    if(!is_floating) {
+
+        switch(operation) {
+            case '+':
+            case '-':
+            case '*':
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT, below);
+                if(operation == '+') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_ADD_RAX_SLOT, top);
+                } else if(operation == '-') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_SUB_RAX_SLOT, top);
+                } else {
+                    _d_jit_emit_slot_code(buffer, _D_X64_IMUL_RAX_SLOT, top);
+                }
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, below);
+                break;
+
+            // The zero check has left the divisor in RCX
+            case '/':
+            case '%':
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT, below);
+                _d_jit_emit_code(buffer, _D_X64_CQO_IDIV_RCX);
+                if(operation == '/') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, below);
+                } else {
+                    _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RDX, below);
+                }
+                break;
+
+            default:
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_RDI_SLOT, below);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_RSI_SLOT, top);
+                _d_jit_emit_address(buffer, _D_X64_MOV_RAX_IMM64,
+                                    (const void *) &_d_jit_pow_integer);
+                _d_jit_emit_code(buffer, _D_X64_CALL_RAX);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, below);
+                break;
+        }
+    }
+
+    else {
+
+        switch(operation) {
+            case '+':
+            case '-':
+            case '*':
+            case '/':
+                _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_XMM0_SLOT, below);
+                if(operation == '+') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_ADDSD_XMM0_SLOT, top);
+                } else if(operation == '-') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_SUBSD_XMM0_SLOT, top);
+                } else if(operation == '*') {
+                    _d_jit_emit_slot_code(buffer, _D_X64_MULSD_XMM0_SLOT, top);
+                } else {
+                    _d_jit_emit_slot_code(buffer, _D_X64_DIVSD_XMM0_SLOT, top);
+                }
+                _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_SLOT_XMM0, below);
+                break;
+
+            default:
+                _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_XMM0_SLOT, below);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_XMM1_SLOT, top);
+                _d_jit_emit_address(buffer, _D_X64_MOV_RAX_IMM64,
+                                    operation == '%' ? (const void *) &fmod
+                                                     : (const void *) &pow);
+                _d_jit_emit_code(buffer, _D_X64_CALL_RAX);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_SLOT_XMM0, below);
+                break;
+        }
+    }
+
+
+    --(translation->stack_depth);
+}
+
+
+/**
+ * @brief Appends the translation of the given instruction.
+ *
+ * @param[in,out] translation The translation.
+ * @param[in] bytecode The program.
+ * @param[in] index The index of the instruction.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_jit_translate_instruction(
+    struct _d_jit_translation *translation,
+    const struct d_bytecode *bytecode,
+    size_t index
+)
+{
+    const struct d_bytecode_instruction *instruction =
+        &(bytecode->instructions[index]);
+    struct _d_jit_buffer *buffer = &(translation->buffer);
+    struct _d_jit_variable *variable = NULL;
+    struct d_dec_number *dec_number = NULL;
+
+    size_t depth = translation->stack_depth;
+    size_t local_slot = 0;
+    size_t variable_slot = 0;
+    uint8_t is_floating = 0;
+    const uint8_t is_not_array = 0;
+
+
+    switch(instruction->opcode) {
+
+        /* ═══ Loading & storing values ═══ */
+
+        case D_OP_PUSH_INTEGER:
+        case D_OP_PUSH_FLOATING:
+            _d_jit_emit_code(buffer, _D_X64_MOV_RAX_IMM64);
+            _d_jit_emit_64(buffer, &(instruction->operand));
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, depth);
+            translation->stack_types[depth] =
+                instruction->opcode == D_OP_PUSH_FLOATING;
+            ++(translation->stack_depth);
+            break;
+
+        // Math constants never change, nor do they move, so they need no
+        // guards
+        case D_OP_LOAD_CONSTANT:
+            dec_number =
+                &(instruction->operand.st_entry->attribute.dec_number);
+            _d_jit_emit_address(buffer, _D_X64_MOV_RAX_IMM64,
+                                &(dec_number->values));
+            _d_jit_emit_code(buffer, _D_X64_LOAD_RAX);
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, depth);
+
+            translation->stack_types[depth] = dec_number->is_floating;
+            ++(translation->stack_depth);
+            break;
+
+        case D_OP_LOAD_VARIABLE:
+        case D_OP_STORE_VARIABLE:
+            variable_slot = instruction->operand.variable_slot;
+
+            if(variable_slot > D_JIT_MAX_VARIABLE_SLOT) {
+
+                d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                                       "jit.c",
+                                       "_d_jit_translate_instruction",
+                                       "the variable's slot is out of reach");
+                return -1;
+            }
+
+            if(instruction->opcode == D_OP_LOAD_VARIABLE) {
+
+                // Arrays are left to the virtual machine
+                if(translation->variable_values[variable_slot].is_array) {
+                    return -1;
+                }
+
+                _d_jit_emit_variable_code(translation, _D_X64_MOV_RAX_RCX,
+                                          variable_slot, values);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, depth);
+
+                variable = _d_jit_get_variable(translation, variable_slot, 1);
+                translation->stack_types[depth] = variable->is_floating;
+                ++(translation->stack_depth);
+                break;
+            }
+
+            // All members are written through the same RCX, as the variable
+            // may have held an array
+            is_floating = (uint8_t) translation->stack_types[depth - 1];
+
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT, depth - 1);
+            _d_jit_emit_variable_code(translation, _D_X64_MOV_RCX_RAX,
+                                      variable_slot, values);
+            _d_jit_emit_code(buffer, _D_X64_MOV_BYTE_RCX);
+            _d_jit_emit_32(buffer,
+                           (int32_t) (variable_slot *
+                                      sizeof(struct d_dec_number) +
+                                      offsetof(struct d_dec_number,
+                                               is_floating)));
+            _d_jit_emit(buffer, &is_floating, 1);
+            _d_jit_emit_code(buffer, _D_X64_MOV_BYTE_RCX);
+            _d_jit_emit_32(buffer,
+                           (int32_t) (variable_slot *
+                                      sizeof(struct d_dec_number) +
+                                      offsetof(struct d_dec_number,
+                                               is_array)));
+            _d_jit_emit(buffer, &is_not_array, 1);
+
+            variable = _d_jit_get_variable(translation, variable_slot, 0);
+            variable->is_floating = is_floating;
+            break;
+
+        case D_OP_LOAD_LOCAL:
+            local_slot = (size_t) instruction->operand.local_slot;
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT,
+                                  bytecode->stack_size + local_slot);
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, depth);
+            translation->stack_types[depth] =
+                translation->local_types[local_slot];
+            ++(translation->stack_depth);
+            break;
+
+        case D_OP_STORE_LOCAL:
+            local_slot = (size_t) instruction->operand.local_slot;
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT, depth - 1);
+            _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX,
+                                  bytecode->stack_size + local_slot);
+            translation->local_types[local_slot] =
+                translation->stack_types[depth - 1];
+            break;
+
+        // Arrays are left to the virtual machine
+        case D_OP_MAKE_ARRAY:
+            return -1;
+
+
+        /* ═══ Conversions ═══ */
+
+        case D_OP_TO_FLOATING_INTEGER:
+        case D_OP_TO_FLOATING_ANY:
+            _d_jit_emit_to_floating(translation, depth - 1);
+            break;
+
+
+        /* ═══ Math functions ═══ */
+
+        case D_OP_CALL_FUNCTION:
+            _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_XMM0_SLOT, depth - 1);
+            _d_jit_emit_address(buffer, _D_X64_MOV_RAX_IMM64,
+                                (const void *) instruction->operand.function);
+            _d_jit_emit_code(buffer, _D_X64_CALL_RAX);
+            _d_jit_emit_slot_code(buffer, _D_X64_MOVSD_SLOT_XMM0, depth - 1);
+            break;
+
+
+        /* ═══ Arithmetic ═══ */
+
+        case D_OP_ADD_INTEGER:
+        case D_OP_SUB_INTEGER:
+        case D_OP_MUL_INTEGER:
+        case D_OP_DIV_INTEGER:
+        case D_OP_MOD_INTEGER:
+        case D_OP_POW_INTEGER:
+            _d_jit_emit_arithmetic(translation, "+-*/%^"[instruction->opcode -
+                                                         D_OP_ADD_INTEGER],
+                                   index);
+            break;
+
+        case D_OP_ADD_FLOATING:
+        case D_OP_SUB_FLOATING:
+        case D_OP_MUL_FLOATING:
+        case D_OP_DIV_FLOATING:
+        case D_OP_MOD_FLOATING:
+        case D_OP_POW_FLOATING:
+            _d_jit_emit_arithmetic(translation, "+-*/%^"[instruction->opcode -
+                                                         D_OP_ADD_FLOATING],
+                                   index);
+            break;
+
+        // The data types are known now, so the promotion rules are applied
+        // right away
+        case D_OP_ADD_ANY:
+        case D_OP_SUB_ANY:
+        case D_OP_MUL_ANY:
+        case D_OP_DIV_ANY:
+        case D_OP_MOD_ANY:
+        case D_OP_POW_ANY:
+            if(translation->stack_types[depth - 1] !=
+               translation->stack_types[depth - 2]) {
+                _d_jit_emit_to_floating(translation, depth - 1);
+                _d_jit_emit_to_floating(translation, depth - 2);
+            }
+
+            _d_jit_emit_arithmetic(translation, "+-*/%^"[instruction->opcode -
+                                                         D_OP_ADD_ANY],
+                                   index);
+            break;
+
+        case D_OP_NEG_INTEGER:
+        case D_OP_NEG_FLOATING:
+        case D_OP_NEG_ANY:
+            if(translation->stack_types[depth - 1]) {
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_RAX_SLOT, depth - 1);
+                _d_jit_emit_code(buffer, _D_X64_BTC_RAX_SIGN);
+                _d_jit_emit_slot_code(buffer, _D_X64_MOV_SLOT_RAX, depth - 1);
+            } else {
+                _d_jit_emit_slot_code(buffer, _D_X64_NEG_SLOT, depth - 1);
+            }
+            break;
+
+
+        default:
+            d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID, "jit.c",
+                                   "_d_jit_translate_instruction",
+                                   "the specified opcode is not supported");
+            return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Translates the given program, generating its native code.
+ *
+ * @param[in,out] translation The translation, whose working memory has
+ *                            been already reserved.
+ * @param[in] bytecode The program.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_jit_translate(
+    struct _d_jit_translation *translation,
+    const struct d_bytecode *bytecode
+)
+{
+    struct _d_jit_buffer *buffer = &(translation->buffer);
+
+    size_t guards_jump = 0;
+    size_t body_offset = 0;
+    size_t deopt_offset = 0;
+    size_t i = 0;
+    uint8_t is_floating = 0;
+    const uint8_t is_not_array = 0;
+    int32_t displacement = 0;
+
+
+    // Prologue, whose jump to the guards is patched later
+    _d_jit_emit_code(buffer, _D_X64_PROLOGUE);
+    _d_jit_emit_code(buffer, _D_X64_JMP_REL32);
+    guards_jump = buffer->size;
+    _d_jit_emit_32(buffer, 0);
+
+    translation->exit_offset = buffer->size;
+    _d_jit_emit_code(buffer, _D_X64_EPILOGUE);
+
+    deopt_offset = buffer->size;
+    _d_jit_emit_return(translation, D_JIT_GUARD_FAILED);
+
+
+    // Body
+    body_offset = buffer->size;
+
+    for(i = 0; i < bytecode->instruction_count; ++i) {
+        if(_d_jit_translate_instruction(translation, bytecode, i) != 0) {
+            return -1;
+        }
+    }
+
+    _d_jit_emit_code(buffer, _D_X64_XOR_EAX);
+    _d_jit_emit_jump(buffer, _D_X64_JMP_REL32, sizeof(_D_X64_JMP_REL32) - 1,
+                     translation->exit_offset);
+
+
+    // Guards
+    if(!buffer->failed) {
+        displacement = (int32_t) (buffer->size - guards_jump - 4);
+        memcpy(buffer->bytes + guards_jump, &displacement, 4);
+    }
+
+    for(i = 0; i < translation->variable_count; ++i) {
+
+        if(!translation->variables[i].is_guarded) {
+            continue;
+        }
+
+        is_floating = (uint8_t)
+            translation->variable_values[translation->variables[i].slot]
+                                                              .is_floating;
+
+        _d_jit_emit_variable_code(translation, _D_X64_CMP_BYTE_RCX,
+                                  translation->variables[i].slot,
+                                  is_floating);
+        _d_jit_emit(buffer, &is_floating, 1);
+        _d_jit_emit_jump(buffer, _D_X64_JNE_REL32,
+                         sizeof(_D_X64_JNE_REL32) - 1, deopt_offset);
+
+        // Nor may it hold an array now
+        _d_jit_emit_variable_code(translation, _D_X64_CMP_BYTE_RCX,
+                                  translation->variables[i].slot, is_array);
+        _d_jit_emit(buffer, &is_not_array, 1);
+        _d_jit_emit_jump(buffer, _D_X64_JNE_REL32,
+                         sizeof(_D_X64_JNE_REL32) - 1, deopt_offset);
+    }
+
+    _d_jit_emit_jump(buffer, _D_X64_JMP_REL32, sizeof(_D_X64_JMP_REL32) - 1,
+                     body_offset);
+
+
+    if(buffer->failed) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "jit.c",
+                               "_d_jit_translate",
+                               "'realloc' for the native code");
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+#endif
+
+
+/**
+ * @brief Implementation of jit.h/d_jit_is_supported
+ */
+int d_jit_is_supported(
+    void
+)
+{
+#if defined(__x86_64__)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+
+/**
+ * @brief Implementation of jit.h/d_jit_compile
+ */
+int d_jit_compile(
+    struct d_context *context,
+    const struct d_bytecode *bytecode,
+    struct d_jit_code **code
+)
+{
+#if defined(__x86_64__)
+
+    struct _d_jit_translation translation;
+    void *memory = MAP_FAILED;
+    size_t memory_size = 0;
+    int return_value = -1;
+
+
+    if(context == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "jit.c",
+                               "d_jit_compile", "'context'");
+        return -1;
+    }
+
+    if(bytecode == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "jit.c",
+                               "d_jit_compile", "'bytecode'");
+        return -1;
+    }
+
+    if(code == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "jit.c",
+                               "d_jit_compile", "'code'");
+        return -1;
+    }
+
+
+    memset(&translation, 0, sizeof(struct _d_jit_translation));
+
+    translation.variable_values =
+        d_symbol_table_get_variables(context->symbol_table);
+    translation.variables_frame_slot = bytecode->stack_size +
+                                       bytecode->local_count;
+
+    // A program uses at most as many variables as instructions it has
+    translation.stack_types = malloc((bytecode->stack_size + 1) * sizeof(int));
+    translation.local_types = malloc((bytecode->local_count + 1) *
+                                     sizeof(int));
+    translation.variables = malloc((bytecode->instruction_count + 1) *
+                                   sizeof(struct _d_jit_variable));
+    *code = malloc(sizeof(struct d_jit_code));
+
+    if(translation.stack_types == NULL || translation.local_types == NULL ||
+       translation.variables == NULL || *code == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "jit.c",
+                               "d_jit_compile",
+                               "'malloc' for the translation");
+        goto end;
+    }
+
+    if(_d_jit_translate(&translation, bytecode) != 0) {
+        goto end;
+    }
+
+
+    // The code is written while the memory is writable, and then it becomes
+    // executable instead
+    memory_size = translation.buffer.size;
+
+    if((memory = mmap(NULL, memory_size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) == MAP_FAILED) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "jit.c",
+                               "d_jit_compile", "'mmap' for the native code");
+        goto end;
+    }
+
+    memcpy(memory, translation.buffer.bytes, memory_size);
+
+    if(mprotect(memory, memory_size, PROT_READ | PROT_EXEC) != 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "jit.c",
+                               "d_jit_compile",
+                               "'mprotect' for the native code");
+        munmap(memory, memory_size);
+        goto end;
+    }
+
+
+    (*code)->memory = memory;
+    (*code)->memory_size = memory_size;
+    (*code)->frame_size = translation.variables_frame_slot + 1;
+    (*code)->result_is_floating = translation.stack_types[0];
+    return_value = 0;
+
+
+end:
+    if(return_value != 0) {
+        free(*code);
+        *code = NULL;
+    }
+
+    free(translation.buffer.bytes);
+    free(translation.stack_types);
+    free(translation.local_types);
+    free(translation.variables);
+
+
+    return return_value;
+
+#else
+
+    d_errors_internal_show(4, D_ERR_INTERN_LOGIC, "jit.c", "d_jit_compile",
+                           "native code is not supported on this platform");
+    return -1;
+
+#endif
+}
+
+
+/**
+ * @brief Implementation of jit.h/d_jit_execute
+ */
+int d_jit_execute(
+    struct d_context *context,
+    const struct d_jit_code *code,
+    const struct d_bytecode *bytecode,
+    int line,
+    struct d_dec_number *result
+)
+{
+    uint64_t local_frame[D_JIT_LOCAL_FRAME_SIZE];
+    uint64_t *frame = local_frame;
+    _d_jit_function function = NULL;
+
+    int status = 0;
+
+
+    if(code == NULL || bytecode == NULL || result == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "jit.c",
+                               "d_jit_execute",
+                               "'code', 'bytecode' or 'result'");
+        return -1;
+    }
+
+
+    if(code->frame_size > D_JIT_LOCAL_FRAME_SIZE) {
+
+        if((frame = malloc(code->frame_size * sizeof(uint64_t))) == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "jit.c",
+                                   "d_jit_execute", "'malloc' for the frame");
+            return -1;
+        }
+    }
+
+
+    frame[code->frame_size - 1] = (uint64_t) (uintptr_t)
+        d_symbol_table_get_variables(context->symbol_table);
+
+    // ISO C does not allow converting between data and function pointers,
+    // but POSIX does
+    memcpy(&function, &(code->memory), sizeof(function));
+    status = function(frame);
+
+
+    if(status == 0) {
+        result->is_floating = (uint8_t) code->result_is_floating;
+        result->is_array = 0;
+        memcpy(&(result->values), &(frame[0]), sizeof(result->values));
+    }
+
+    else if(status == D_JIT_GUARD_FAILED) {
+        status = D_JIT_TYPES_CHANGED;
+    }
+
+    else {
+        d_errors_parse_show(context, 3, D_ERR_SEM_DIVISION_BY_ZERO,
+                            (size_t) line,
+                            (size_t) bytecode->instructions[status - 1]
+                                                .operand.column);
+        status = 1;
+    }
+
+    if(frame != local_frame) {
+        free(frame);
+    }
+
+
+    return status;
+}
+
+
+/**
+ * @brief Implementation of jit.h/d_jit_free
+ */
+int d_jit_free(
+    struct d_jit_code *code
+)
+{
+    if(code == NULL) {
+        return 0;
+    }
+
+#if defined(__x86_64__)
+    munmap(code->memory, code->memory_size);
+#endif
+
+    free(code);
+
+
+    return 0;
+}
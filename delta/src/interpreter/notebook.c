@@ -0,0 +1,1732 @@
+/**
+ * @file notebook.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/notebook.h
+ */
+
+
+// st_mtim
+#define _DEFAULT_SOURCE
+
+
+#include "interpreter/notebook.h"
+
+#include "analyzers/lexical.h"
+#include "analyzers/synsem.h"
+#include "common/errors.h"
+#include "common/lexical_comp.h"
+
+#include "lib/uthash.h"
+
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+// memchr, memcmp, memcpy, strlen
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+/** Written right after the version, so that files that come from machines
+    with another byte order are told apart. */
+#define D_NOTEBOOK_BYTE_ORDER_MARK UINT32_C(0x01020304)
+
+/** How many opcodes there are (see interpreter/bytecode.h). */
+#define D_NOTEBOOK_OPCODE_COUNT (D_OP_NEG_ANY + 1)
+
+/** Size in bytes of each instruction of a program in a file: its opcode,
+    and an 8 bytes operand. */
+#define D_NOTEBOOK_INSTRUCTION_SIZE 9
+
+
+/** Which bytes the files of compiled notebooks start with. */
+const char D_NOTEBOOK_MAGIC[8] = "DELTAC\n";
+
+
+/**
+ * @brief Kinds of names that programs may use.
+ */
+enum d_notebook_name_kind {
+    /** A math constant. */
+    D_NOTEBOOK_NAME_CONSTANT,
+    /** A variable. */
+    D_NOTEBOOK_NAME_VARIABLE,
+    /** A math function. */
+    D_NOTEBOOK_NAME_FUNCTION,
+
+    /** How many kinds there are. */
+    D_NOTEBOOK_NAME_KIND_COUNT
+};
+
+
+/**
+ * @brief The header of compiled notebooks.
+ *
+ * @details
+ *  It is followed by the table of names, in which each name is written as
+ *  its kind (uint8_t), its length (uint32_t), and its characters along with
+ *  a '\0'.
+ *
+ *  Then, each line of the source is written as its length (uint32_t), its
+ *  characters, and whether it has a program (uint8_t). A program is written
+ *  as its echo (uint8_t), its stack size, its amount of local slots and its
+ *  amount of names (uint32_t), the indices of those names in the table
+ *  (uint32_t), its amount of instructions (uint32_t), and its instructions.
+ *
+ *  Operands of instructions that use names are the indices of the names in
+ *  the list of the program, rather than in the table, so that looking them
+ *  up does not depend on how many names the table has.
+ */
+struct _d_notebook_header {
+    /** D_NOTEBOOK_MAGIC. */
+    char magic[8];
+    /** D_NOTEBOOK_VERSION. */
+    uint32_t version;
+    /** D_NOTEBOOK_BYTE_ORDER_MARK. */
+    uint32_t byte_order_mark;
+    /** D_NOTEBOOK_OPCODE_COUNT, as a last line of defense against programs
+        from other builds. */
+    uint32_t opcode_count;
+    /** 0. */
+    uint32_t reserved;
+
+    /** Size of the source, when it was compiled. */
+    uint64_t source_size;
+    /** Modification time of the source, when it was compiled: seconds... */
+    int64_t source_seconds;
+    /** ... and nanoseconds. */
+    int64_t source_nanoseconds;
+
+    /** How many names the table has. */
+    uint64_t name_count;
+    /** How many lines the source has. */
+    uint64_t statement_count;
+};
+
+/** Fails to compile if the header does not span 64 bytes, with no padding
+    (its layout is part of the format). */
+typedef char _d_notebook_header_size_check[
+    sizeof(struct _d_notebook_header) == 64 ? 1 : -1
+];
+
+
+/**
+ * @brief A buffer in which a compiled notebook is written.
+ */
+struct _d_notebook_buffer {
+    /** The bytes. */
+    unsigned char *data;
+    /** How many bytes have been written. */
+    size_t length;
+    /** How many bytes fit. */
+    size_t capacity;
+};
+
+
+/**
+ * @brief A name in the table of a compiled notebook that is being written.
+ */
+struct _d_notebook_writer_name {
+    /** The name, which belongs to the symbol table of the context in which
+        the notebook is analyzed. */
+    const char *lexeme;
+    /** Index of the name in the table. */
+    uint32_t index;
+
+    /** Makes this structure hashable by the library. */
+    UT_hash_handle hh;
+};
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_writer
+ */
+struct d_notebook_writer {
+    /** The source of the notebook. */
+    const char *source;
+    /** The length of the source. */
+    size_t source_length;
+    /** Where the lines of the source that have not been added yet start. */
+    size_t source_offset;
+
+    /** The names in the table, in a hash table by their lexemes (the
+        library requires it to be a pointer to its entry type, initialized to
+        NULL). */
+    struct _d_notebook_writer_name *names;
+    /** The table of names, as it is written. */
+    struct _d_notebook_buffer name_table;
+    /** How many names the table has. */
+    uint32_t name_count;
+
+    /** The lines, as they are written. */
+    struct _d_notebook_buffer statements;
+    /** How many lines there are. */
+    uint64_t statement_count;
+
+    /** The entries that the expression of the line being added uses, in the
+        order in which they appear in it. */
+    const struct d_symbol_table_entry **line_names;
+    /** How many entries there are. */
+    size_t line_name_count;
+    /** How many entries fit. */
+    size_t line_name_capacity;
+
+    /** If memory ran out, in which case the notebook is not written. */
+    int has_failed;
+};
+
+
+/**
+ * @brief A name in the table of a compiled notebook that has been opened.
+ */
+struct _d_notebook_name {
+    /** The name, '\0' terminated, right where it is in the file. */
+    const char *lexeme;
+    /** Lexical component that its entry must have (D_LC_XYZ). */
+    int lexical_component;
+
+    /** The entry of the name in the symbol table, if it has been looked up
+        in the current generation. */
+    struct d_symbol_table_entry *entry;
+    /** Generation in which "entry" was looked up. */
+    size_t generation;
+};
+
+
+/**
+ * @brief Where the file of a compiled notebook is being read.
+ */
+struct _d_notebook_cursor {
+    /** The next byte to be read. */
+    const unsigned char *position;
+    /** The end of the file. */
+    const unsigned char *end;
+};
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook
+ */
+struct d_notebook {
+    /** The file, which is mapped into memory. */
+    const unsigned char *data;
+    /** The size of the file. */
+    size_t size;
+
+    /** The table of names. */
+    struct _d_notebook_name *names;
+    /** How many names the table has. */
+    size_t name_count;
+
+    /** Where the next line starts. */
+    struct _d_notebook_cursor next_statement;
+    /** How many lines there are. */
+    size_t statement_count;
+    /** How many lines have been handed. */
+    size_t handed_count;
+
+    /** Names that have been looked up in a previous generation must be
+        looked up again. A new generation starts whenever a line is not run
+        as it was compiled, as analyzing it may change the symbol table in
+        any way. */
+    size_t generation;
+    /** If the last handed line has been run as it was compiled. */
+    int was_resolved;
+
+    /** Where the instructions of the last resolved program are written, as
+        many as the longest program has. */
+    struct d_bytecode_instruction *instructions;
+    /** Where the indices of the names of the last resolved program are
+        read, as many as the program with most names has. */
+    uint32_t *line_names;
+};
+
+
+/**
+ * @brief Appends the given bytes to the given buffer.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in] data The bytes.
+ * @param[in] length How many bytes there are.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_notebook_append(
+    struct _d_notebook_buffer *buffer,
+    const void *data,
+    size_t length
+)
+{
+    unsigned char *new_data = NULL;
+    size_t new_capacity = buffer->capacity;
+
+
+    if(buffer->length + length > buffer->capacity) {
+
+        while(new_capacity < buffer->length + length) {
+            new_capacity = 2 * new_capacity + 4096;
+        }
+
+        if((new_data = realloc(buffer->data, new_capacity)) == NULL) {
+            return -1;
+        }
+
+        buffer->data = new_data;
+        buffer->capacity = new_capacity;
+    }
+
+    memcpy(buffer->data + buffer->length, data, length);
+    buffer->length += length;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Adds the lines of the source, up to the given offset, as lines that
+ *        must be analyzed.
+ *
+ * @param[in,out] writer The compiled notebook.
+ * @param[in] end Where the last line to be added ends in the source.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_notebook_writer_add_lines(
+    struct d_notebook_writer *writer,
+    size_t end
+)
+{
+    const char *start = NULL;
+    const char *line_end = NULL;
+    size_t line_length = 0;
+    uint32_t length = 0;
+    uint8_t has_program = 0;
+
+
+    while(writer->source_offset < end) {
+
+        // Lines are split just as the lexical analyzer does
+        start = writer->source + writer->source_offset;
+        line_end = memchr(start, '\n', end - writer->source_offset);
+        line_length = line_end != NULL ? (size_t) (line_end - start) + 1 :
+                                         end - writer->source_offset;
+
+        if(line_length > UINT32_MAX) {
+            return -1;
+        }
+
+        length = (uint32_t) line_length;
+
+        if(_d_notebook_append(&(writer->statements), &length,
+                              sizeof(length)) != 0 ||
+           _d_notebook_append(&(writer->statements), start, length) != 0 ||
+           _d_notebook_append(&(writer->statements), &has_program,
+                              sizeof(has_program)) != 0) {
+            return -1;
+        }
+
+        writer->source_offset += length;
+        ++writer->statement_count;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Gathers the entries that the given expression uses, in the order in
+ *        which they appear in it.
+ *
+ * @details
+ *  Each entry is gathered once. The lexical analyzer creates variables in
+ *  this very order, so the compiled notebook does so too.
+ *
+ * @param[in,out] writer The compiled notebook.
+ * @param[in] node The root of the expression's AST.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_notebook_writer_gather(
+    struct d_notebook_writer *writer,
+    const struct d_ast_node *node
+)
+{
+    const struct d_symbol_table_entry *entry = NULL;
+    const struct d_symbol_table_entry **new_names = NULL;
+    size_t new_capacity = 0;
+    size_t i = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_LITERAL:
+            return 0;
+
+        case D_AST_CONSTANT:
+        case D_AST_VARIABLE:
+            entry = node->attribute.st_entry;
+            break;
+
+        case D_AST_ASSIGNMENT:
+        case D_AST_FUNCTION_CALL:
+            entry = node->attribute.unary.st_entry;
+            break;
+
+        case D_AST_OPERATION:
+            return _d_notebook_writer_gather(writer,
+                                             node->attribute.binary.left) ||
+                   _d_notebook_writer_gather(writer,
+                                             node->attribute.binary.right);
+
+        case D_AST_NEGATION:
+            return _d_notebook_writer_gather(writer,
+                                             node->attribute.operand);
+
+        case D_AST_ARRAY:
+
+            for(i = 0; i < node->attribute.array.count; ++i) {
+
+                if(_d_notebook_writer_gather(
+                       writer, node->attribute.array.elements[i]) != 0) {
+                    return -1;
+                }
+            }
+
+            return 0;
+
+        default:
+            return -1;
+    }
+
+
+    for(i = 0; i < writer->line_name_count &&
+               writer->line_names[i] != entry; ++i);
+
+    if(i == writer->line_name_count) {
+
+        if(writer->line_name_count == writer->line_name_capacity) {
+
+            new_capacity = 2 * writer->line_name_capacity + 16;
+
+            if((new_names = realloc(writer->line_names, new_capacity *
+                                    sizeof(writer->line_names[0])))
+               == NULL) {
+                return -1;
+            }
+
+            writer->line_names = new_names;
+            writer->line_name_capacity = new_capacity;
+        }
+
+        writer->line_names[writer->line_name_count++] = entry;
+    }
+
+    // The name of an assignment or a call comes before its operand
+    if(node->type == D_AST_ASSIGNMENT || node->type == D_AST_FUNCTION_CALL) {
+        return _d_notebook_writer_gather(writer,
+                                         node->attribute.unary.operand);
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns the operand of the given instruction, as it is written.
+ *
+ * @param[in] writer The compiled notebook, whose gathered entries are those
+ *                   of the instruction's program.
+ * @param[in] instruction The instruction.
+ * @param[out] operand The operand.
+ *
+ * @return 0 if successful, any other value if the instruction uses anything
+ *         but the gathered entries.
+ */
+int _d_notebook_writer_encode(
+    const struct d_notebook_writer *writer,
+    const struct d_bytecode_instruction *instruction,
+    int64_t *operand
+)
+{
+    const struct d_symbol_table_entry *entry = NULL;
+    size_t i = 0;
+
+
+    *operand = 0;
+
+    switch(instruction->opcode) {
+
+        case D_OP_PUSH_INTEGER:
+            *operand = instruction->operand.integer;
+            return 0;
+
+        case D_OP_PUSH_FLOATING:
+            memcpy(operand, &(instruction->operand.floating),
+                   sizeof(*operand));
+            return 0;
+
+        case D_OP_LOAD_LOCAL:
+        case D_OP_STORE_LOCAL:
+            *operand = instruction->operand.local_slot;
+            return 0;
+
+        // The amount of elements is written in the highest half, and the
+        // column in the lowest one
+        case D_OP_MAKE_ARRAY:
+            *operand = (int64_t) (
+                ((uint64_t) instruction->operand.array.element_count << 32) |
+                (uint32_t) instruction->operand.array.column
+            );
+            return 0;
+
+        case D_OP_DIV_INTEGER:
+        case D_OP_MOD_INTEGER:
+        case D_OP_ADD_FLOATING:
+        case D_OP_SUB_FLOATING:
+        case D_OP_MUL_FLOATING:
+        case D_OP_DIV_FLOATING:
+        case D_OP_MOD_FLOATING:
+        case D_OP_POW_FLOATING:
+        case D_OP_ADD_ANY:
+        case D_OP_SUB_ANY:
+        case D_OP_MUL_ANY:
+        case D_OP_DIV_ANY:
+        case D_OP_MOD_ANY:
+        case D_OP_POW_ANY:
+            *operand = instruction->operand.column;
+            return 0;
+
+        case D_OP_LOAD_CONSTANT:
+        case D_OP_LOAD_VARIABLE:
+        case D_OP_STORE_VARIABLE:
+        case D_OP_CALL_FUNCTION:
+            break;
+
+        default:
+            return 0;
+    }
+
+
+    // Programs reference constants by their entries, variables by their
+    // slots, and math functions by their implementations
+    for(i = 0; i < writer->line_name_count; ++i) {
+
+        entry = writer->line_names[i];
+
+        if((instruction->opcode == D_OP_LOAD_CONSTANT &&
+            entry == instruction->operand.st_entry) ||
+
+           ((instruction->opcode == D_OP_LOAD_VARIABLE ||
+             instruction->opcode == D_OP_STORE_VARIABLE) &&
+            entry->lexical_component == D_LC_IDENTIFIER_VARIABLE &&
+            entry->attribute.variable_slot ==
+            instruction->operand.variable_slot) ||
+
+           (instruction->opcode == D_OP_CALL_FUNCTION &&
+            entry->lexical_component == D_LC_IDENTIFIER_FUNCTION &&
+            entry->attribute.function == instruction->operand.function)) {
+
+            *operand = (int64_t) i;
+            return 0;
+        }
+    }
+
+
+    return 1;
+}
+
+
+/**
+ * @brief Returns the index of the given entry's name in the table, adding it
+ *        if it is not there yet.
+ *
+ * @param[in,out] writer The compiled notebook.
+ * @param[in] entry The entry.
+ * @param[out] index The index.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_notebook_writer_intern(
+    struct d_notebook_writer *writer,
+    const struct d_symbol_table_entry *entry,
+    uint32_t *index
+)
+{
+    struct _d_notebook_writer_name *name = NULL;
+    uint32_t length = (uint32_t) strlen(entry->lexeme);
+    uint8_t kind = 0;
+
+
+    HASH_FIND(hh, writer->names, entry->lexeme, length, name);
+
+    if(name != NULL) {
+        *index = name->index;
+        return 0;
+    }
+
+
+    kind = entry->lexical_component == D_LC_IDENTIFIER_CONSTANT ?
+               D_NOTEBOOK_NAME_CONSTANT :
+           entry->lexical_component == D_LC_IDENTIFIER_FUNCTION ?
+               D_NOTEBOOK_NAME_FUNCTION : D_NOTEBOOK_NAME_VARIABLE;
+
+    if((name = malloc(sizeof(struct _d_notebook_writer_name))) == NULL) {
+        return -1;
+    }
+
+    // The '\0' is written too, so that names can be looked up right where
+    // they are in the file
+    if(_d_notebook_append(&(writer->name_table), &kind, sizeof(kind)) != 0 ||
+       _d_notebook_append(&(writer->name_table), &length, sizeof(length))
+       != 0 ||
+       _d_notebook_append(&(writer->name_table), entry->lexeme, length + 1)
+       != 0) {
+
+        free(name);
+        return -1;
+    }
+
+    name->lexeme = entry->lexeme;
+    name->index = writer->name_count++;
+    HASH_ADD_KEYPTR(hh, writer->names, name->lexeme, length, name);
+
+    *index = name->index;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Writes the given compiled notebook into a file.
+ *
+ * @details
+ *  The notebook is written into a temporary file, which then replaces the
+ *  given one at once.
+ *
+ * @param[in] writer The compiled notebook.
+ * @param[in] header The header of the notebook.
+ * @param[in] path The path of the file.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_notebook_write(
+    const struct d_notebook_writer *writer,
+    const struct _d_notebook_header *header,
+    const char *path
+)
+{
+    const void *parts[3];
+    size_t lengths[3];
+    char *temporary_path = NULL;
+    size_t path_length = strlen(path);
+    int file_descriptor = -1;
+    ssize_t written = 0;
+    size_t offset = 0;
+    size_t i = 0;
+    int result = 0;
+
+
+    parts[0] = header;
+    lengths[0] = sizeof(struct _d_notebook_header);
+    parts[1] = writer->name_table.data;
+    lengths[1] = writer->name_table.length;
+    parts[2] = writer->statements.data;
+    lengths[2] = writer->statements.length;
+
+    // Each process writes its own temporary file
+    if((temporary_path = malloc(path_length + 32)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "_d_notebook_write",
+                               "'malloc' for the temporary path");
+        return -1;
+    }
+
+    snprintf(temporary_path, path_length + 32, "%s.%ld.tmp", path,
+             (long) getpid());
+
+    if((file_descriptor = open(temporary_path,
+                               O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+
+        d_errors_internal_show(3, D_ERR_USER_IO_FILE_UNWRITABLE, "notebook.c",
+                               "_d_notebook_write");
+        free(temporary_path);
+        return -1;
+    }
+
+
+    for(i = 0; i < 3 && result == 0; ++i) {
+
+        for(offset = 0; offset < lengths[i]; offset += (size_t) written) {
+
+            written = write(file_descriptor,
+                            (const unsigned char *) parts[i] + offset,
+                            lengths[i] - offset);
+
+            if(written < 0 && errno == EINTR) {
+                written = 0;
+            }
+
+            else if(written < 0) {
+                result = -1;
+                break;
+            }
+        }
+    }
+
+    if(close(file_descriptor) != 0 || result != 0 ||
+       rename(temporary_path, path) != 0) {
+
+        d_errors_internal_show(3, D_ERR_USER_IO_FILE_UNWRITABLE, "notebook.c",
+                               "_d_notebook_write");
+        unlink(temporary_path);
+        result = -1;
+    }
+
+    free(temporary_path);
+
+
+    return result;
+}
+
+
+/**
+ * @brief Reads the given amount of bytes from the given cursor.
+ *
+ * @param[in,out] cursor The cursor.
+ * @param[out] data Where the bytes are copied, or NULL if they are just
+ *                  skipped.
+ * @param[in] length How many bytes there are.
+ *
+ * @return 0 if successful, any other value if the file ends before.
+ */
+int _d_notebook_read(
+    struct _d_notebook_cursor *cursor,
+    void *data,
+    size_t length
+)
+{
+    if((size_t) (cursor->end - cursor->position) < length) {
+        return -1;
+    }
+
+    if(data != NULL) {
+        memcpy(data, cursor->position, length);
+    }
+
+    cursor->position += length;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Checks the program at the given cursor, which is skipped.
+ *
+ * @details
+ *  Every name, local slot and opcode must be within bounds, and so must the
+ *  stack while running the program, which must leave a single value in it.
+ *  Therefore, the virtual machine may run any program that passes the
+ *  check.
+ *
+ * @param[in] notebook The notebook, whose table of names has been read.
+ * @param[in,out] cursor The cursor.
+ * @param[out] instruction_count How many instructions the program has.
+ * @param[out] name_count How many names the program has.
+ *
+ * @return 0 if the program is valid, any other value otherwise.
+ */
+int _d_notebook_check_program(
+    const struct d_notebook *notebook,
+    struct _d_notebook_cursor *cursor,
+    uint32_t *instruction_count,
+    uint32_t *name_count
+)
+{
+    const unsigned char *names = NULL;
+    uint8_t echo = 0;
+    uint32_t stack_size = 0;
+    uint32_t local_count = 0;
+    uint32_t index = 0;
+    uint8_t opcode = 0;
+    int64_t operand = 0;
+    int expected_component = 0;
+    size_t depth = 0;
+    size_t popped = 0;
+    size_t pushed = 0;
+    uint32_t i = 0;
+
+
+    if(_d_notebook_read(cursor, &echo, sizeof(echo)) != 0 || echo > 1 ||
+       _d_notebook_read(cursor, &stack_size, sizeof(stack_size)) != 0 ||
+       _d_notebook_read(cursor, &local_count, sizeof(local_count)) != 0 ||
+       _d_notebook_read(cursor, name_count, sizeof(*name_count)) != 0) {
+        return -1;
+    }
+
+    names = cursor->position;
+
+    for(i = 0; i < *name_count; ++i) {
+
+        if(_d_notebook_read(cursor, &index, sizeof(index)) != 0 ||
+           index >= notebook->name_count) {
+            return -1;
+        }
+    }
+
+    if(_d_notebook_read(cursor, instruction_count,
+                        sizeof(*instruction_count)) != 0 ||
+       *instruction_count == 0 ||
+       stack_size > *instruction_count || local_count > *instruction_count) {
+        return -1;
+    }
+
+
+    for(i = 0; i < *instruction_count; ++i) {
+
+        if(_d_notebook_read(cursor, &opcode, sizeof(opcode)) != 0 ||
+           _d_notebook_read(cursor, &operand, sizeof(operand)) != 0 ||
+           opcode >= D_NOTEBOOK_OPCODE_COUNT) {
+            return -1;
+        }
+
+        popped = 0;
+        pushed = 0;
+        expected_component = 0;
+
+        switch(opcode) {
+
+            case D_OP_PUSH_INTEGER:
+            case D_OP_PUSH_FLOATING:
+                pushed = 1;
+                break;
+
+            case D_OP_LOAD_CONSTANT:
+                expected_component = D_LC_IDENTIFIER_CONSTANT;
+                pushed = 1;
+                break;
+
+            case D_OP_LOAD_VARIABLE:
+                expected_component = D_LC_IDENTIFIER_VARIABLE;
+                pushed = 1;
+                break;
+
+            case D_OP_STORE_VARIABLE:
+                expected_component = D_LC_IDENTIFIER_VARIABLE;
+                popped = pushed = 1;
+                break;
+
+            case D_OP_CALL_FUNCTION:
+                expected_component = D_LC_IDENTIFIER_FUNCTION;
+                popped = pushed = 1;
+                break;
+
+            case D_OP_LOAD_LOCAL:
+            case D_OP_STORE_LOCAL:
+                if(operand < 0 || operand >= (int64_t) local_count) {
+                    return -1;
+                }
+
+                popped = opcode == D_OP_STORE_LOCAL;
+                pushed = 1;
+                break;
+
+            case D_OP_MAKE_ARRAY:
+                if(operand < 1 || (uint64_t) operand > depth) {
+                    return -1;
+                }
+
+                popped = (size_t) operand;
+                pushed = 1;
+                break;
+
+            case D_OP_TO_FLOATING_INTEGER:
+            case D_OP_TO_FLOATING_ANY:
+            case D_OP_NEG_INTEGER:
+            case D_OP_NEG_FLOATING:
+            case D_OP_NEG_ANY:
+                popped = pushed = 1;
+                break;
+
+            // The rest are binary operations
+            default:
+                popped = 2;
+                pushed = 1;
+                break;
+        }
+
+        // Names must be of the kind that the instruction expects
+        if(expected_component != 0) {
+
+            if(operand < 0 || operand >= (int64_t) *name_count) {
+                return -1;
+            }
+
+            memcpy(&index, names + operand * sizeof(index), sizeof(index));
+
+            if(notebook->names[index].lexical_component !=
+               expected_component) {
+                return -1;
+            }
+        }
+
+        if(depth < popped || depth - popped + pushed > stack_size) {
+            return -1;
+        }
+
+        depth = depth - popped + pushed;
+    }
+
+
+    return depth == 1 ? 0 : -1;
+}
+
+
+/**
+ * @brief Checks the given compiled notebook, from its table of names on.
+ *
+ * @details
+ *  The table of names is read, and the buffers that resolving programs
+ *  needs are allocated. On return, the cursor of the next line points to
+ *  the first one.
+ *
+ * @param[in,out] notebook The notebook.
+ * @param[in] header Its header.
+ *
+ * @return 0 if the notebook is valid, 1 if it is not, any other value if
+ *         failed.
+ */
+int _d_notebook_check(
+    struct d_notebook *notebook,
+    const struct _d_notebook_header *header
+)
+{
+    struct _d_notebook_cursor cursor;
+    uint8_t kind = 0;
+    uint32_t length = 0;
+    uint8_t has_program = 0;
+    uint32_t instruction_count = 0;
+    uint32_t name_count = 0;
+    uint32_t max_instruction_count = 0;
+    uint32_t max_name_count = 0;
+    uint64_t i = 0;
+
+
+    cursor.position = notebook->data + sizeof(struct _d_notebook_header);
+    cursor.end = notebook->data + notebook->size;
+
+    // Each name and line spans several bytes, so their amounts are bounded
+    // by the size of the file before allocating anything
+    if(header->name_count > notebook->size ||
+       header->statement_count > notebook->size) {
+        return 1;
+    }
+
+    notebook->name_count = (size_t) header->name_count;
+    notebook->statement_count = (size_t) header->statement_count;
+
+    if(notebook->name_count > 0 &&
+       (notebook->names = calloc(notebook->name_count,
+                                 sizeof(struct _d_notebook_name))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "_d_notebook_check", "'calloc' for the names");
+        return -1;
+    }
+
+
+    for(i = 0; i < notebook->name_count; ++i) {
+
+        if(_d_notebook_read(&cursor, &kind, sizeof(kind)) != 0 ||
+           kind >= D_NOTEBOOK_NAME_KIND_COUNT ||
+           _d_notebook_read(&cursor, &length, sizeof(length)) != 0 ||
+           length == 0 ||
+           (size_t) (cursor.end - cursor.position) <= length ||
+           memchr(cursor.position, '\0', length) != NULL ||
+           cursor.position[length] != '\0') {
+            return 1;
+        }
+
+        notebook->names[i].lexeme = (const char *) cursor.position;
+        notebook->names[i].lexical_component =
+            kind == D_NOTEBOOK_NAME_CONSTANT ? D_LC_IDENTIFIER_CONSTANT :
+            kind == D_NOTEBOOK_NAME_FUNCTION ? D_LC_IDENTIFIER_FUNCTION :
+                                               D_LC_IDENTIFIER_VARIABLE;
+
+        cursor.position += length + 1;
+    }
+
+    notebook->next_statement = cursor;
+
+
+    for(i = 0; i < notebook->statement_count; ++i) {
+
+        if(_d_notebook_read(&cursor, &length, sizeof(length)) != 0 ||
+           length == 0 || _d_notebook_read(&cursor, NULL, length) != 0 ||
+           _d_notebook_read(&cursor, &has_program, sizeof(has_program)) != 0 ||
+           has_program > 1) {
+            return 1;
+        }
+
+        if(has_program) {
+
+            if(_d_notebook_check_program(notebook, &cursor,
+                                         &instruction_count, &name_count)
+               != 0) {
+                return 1;
+            }
+
+            if(instruction_count > max_instruction_count) {
+                max_instruction_count = instruction_count;
+            }
+
+            if(name_count > max_name_count) {
+                max_name_count = name_count;
+            }
+        }
+    }
+
+    if(cursor.position != cursor.end) {
+        return 1;
+    }
+
+
+    if((max_instruction_count > 0 &&
+        (notebook->instructions =
+         malloc(max_instruction_count *
+                sizeof(struct d_bytecode_instruction))) == NULL) ||
+       (max_name_count > 0 &&
+        (notebook->line_names = malloc(max_name_count * sizeof(uint32_t)))
+        == NULL)) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "_d_notebook_check",
+                               "'malloc' for the programs");
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_compile
+ */
+int d_notebook_compile(
+    const char *path
+)
+{
+    struct d_notebook_writer writer;
+    struct _d_notebook_header header;
+    struct d_context scratch;
+    struct _d_notebook_writer_name *name = NULL;
+    struct _d_notebook_writer_name *tmp = NULL;
+    struct stat source_status;
+    char *compiled_path = NULL;
+    char *source = NULL;
+    int file_descriptor = -1;
+    size_t length = 0;
+    ssize_t read_count = 0;
+    int result = 0;
+
+
+    if(path == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_compile", "'path'");
+        return -1;
+    }
+
+    if((compiled_path = d_notebook_get_compiled_path(path)) == NULL) {
+
+        d_errors_internal_show(3, D_ERR_USER_IO_NOT_A_NOTEBOOK, "notebook.c",
+                               "d_notebook_compile");
+        return -1;
+    }
+
+
+    // The whole source is read at once, as its lines are added right from
+    // where they are
+    if((file_descriptor = open(path, O_RDONLY)) < 0 ||
+       fstat(file_descriptor, &source_status) != 0 ||
+       !S_ISREG(source_status.st_mode)) {
+
+        d_errors_internal_show(3, D_ERR_USER_IO_FILE_INACCESSIBLE,
+                               "notebook.c", "d_notebook_compile");
+        if(file_descriptor >= 0) {
+            close(file_descriptor);
+        }
+        free(compiled_path);
+        return -1;
+    }
+
+    if((source = malloc((size_t) source_status.st_size + 1)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_compile",
+                               "'malloc' for the source");
+        close(file_descriptor);
+        free(compiled_path);
+        return -1;
+    }
+
+    while(length < (size_t) source_status.st_size) {
+
+        read_count = read(file_descriptor, source + length,
+                          (size_t) source_status.st_size - length);
+
+        if(read_count < 0 && errno == EINTR) {
+            continue;
+        }
+
+        if(read_count <= 0) {
+            break;
+        }
+
+        length += (size_t) read_count;
+    }
+
+    close(file_descriptor);
+
+
+    memset(&writer, 0, sizeof(struct d_notebook_writer));
+    writer.source = source;
+    writer.source_length = length;
+
+    // The notebook is analyzed on its own, with a workspace that only has
+    // the built-ins, and without showing any errors
+    if(d_context_initialize(&scratch, D_CONTEXT_MODE_EMBEDDED) != 0) {
+
+        free(source);
+        free(compiled_path);
+        return -1;
+    }
+
+    scratch.are_errors_hidden = 1;
+
+    if(d_lexical_analyzer_new_string(&scratch, source, length) != 0 ||
+       d_synsem_analyzer_compile(&scratch, &writer) != 0) {
+        result = -1;
+    }
+
+    while(!scratch.is_stdin) {
+        d_lexical_analyzer_pop_file(&scratch);
+    }
+
+    // Lines after the last one that has been compiled are kept as they are
+    if(result == 0 &&
+       _d_notebook_writer_add_lines(&writer, writer.source_length) != 0) {
+        writer.has_failed = 1;
+    }
+
+
+    if(result == 0 && writer.has_failed) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_compile",
+                               "'realloc' for the compiled notebook");
+        result = -1;
+    }
+
+    if(result == 0) {
+
+        memset(&header, 0, sizeof(struct _d_notebook_header));
+        memcpy(header.magic, D_NOTEBOOK_MAGIC, sizeof(header.magic));
+        header.version = D_NOTEBOOK_VERSION;
+        header.byte_order_mark = D_NOTEBOOK_BYTE_ORDER_MARK;
+        header.opcode_count = D_NOTEBOOK_OPCODE_COUNT;
+        header.source_size = (uint64_t) source_status.st_size;
+        header.source_seconds = (int64_t) source_status.st_mtim.tv_sec;
+        header.source_nanoseconds = (int64_t) source_status.st_mtim.tv_nsec;
+        header.name_count = writer.name_count;
+        header.statement_count = writer.statement_count;
+
+        result = _d_notebook_write(&writer, &header, compiled_path);
+    }
+
+
+    // The names belong to the scratch context's symbol table
+    HASH_ITER(hh, writer.names, name, tmp) {
+        HASH_DELETE(hh, writer.names, name);
+        free(name);
+    }
+
+    d_context_destroy(&scratch);
+
+    free(writer.name_table.data);
+    free(writer.statements.data);
+    free(writer.line_names);
+    free(source);
+    free(compiled_path);
+
+
+    return result;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_writer_add
+ */
+int d_notebook_writer_add(
+    struct d_notebook_writer *writer,
+    const char *line,
+    size_t length,
+    const struct d_ast_node *root,
+    const struct d_bytecode *bytecode,
+    int echo
+)
+{
+    size_t offset = 0;
+    uint8_t has_program = 1;
+    uint8_t echo_flag = echo != 0;
+    uint32_t stack_size = (uint32_t) bytecode->stack_size;
+    uint32_t local_count = (uint32_t) bytecode->local_count;
+    uint32_t name_count = 0;
+    uint32_t instruction_count = (uint32_t) bytecode->instruction_count;
+    uint32_t line_length = (uint32_t) length;
+    uint32_t index = 0;
+    int64_t operand = 0;
+    size_t i = 0;
+
+
+    if(writer == NULL || line == NULL || root == NULL || bytecode == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_writer_add",
+                               "'writer' -OR- 'line' -OR- 'root' -OR- "
+                               "'bytecode'");
+        return -1;
+    }
+
+
+    // Only whole lines of the source are compiled; the lexical analyzer
+    // hands them right from where they are, in order
+    if(writer->has_failed || line < writer->source + writer->source_offset ||
+       length > writer->source_length ||
+       line > writer->source + writer->source_length - length) {
+        return 0;
+    }
+
+    offset = (size_t) (line - writer->source);
+
+    writer->line_name_count = 0;
+
+    if(_d_notebook_writer_add_lines(writer, offset) != 0 ||
+       _d_notebook_writer_gather(writer, root) != 0) {
+
+        writer->has_failed = 1;
+        return -1;
+    }
+
+    // A program that cannot be written leaves its line to be analyzed
+    for(i = 0; i < bytecode->instruction_count; ++i) {
+
+        if(_d_notebook_writer_encode(writer, &(bytecode->instructions[i]),
+                                     &operand) != 0) {
+            return 0;
+        }
+    }
+
+    name_count = (uint32_t) writer->line_name_count;
+
+    if(_d_notebook_append(&(writer->statements), &line_length,
+                          sizeof(line_length)) != 0 ||
+       _d_notebook_append(&(writer->statements), line, length) != 0 ||
+       _d_notebook_append(&(writer->statements), &has_program,
+                          sizeof(has_program)) != 0 ||
+       _d_notebook_append(&(writer->statements), &echo_flag,
+                          sizeof(echo_flag)) != 0 ||
+       _d_notebook_append(&(writer->statements), &stack_size,
+                          sizeof(stack_size)) != 0 ||
+       _d_notebook_append(&(writer->statements), &local_count,
+                          sizeof(local_count)) != 0 ||
+       _d_notebook_append(&(writer->statements), &name_count,
+                          sizeof(name_count)) != 0) {
+
+        writer->has_failed = 1;
+        return -1;
+    }
+
+    for(i = 0; i < writer->line_name_count; ++i) {
+
+        if(_d_notebook_writer_intern(writer, writer->line_names[i], &index)
+           != 0 ||
+           _d_notebook_append(&(writer->statements), &index, sizeof(index))
+           != 0) {
+
+            writer->has_failed = 1;
+            return -1;
+        }
+    }
+
+    if(_d_notebook_append(&(writer->statements), &instruction_count,
+                          sizeof(instruction_count)) != 0) {
+
+        writer->has_failed = 1;
+        return -1;
+    }
+
+    for(i = 0; i < bytecode->instruction_count; ++i) {
+
+        _d_notebook_writer_encode(writer, &(bytecode->instructions[i]),
+                                  &operand);
+
+        if(_d_notebook_append(&(writer->statements),
+                              &(bytecode->instructions[i].opcode),
+                              sizeof(uint8_t)) != 0 ||
+           _d_notebook_append(&(writer->statements), &operand,
+                              sizeof(operand)) != 0) {
+
+            writer->has_failed = 1;
+            return -1;
+        }
+    }
+
+    writer->source_offset = offset + length;
+    ++writer->statement_count;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_get_compiled_path
+ */
+char *d_notebook_get_compiled_path(
+    const char *path
+)
+{
+    size_t length = 0;
+    size_t extension_length = strlen(D_NOTEBOOK_SOURCE_EXTENSION);
+    char *compiled_path = NULL;
+
+
+    if(path == NULL || (length = strlen(path)) <= extension_length ||
+       strcmp(path + length - extension_length,
+              D_NOTEBOOK_SOURCE_EXTENSION) != 0) {
+        return NULL;
+    }
+
+
+    if((compiled_path = malloc(length + strlen(D_NOTEBOOK_EXTENSION) -
+                               extension_length + 1)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_get_compiled_path",
+                               "'malloc' for the path");
+        return NULL;
+    }
+
+    memcpy(compiled_path, path, length - extension_length);
+    strcpy(compiled_path + length - extension_length, D_NOTEBOOK_EXTENSION);
+
+
+    return compiled_path;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_get_source_path
+ */
+char *d_notebook_get_source_path(
+    const char *path
+)
+{
+    size_t length = 0;
+    size_t extension_length = strlen(D_NOTEBOOK_EXTENSION);
+    char *source_path = NULL;
+
+
+    if(path == NULL || (length = strlen(path)) <= extension_length ||
+       strcmp(path + length - extension_length, D_NOTEBOOK_EXTENSION) != 0) {
+        return NULL;
+    }
+
+
+    if((source_path = malloc(length - extension_length +
+                             strlen(D_NOTEBOOK_SOURCE_EXTENSION) + 1))
+       == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_get_source_path",
+                               "'malloc' for the path");
+        return NULL;
+    }
+
+    memcpy(source_path, path, length - extension_length);
+    strcpy(source_path + length - extension_length,
+           D_NOTEBOOK_SOURCE_EXTENSION);
+
+
+    return source_path;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_open
+ */
+int d_notebook_open(
+    const char *path,
+    struct d_notebook **notebook
+)
+{
+    struct d_notebook *opened = NULL;
+    struct _d_notebook_header header;
+    struct stat file_status;
+    struct stat source_status;
+    char *source_path = NULL;
+    void *mapping = MAP_FAILED;
+    int file_descriptor = -1;
+    int result = 0;
+
+
+    if(path == NULL || notebook == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_open", "'path' -OR- 'notebook'");
+        return -1;
+    }
+
+
+    if((file_descriptor = open(path, O_RDONLY)) < 0) {
+        return 1;
+    }
+
+    if(fstat(file_descriptor, &file_status) == 0 &&
+       S_ISREG(file_status.st_mode) &&
+       (size_t) file_status.st_size >= sizeof(struct _d_notebook_header)) {
+
+        mapping = mmap(NULL, (size_t) file_status.st_size, PROT_READ,
+                       MAP_PRIVATE, file_descriptor, 0);
+    }
+
+    close(file_descriptor);
+
+    if(mapping == MAP_FAILED) {
+        return 1;
+    }
+
+    memcpy(&header, mapping, sizeof(struct _d_notebook_header));
+
+
+    // A notebook whose source has changed since it was compiled is stale; if
+    // there is no source, the notebook is all there is
+    source_path = d_notebook_get_source_path(path);
+
+    if(memcmp(header.magic, D_NOTEBOOK_MAGIC, sizeof(header.magic)) != 0 ||
+       header.version != D_NOTEBOOK_VERSION ||
+       header.byte_order_mark != D_NOTEBOOK_BYTE_ORDER_MARK ||
+       header.opcode_count != D_NOTEBOOK_OPCODE_COUNT ||
+       (source_path != NULL && stat(source_path, &source_status) == 0 &&
+        ((uint64_t) source_status.st_size != header.source_size ||
+         (int64_t) source_status.st_mtim.tv_sec != header.source_seconds ||
+         (int64_t) source_status.st_mtim.tv_nsec !=
+         header.source_nanoseconds))) {
+
+        free(source_path);
+        munmap(mapping, (size_t) file_status.st_size);
+        return 1;
+    }
+
+    free(source_path);
+
+
+    if((opened = calloc(1, sizeof(struct d_notebook))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_open", "'calloc' for the notebook");
+        munmap(mapping, (size_t) file_status.st_size);
+        return -1;
+    }
+
+    opened->data = mapping;
+    opened->size = (size_t) file_status.st_size;
+    opened->generation = 1;
+
+    if((result = _d_notebook_check(opened, &header)) != 0) {
+        d_notebook_close(opened);
+        return result;
+    }
+
+    // Lines are read from beginning to end
+    madvise(mapping, opened->size, MADV_SEQUENTIAL);
+
+    *notebook = opened;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_next_statement
+ */
+int d_notebook_next_statement(
+    struct d_notebook *notebook,
+    struct d_notebook_statement *statement
+)
+{
+    struct _d_notebook_cursor *cursor = NULL;
+    uint32_t length = 0;
+    uint8_t has_program = 0;
+    uint32_t count = 0;
+
+
+    if(notebook == NULL || statement == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_next_statement",
+                               "'notebook' -OR- 'statement'");
+        return -1;
+    }
+
+    if(notebook->handed_count == notebook->statement_count) {
+        return 1;
+    }
+
+
+    // The previous line may have been analyzed, which could have changed any
+    // entry of the symbol table
+    if(!notebook->was_resolved) {
+        ++notebook->generation;
+    }
+
+    notebook->was_resolved = 0;
+
+
+    // The notebook has already been checked, so it is just walked
+    cursor = &(notebook->next_statement);
+
+    _d_notebook_read(cursor, &length, sizeof(length));
+    statement->line = (const char *) cursor->position;
+    statement->length = length;
+    cursor->position += length;
+
+    _d_notebook_read(cursor, &has_program, sizeof(has_program));
+    statement->program = has_program ? cursor->position : NULL;
+
+    if(has_program) {
+
+        // Echo, stack size and local slots
+        cursor->position += sizeof(uint8_t) + 2 * sizeof(uint32_t);
+
+        _d_notebook_read(cursor, &count, sizeof(count));
+        cursor->position += count * sizeof(uint32_t);
+
+        _d_notebook_read(cursor, &count, sizeof(count));
+        cursor->position += count * D_NOTEBOOK_INSTRUCTION_SIZE;
+    }
+
+    ++notebook->handed_count;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_resolve
+ */
+int d_notebook_resolve(
+    struct d_notebook *notebook,
+    const struct d_notebook_statement *statement,
+    struct d_symbol_table *table,
+    struct d_bytecode *bytecode,
+    int *echo
+)
+{
+    struct _d_notebook_cursor cursor;
+    struct _d_notebook_name *name = NULL;
+    struct d_symbol_table_entry new_entry;
+    struct d_symbol_table_entry *entry = NULL;
+    struct d_bytecode_instruction *instruction = NULL;
+    uint8_t echo_flag = 0;
+    uint32_t stack_size = 0;
+    uint32_t local_count = 0;
+    uint32_t name_count = 0;
+    uint32_t instruction_count = 0;
+    int64_t operand = 0;
+    uint32_t i = 0;
+
+
+    if(notebook == NULL || statement == NULL || statement->program == NULL ||
+       table == NULL || bytecode == NULL || echo == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_resolve",
+                               "'notebook' -OR- 'statement->program' -OR- "
+                               "'table' -OR- 'bytecode' -OR- 'echo'");
+        return -1;
+    }
+
+
+    cursor.position = statement->program;
+    cursor.end = notebook->data + notebook->size;
+
+    _d_notebook_read(&cursor, &echo_flag, sizeof(echo_flag));
+    _d_notebook_read(&cursor, &stack_size, sizeof(stack_size));
+    _d_notebook_read(&cursor, &local_count, sizeof(local_count));
+    _d_notebook_read(&cursor, &name_count, sizeof(name_count));
+    _d_notebook_read(&cursor, notebook->line_names,
+                     name_count * sizeof(uint32_t));
+
+
+    // Names are looked up in the order in which they appear in the line, so
+    // that missing variables are created just as the lexical analyzer would
+    for(i = 0; i < name_count; ++i) {
+
+        name = &(notebook->names[notebook->line_names[i]]);
+
+        if(name->generation == notebook->generation) {
+            continue;
+        }
+
+        entry = d_symbol_table_search(table, name->lexeme);
+
+        if(entry == NULL &&
+           name->lexical_component == D_LC_IDENTIFIER_VARIABLE) {
+
+            // '0' base 10 integer by default
+            new_entry.lexeme = name->lexeme;
+            new_entry.lexical_component = D_LC_IDENTIFIER_VARIABLE;
+            new_entry.attribute.dec_number.is_floating = 0;
+            new_entry.attribute.dec_number.is_array = 0;
+            new_entry.attribute.dec_number.values.integer = 0;
+
+            if(d_symbol_table_add(table, &new_entry) != 0) {
+                return -1;
+            }
+
+            entry = d_symbol_table_search(table, name->lexeme);
+        }
+
+        if(entry == NULL ||
+           entry->lexical_component != name->lexical_component) {
+            return 1;
+        }
+
+        name->entry = entry;
+        name->generation = notebook->generation;
+    }
+
+
+    _d_notebook_read(&cursor, &instruction_count, sizeof(instruction_count));
+
+    for(i = 0; i < instruction_count; ++i) {
+
+        instruction = &(notebook->instructions[i]);
+
+        _d_notebook_read(&cursor, &(instruction->opcode),
+                         sizeof(instruction->opcode));
+        _d_notebook_read(&cursor, &operand, sizeof(operand));
+
+        switch(instruction->opcode) {
+
+            case D_OP_PUSH_INTEGER:
+                instruction->operand.integer = operand;
+                break;
+
+            case D_OP_PUSH_FLOATING:
+                memcpy(&(instruction->operand.floating), &operand,
+                       sizeof(operand));
+                break;
+
+            case D_OP_LOAD_CONSTANT:
+                instruction->operand.st_entry =
+                    notebook->names[notebook->line_names[operand]].entry;
+                break;
+
+            case D_OP_LOAD_VARIABLE:
+            case D_OP_STORE_VARIABLE:
+                instruction->operand.variable_slot =
+                    notebook->names[notebook->line_names[operand]].entry
+                        ->attribute.variable_slot;
+                break;
+
+            case D_OP_CALL_FUNCTION:
+                instruction->operand.function =
+                    notebook->names[notebook->line_names[operand]].entry
+                        ->attribute.function;
+                break;
+
+            case D_OP_LOAD_LOCAL:
+            case D_OP_STORE_LOCAL:
+                instruction->operand.local_slot = (int) operand;
+                break;
+
+            case D_OP_MAKE_ARRAY:
+                instruction->operand.array.element_count =
+                    (uint32_t) ((uint64_t) operand >> 32);
+                instruction->operand.array.column = (int) (uint32_t) operand;
+                break;
+
+            // Divisions, modulus, floating point and dynamically typed
+            // arithmetic carry their column, and no other instruction has an
+            // operand
+            default:
+                instruction->operand.column = (int) operand;
+                break;
+        }
+    }
+
+
+    bytecode->instructions = notebook->instructions;
+    bytecode->instruction_count = instruction_count;
+    bytecode->stack_size = stack_size;
+    bytecode->local_count = local_count;
+
+    *echo = echo_flag;
+
+    notebook->was_resolved = 1;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of notebook.h/d_notebook_close
+ */
+int d_notebook_close(
+    struct d_notebook *notebook
+)
+{
+    int result = 0;
+
+
+    if(notebook == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "notebook.c",
+                               "d_notebook_close", "'notebook'");
+        return -1;
+    }
+
+
+    if(munmap((void *) notebook->data, notebook->size) != 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "notebook.c",
+                               "d_notebook_close", "'munmap' on the file");
+        result = -1;
+    }
+
+    free(notebook->names);
+    free(notebook->instructions);
+    free(notebook->line_names);
+    free(notebook);
+
+
+    return result;
+}
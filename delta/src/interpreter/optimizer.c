@@ -0,0 +1,742 @@
+/**
+ * @file optimizer.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/optimizer.h
+ */
+
+
+#include "interpreter/optimizer.h"
+
+#include "common/errors.h"
+#include "math/dec_numbers.h"
+
+
+#include <stddef.h>
+// uint64_t, uintptr_t
+#include <stdint.h>
+// memcpy, memset
+#include <string.h>
+
+
+/**
+ * @brief Keeps track of the subexpressions that have been seen so far while
+ *        eliminating common subexpressions.
+ */
+struct _d_optimizer {
+    /** Open addressing hash table that holds the first occurrence of each
+        subexpression. Empty buckets are NULL. */
+    struct d_ast_node **table;
+    /** How many buckets there are; always a power of 2. */
+    size_t table_size;
+
+    /** The variables to which the expression assigns any value, as the
+        subexpressions that read them may not have the same value each time
+        that they are evaluated. */
+    const struct d_symbol_table_entry **assigned;
+    /** How many of them there are. */
+    size_t assigned_count;
+
+    /** Which local slot will be given to the next subexpression whose value
+        needs to be kept. */
+    int next_local_slot;
+};
+
+
+/**
+ * @brief Turns the given node into a literal.
+ *
+ * @param[in,out] node The node.
+ * @param[in] value The literal's value.
+ */
+void _d_optimizer_make_literal(
+    struct d_ast_node *node,
+    const struct d_dec_number *value
+)
+{
+    node->type = D_AST_LITERAL;
+    node->operation = '\0';
+    node->attribute.dec_number = *value;
+    node->value_type = value->is_floating ? D_AST_VALUE_FLOATING :
+                                            D_AST_VALUE_INTEGER;
+}
+
+
+/**
+ * @brief Folds all subtrees of the given AST that only involve literals and
+ *        math constants.
+ *
+ * @param[in,out] node The root of the AST.
+ */
+void _d_optimizer_fold(
+    struct d_ast_node *node
+)
+{
+    struct d_ast_node *left = NULL;
+    struct d_ast_node *right = NULL;
+
+    struct d_dec_number value;
+    size_t i = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_CONSTANT:
+
+            // Math constants are immutable, so their values can be read
+            // just once
+            value = node->attribute.st_entry->attribute.dec_number;
+            _d_optimizer_make_literal(node, &value);
+
+            break;
+
+
+        case D_AST_ASSIGNMENT:
+        case D_AST_FUNCTION_CALL:
+
+            _d_optimizer_fold(node->attribute.unary.operand);
+
+            break;
+
+
+        case D_AST_OPERATION:
+
+            left = node->attribute.binary.left;
+            right = node->attribute.binary.right;
+
+            _d_optimizer_fold(left);
+            _d_optimizer_fold(right);
+
+            if(left->type != D_AST_LITERAL || right->type != D_AST_LITERAL) {
+                break;
+            }
+
+            // Divisions by 0 must still be reported when evaluating the
+            // expression
+            if((node->operation == '/' || node->operation == '%') &&
+               d_dec_numbers_get_floating_value(&(right->attribute.dec_number))
+               == 0.0) {
+                break;
+            }
+
+            value = d_dec_numbers_compute_operation(
+                        node->operation, &(left->attribute.dec_number),
+                        &(right->attribute.dec_number)
+                    );
+            _d_optimizer_make_literal(node, &value);
+
+            break;
+
+
+        case D_AST_NEGATION:
+
+            _d_optimizer_fold(node->attribute.operand);
+
+            if(node->attribute.operand->type == D_AST_LITERAL) {
+
+                value = d_dec_numbers_get_negated_value(
+                            &(node->attribute.operand->attribute.dec_number)
+                        );
+                _d_optimizer_make_literal(node, &value);
+            }
+
+            break;
+
+
+        // Arrays are built at run time, but their elements may be folded
+        case D_AST_ARRAY:
+
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                _d_optimizer_fold(node->attribute.array.elements[i]);
+            }
+
+            break;
+
+
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief Counts how many nodes of the given AST may be shared, and how many
+ *        assignments there are in it.
+ *
+ * @param[in] node The root of the AST.
+ * @param[in,out] assignment_count Increased by each assignment that is
+ *                                 found.
+ *
+ * @return How many operations, negations and function calls there are.
+ */
+size_t _d_optimizer_count_shareable(
+    const struct d_ast_node *node,
+    size_t *assignment_count
+)
+{
+    size_t count = 0;
+    size_t i = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_ASSIGNMENT:
+            ++(*assignment_count);
+            return _d_optimizer_count_shareable(node->attribute.unary.operand,
+                                                assignment_count);
+
+        case D_AST_FUNCTION_CALL:
+            return 1 + _d_optimizer_count_shareable(
+                           node->attribute.unary.operand, assignment_count
+                       );
+
+        case D_AST_OPERATION:
+            return 1 + _d_optimizer_count_shareable(
+                           node->attribute.binary.left, assignment_count
+                       ) +
+                   _d_optimizer_count_shareable(
+                       node->attribute.binary.right, assignment_count
+                   );
+
+        case D_AST_NEGATION:
+            return 1 + _d_optimizer_count_shareable(node->attribute.operand,
+                                                    assignment_count);
+
+        case D_AST_ARRAY:
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                count += _d_optimizer_count_shareable(
+                             node->attribute.array.elements[i],
+                             assignment_count
+                         );
+            }
+            return count;
+
+        default:
+            return 0;
+    }
+}
+
+
+/**
+ * @brief Gathers the variables to which the given AST assigns any value.
+ *
+ * @param[in,out] optimizer The optimizer's state, whose "assigned" array
+ *                          must fit all assignments of the AST.
+ * @param[in] node The root of the AST.
+ */
+void _d_optimizer_gather_assigned(
+    struct _d_optimizer *optimizer,
+    const struct d_ast_node *node
+)
+{
+    size_t i = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_ASSIGNMENT:
+            optimizer->assigned[optimizer->assigned_count++] =
+                node->attribute.unary.st_entry;
+            _d_optimizer_gather_assigned(optimizer,
+                                         node->attribute.unary.operand);
+            break;
+
+        case D_AST_FUNCTION_CALL:
+            _d_optimizer_gather_assigned(optimizer,
+                                         node->attribute.unary.operand);
+            break;
+
+        case D_AST_OPERATION:
+            _d_optimizer_gather_assigned(optimizer,
+                                         node->attribute.binary.left);
+            _d_optimizer_gather_assigned(optimizer,
+                                         node->attribute.binary.right);
+            break;
+
+        case D_AST_NEGATION:
+            _d_optimizer_gather_assigned(optimizer, node->attribute.operand);
+            break;
+
+        case D_AST_ARRAY:
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                _d_optimizer_gather_assigned(
+                    optimizer, node->attribute.array.elements[i]
+                );
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief Checks if the expression assigns any value to the given variable.
+ *
+ * @param[in] optimizer The optimizer's state.
+ * @param[in] entry The variable.
+ *
+ * @return 1 if it does, 0 otherwise.
+ */
+int _d_optimizer_is_assigned(
+    const struct _d_optimizer *optimizer,
+    const struct d_symbol_table_entry *entry
+)
+{
+    size_t i = 0;
+
+
+    for(i = 0; i < optimizer->assigned_count; ++i) {
+
+        if(optimizer->assigned[i] == entry) {
+            return 1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns the node that actually computes the given node's value.
+ *
+ * @param[in] node The node.
+ *
+ * @return The node of which the given one is a duplicate, or the node
+ *         itself.
+ */
+const struct d_ast_node *_d_optimizer_get_original(
+    const struct d_ast_node *node
+)
+{
+    return node->duplicate_of != NULL ? node->duplicate_of : node;
+}
+
+
+/**
+ * @brief Hashes an operand of a shareable node.
+ *
+ * @details
+ *  Leaves are hashed by their contents, whereas other nodes are hashed by
+ *  the node that actually computes their value, as all of their
+ *  duplicates have already been found.
+ *
+ * @param[in] node The operand.
+ *
+ * @return The hash.
+ */
+size_t _d_optimizer_hash_operand(
+    const struct d_ast_node *node
+)
+{
+    uint64_t bits = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_LITERAL:
+
+            if(node->attribute.dec_number.is_floating) {
+                memcpy(&bits, &(node->attribute.dec_number.values.floating),
+                       sizeof(bits));
+                return (size_t) (bits ^ (bits >> 32)) * 2 + 1;
+            }
+
+            bits = (uint64_t) node->attribute.dec_number.values.integer;
+            return (size_t) (bits ^ (bits >> 32)) * 2;
+
+        case D_AST_CONSTANT:
+        case D_AST_VARIABLE:
+            return (size_t) (uintptr_t) node->attribute.st_entry;
+
+        default:
+            return (size_t) (uintptr_t) _d_optimizer_get_original(node);
+    }
+}
+
+
+/**
+ * @brief Hashes a shareable node.
+ *
+ * @param[in] node The node.
+ *
+ * @return The hash.
+ */
+size_t _d_optimizer_hash(
+    const struct d_ast_node *node
+)
+{
+    size_t hash = (size_t) node->type * 31 + (size_t) node->operation;
+
+
+    switch(node->type) {
+
+        case D_AST_FUNCTION_CALL:
+            hash = hash * 31 +
+                   (size_t) (uintptr_t) node->attribute.unary.st_entry;
+            hash = hash * 31 +
+                   _d_optimizer_hash_operand(node->attribute.unary.operand);
+            break;
+
+        case D_AST_OPERATION:
+            hash = hash * 31 +
+                   _d_optimizer_hash_operand(node->attribute.binary.left);
+            hash = hash * 31 +
+                   _d_optimizer_hash_operand(node->attribute.binary.right);
+            break;
+
+        case D_AST_NEGATION:
+            hash = hash * 31 +
+                   _d_optimizer_hash_operand(node->attribute.operand);
+            break;
+
+        default:
+            break;
+    }
+
+
+    // Pointers are aligned, so their lowest bits carry little information
+    return hash ^ (hash >> 7) ^ (hash >> 17);
+}
+
+
+/**
+ * @brief Checks if two operands of shareable nodes compute the same value.
+ *
+ * @param[in] node_1 The first operand.
+ * @param[in] node_2 The second operand.
+ *
+ * @return 1 if they do, 0 otherwise.
+ */
+int _d_optimizer_same_operand(
+    const struct d_ast_node *node_1,
+    const struct d_ast_node *node_2
+)
+{
+    const struct d_dec_number *number_1 = NULL;
+    const struct d_dec_number *number_2 = NULL;
+
+
+    if(node_1->type != node_2->type) {
+        return 0;
+    }
+
+
+    switch(node_1->type) {
+
+        case D_AST_LITERAL:
+
+            number_1 = &(node_1->attribute.dec_number);
+            number_2 = &(node_2->attribute.dec_number);
+
+            if(number_1->is_floating != number_2->is_floating) {
+                return 0;
+            }
+
+            // Bitwise, so that i.e. 0.0 and -0.0 are told apart
+            return number_1->is_floating ?
+                       memcmp(&(number_1->values.floating),
+                              &(number_2->values.floating),
+                              sizeof(double)) == 0 :
+                       number_1->values.integer == number_2->values.integer;
+
+        case D_AST_CONSTANT:
+        case D_AST_VARIABLE:
+            return node_1->attribute.st_entry == node_2->attribute.st_entry;
+
+        default:
+            return _d_optimizer_get_original(node_1) ==
+                   _d_optimizer_get_original(node_2);
+    }
+}
+
+
+/**
+ * @brief Checks if two shareable nodes compute the same value.
+ *
+ * @param[in] node_1 The first node.
+ * @param[in] node_2 The second node.
+ *
+ * @return 1 if they do, 0 otherwise.
+ */
+int _d_optimizer_equal(
+    const struct d_ast_node *node_1,
+    const struct d_ast_node *node_2
+)
+{
+    if(node_1->type != node_2->type ||
+       node_1->operation != node_2->operation) {
+        return 0;
+    }
+
+
+    switch(node_1->type) {
+
+        case D_AST_FUNCTION_CALL:
+            return node_1->attribute.unary.st_entry ==
+                       node_2->attribute.unary.st_entry &&
+                   _d_optimizer_same_operand(node_1->attribute.unary.operand,
+                                             node_2->attribute.unary.operand);
+
+        case D_AST_OPERATION:
+            return _d_optimizer_same_operand(node_1->attribute.binary.left,
+                                             node_2->attribute.binary.left) &&
+                   _d_optimizer_same_operand(node_1->attribute.binary.right,
+                                             node_2->attribute.binary.right);
+
+        case D_AST_NEGATION:
+            return _d_optimizer_same_operand(node_1->attribute.operand,
+                                             node_2->attribute.operand);
+
+        default:
+            return 0;
+    }
+}
+
+
+/**
+ * @brief Finds which nodes of the given AST are duplicates of others.
+ *
+ * @details
+ *  Nodes are visited in the same order in which they are evaluated, so the
+ *  first occurrence of each subexpression is always the one that computes
+ *  its value.
+ *
+ *  Subexpressions that read any variable to which the expression assigns a
+ *  value, or that contain an assignment, are not shared; duplicates are
+ *  still searched for inside them.
+ *
+ * @param[in,out] optimizer The optimizer's state.
+ * @param[in,out] node The root of the AST.
+ *
+ * @return 1 if the given node may not be shared, 0 otherwise.
+ */
+int _d_optimizer_find_duplicates(
+    struct _d_optimizer *optimizer,
+    struct d_ast_node *node
+)
+{
+    size_t mask = optimizer->table_size - 1;
+    size_t bucket = 0;
+    size_t i = 0;
+    int is_unshareable = 0;
+
+
+    switch(node->type) {
+
+        case D_AST_VARIABLE:
+            return _d_optimizer_is_assigned(optimizer,
+                                            node->attribute.st_entry);
+
+        case D_AST_ASSIGNMENT:
+            _d_optimizer_find_duplicates(optimizer,
+                                         node->attribute.unary.operand);
+            return 1;
+
+        case D_AST_FUNCTION_CALL:
+            is_unshareable = _d_optimizer_find_duplicates(
+                                 optimizer, node->attribute.unary.operand
+                             );
+            break;
+
+        case D_AST_OPERATION:
+            is_unshareable = _d_optimizer_find_duplicates(
+                                 optimizer, node->attribute.binary.left
+                             );
+            is_unshareable |= _d_optimizer_find_duplicates(
+                                  optimizer, node->attribute.binary.right
+                              );
+            break;
+
+        case D_AST_NEGATION:
+            is_unshareable = _d_optimizer_find_duplicates(
+                                 optimizer, node->attribute.operand
+                             );
+            break;
+
+        // Arrays are never shared, as each one must be built anew
+        case D_AST_ARRAY:
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                _d_optimizer_find_duplicates(
+                    optimizer, node->attribute.array.elements[i]
+                );
+            }
+            return 1;
+
+        // Other leaves are as cheap to compute as to reuse
+        default:
+            return 0;
+    }
+
+    if(is_unshareable) {
+        return 1;
+    }
+
+
+    for(bucket = _d_optimizer_hash(node) & mask;
+        optimizer->table[bucket] != NULL;
+        bucket = (bucket + 1) & mask) {
+
+        if(_d_optimizer_equal(optimizer->table[bucket], node)) {
+            node->duplicate_of = optimizer->table[bucket];
+            return 0;
+        }
+    }
+
+    optimizer->table[bucket] = node;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Gives a local slot to each node whose value is reused by any of
+ *        its duplicates.
+ *
+ * @details
+ *  Duplicates are never computed, so any duplicates found inside them do
+ *  not count.
+ *
+ * @param[in,out] optimizer The optimizer's state.
+ * @param[in,out] node The root of the AST.
+ */
+void _d_optimizer_assign_local_slots(
+    struct _d_optimizer *optimizer,
+    struct d_ast_node *node
+)
+{
+    size_t i = 0;
+
+
+    if(node->duplicate_of != NULL) {
+
+        if(node->duplicate_of->local_slot < 0) {
+            node->duplicate_of->local_slot = optimizer->next_local_slot;
+            ++(optimizer->next_local_slot);
+        }
+
+        return;
+    }
+
+
+    switch(node->type) {
+
+        case D_AST_ASSIGNMENT:
+        case D_AST_FUNCTION_CALL:
+            _d_optimizer_assign_local_slots(optimizer,
+                                            node->attribute.unary.operand);
+            break;
+
+        case D_AST_OPERATION:
+            _d_optimizer_assign_local_slots(optimizer,
+                                            node->attribute.binary.left);
+            _d_optimizer_assign_local_slots(optimizer,
+                                            node->attribute.binary.right);
+            break;
+
+        case D_AST_NEGATION:
+            _d_optimizer_assign_local_slots(optimizer,
+                                            node->attribute.operand);
+            break;
+
+        case D_AST_ARRAY:
+            for(i = 0; i < node->attribute.array.count; ++i) {
+                _d_optimizer_assign_local_slots(
+                    optimizer, node->attribute.array.elements[i]
+                );
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+
+/**
+ * @brief Implementation of optimizer.h/d_optimizer_optimize
+ */
+int d_optimizer_optimize(
+    struct d_ast_node *root,
+    struct d_arena *arena
+)
+{
+    struct _d_optimizer optimizer;
+
+    size_t shareable_count = 0;
+    size_t assignment_count = 0;
+
+
+    if(root == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "optimizer.c",
+                               "d_optimizer_optimize", "'root'");
+        return -1;
+    }
+
+
+    /* 1. Constant folding */
+
+    _d_optimizer_fold(root);
+
+
+    /* 2. Common subexpression elimination */
+
+    shareable_count = _d_optimizer_count_shareable(root, &assignment_count);
+
+    if(shareable_count < 2) {
+        return 0;
+    }
+
+    optimizer.assigned = NULL;
+    optimizer.assigned_count = 0;
+
+    if(assignment_count > 0) {
+
+        if((optimizer.assigned = d_arena_allocate(
+                arena, assignment_count *
+                       sizeof(const struct d_symbol_table_entry *)
+            )) == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                   "optimizer.c", "d_optimizer_optimize",
+                                   "'d_arena_allocate' for the assigned "
+                                   "variables");
+            return -1;
+        }
+
+        _d_optimizer_gather_assigned(&optimizer, root);
+    }
+
+    // The table is kept at most half full
+    optimizer.table_size = 8;
+
+    while(optimizer.table_size < 2 * shareable_count) {
+        optimizer.table_size *= 2;
+    }
+
+    if((optimizer.table = d_arena_allocate(
+            arena, optimizer.table_size * sizeof(struct d_ast_node *)
+        )) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "optimizer.c",
+                               "d_optimizer_optimize",
+                               "'d_arena_allocate' for the subexpressions "
+                               "table");
+        return -1;
+    }
+
+    memset(optimizer.table, 0,
+           optimizer.table_size * sizeof(struct d_ast_node *));
+    optimizer.next_local_slot = 0;
+
+    _d_optimizer_find_duplicates(&optimizer, root);
+    _d_optimizer_assign_local_slots(&optimizer, root);
+
+
+    return 0;
+}
@@ -0,0 +1,539 @@
+/**
+ * @file vm.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of interpreter/vm.h
+ */
+
+
+#include "interpreter/vm.h"
+
+#include "common/errors.h"
+#include "math/dec_arrays.h"
+
+
+// pow, fmod
+#include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** How many values the stack of the virtual machine can hold without needing
+    to reserve memory for it. It is plenty for any human-written
+    expression. */
+#define D_VM_LOCAL_STACK_SIZE 64
+
+
+/**
+ * @brief Reports a division by 0.
+ *
+ * @param[in,out] context The context.
+ * @param[in] instruction The division or modulus that caught it.
+ * @param[in] line Line from which the program comes.
+ */
+void _d_vm_show_division_by_zero(
+    struct d_context *context,
+    const struct d_bytecode_instruction *instruction,
+    int line
+)
+{
+    d_errors_parse_show(context, 3, D_ERR_SEM_DIVISION_BY_ZERO,
+                        (size_t) line, (size_t) instruction->operand.column);
+}
+
+
+/**
+ * @brief Performs the given operation over the two values on top of the
+ *        given stack, at least one of which is an array, and leaves the
+ *        result in place of the first one.
+ *
+ * @param[in,out] context The context.
+ * @param[in] instruction The instruction that performs the operation.
+ * @param[in] operation The symbol that represents the operation (+, -, *, /,
+ *                      %, ^).
+ * @param[in] line Line from which the program comes.
+ * @param[in,out] top The first free position in the stack.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_vm_compute_array_operation(
+    struct d_context *context,
+    const struct d_bytecode_instruction *instruction,
+    char operation,
+    int line,
+    struct d_dec_number *top
+)
+{
+    // Both lengths
+    char lengths[2 * 20 + sizeof(" and ")];
+    int result = 0;
+
+
+    result = d_dec_arrays_compute_operation(context->arrays, operation,
+                                            &(top[-2]), &(top[-1]),
+                                            &(top[-2]));
+
+    if(result == D_DEC_ARRAYS_LENGTHS_DIFFER) {
+
+        snprintf(lengths, sizeof(lengths), "%zu and %zu",
+                 top[-2].values.array->length, top[-1].values.array->length);
+        d_errors_parse_show(context, 4, D_ERR_SEM_ARRAY_LENGTHS_DIFFER,
+                            (size_t) line,
+                            (size_t) instruction->operand.column, lengths);
+    }
+
+
+    return result;
+}
+
+
+/**
+ * @brief Runs the given instructions over the given stack.
+ *
+ * @param[in,out] context The context.
+ * @param[in] bytecode The program.
+ * @param[in] line Line from which the program comes.
+ * @param[in,out] stack The stack, which must be able to hold as many values
+ *                      as the program requires.
+ * @param[in,out] locals The local slots that the program requires.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_vm_run(
+    struct d_context *context,
+    const struct d_bytecode *bytecode,
+    int line,
+    struct d_dec_number *stack,
+    struct d_dec_number *locals
+)
+{
+    const struct d_bytecode_instruction *instruction = bytecode->instructions;
+    const struct d_bytecode_instruction *end = instruction +
+                                               bytecode->instruction_count;
+
+    // Points to the first free position in the stack, so "top[-1]" is the
+    // value on top of it, and "top[-2]" the one below
+    struct d_dec_number *top = stack;
+
+    // No variables are declared while the program runs, so their values
+    // stay where they are
+    struct d_dec_number *variables =
+        d_symbol_table_get_variables(context->symbol_table);
+
+    int result = 0;
+
+
+    for(; instruction < end; ++instruction) {
+
+        switch(instruction->opcode) {
+
+            /* ═══ Loading & storing values ═══ */
+
+            case D_OP_PUSH_INTEGER:
+                top->is_floating = 0;
+                top->is_array = 0;
+                top->values.integer = instruction->operand.integer;
+                ++top;
+                break;
+
+            case D_OP_PUSH_FLOATING:
+                top->is_floating = 1;
+                top->is_array = 0;
+                top->values.floating = instruction->operand.floating;
+                ++top;
+                break;
+
+            case D_OP_LOAD_CONSTANT:
+                *top = instruction->operand.st_entry->attribute.dec_number;
+                ++top;
+                break;
+
+            case D_OP_LOAD_VARIABLE:
+                *top = variables[instruction->operand.variable_slot];
+                ++top;
+                break;
+
+            case D_OP_STORE_VARIABLE:
+                variables[instruction->operand.variable_slot] = top[-1];
+                break;
+
+            case D_OP_LOAD_LOCAL:
+                *top = locals[instruction->operand.local_slot];
+                ++top;
+                break;
+
+            case D_OP_STORE_LOCAL:
+                locals[instruction->operand.local_slot] = top[-1];
+                break;
+
+            // Array literals may not be elements, but variables may hold
+            // arrays too, which is only known now
+            case D_OP_MAKE_ARRAY:
+                top -= instruction->operand.array.element_count;
+                if((result = d_dec_arrays_build(
+                         context->arrays, top,
+                         instruction->operand.array.element_count, top
+                     )) != 0) {
+
+                    if(result == D_DEC_ARRAYS_NESTED) {
+                        d_errors_parse_show(
+                            context, 3, D_ERR_SEM_ARRAY_NESTED,
+                            (size_t) line,
+                            (size_t) instruction->operand.array.column
+                        );
+                        return 1;
+                    }
+
+                    return -1;
+                }
+                ++top;
+                break;
+
+
+            /* ═══ Conversions ═══ */
+
+            case D_OP_TO_FLOATING_INTEGER:
+                top[-1].values.floating = (double) top[-1].values.integer;
+                top[-1].is_floating = 1;
+                break;
+
+            case D_OP_TO_FLOATING_ANY:
+                if(top[-1].is_array) {
+                    if(!top[-1].is_floating &&
+                       d_dec_arrays_to_floating(context->arrays, &(top[-1]),
+                                                &(top[-1])) != 0) {
+                        return -1;
+                    }
+                }
+                else if(!top[-1].is_floating) {
+                    top[-1].values.floating = (double) top[-1].values.integer;
+                    top[-1].is_floating = 1;
+                }
+                break;
+
+
+            /* ═══ Math functions ═══ */
+
+            case D_OP_CALL_FUNCTION:
+                if(top[-1].is_array) {
+                    if(d_dec_arrays_apply_function(context->arrays,
+                                                   instruction->operand.function,
+                                                   &(top[-1]), &(top[-1]))
+                       != 0) {
+                        return -1;
+                    }
+                }
+                else {
+                    top[-1].values.floating =
+                        instruction->operand.function(top[-1].values.floating);
+                }
+                break;
+
+
+            /* ═══ Integer arithmetic ═══ */
+
+            case D_OP_ADD_INTEGER:
+                top[-2].values.integer += top[-1].values.integer;
+                --top;
+                break;
+
+            case D_OP_SUB_INTEGER:
+                top[-2].values.integer -= top[-1].values.integer;
+                --top;
+                break;
+
+            case D_OP_MUL_INTEGER:
+                top[-2].values.integer *= top[-1].values.integer;
+                --top;
+                break;
+
+            case D_OP_DIV_INTEGER:
+                if(top[-1].values.integer == 0) {
+                    _d_vm_show_division_by_zero(context, instruction, line);
+                    return 1;
+                }
+                top[-2].values.integer /= top[-1].values.integer;
+                --top;
+                break;
+
+            case D_OP_MOD_INTEGER:
+                if(top[-1].values.integer == 0) {
+                    _d_vm_show_division_by_zero(context, instruction, line);
+                    return 1;
+                }
+                top[-2].values.integer %= top[-1].values.integer;
+                --top;
+                break;
+
+            case D_OP_POW_INTEGER:
+                top[-2].values.integer = (int64_t) pow(top[-2].values.integer,
+                                                       top[-1].values.integer);
+                --top;
+                break;
+
+            case D_OP_NEG_INTEGER:
+                top[-1].values.integer = -(top[-1].values.integer);
+                break;
+
+
+            /* ═══ Floating point arithmetic ═══ */
+
+            // Any operand that comes from a variable may be an array of
+            // floating point numbers, which is only known now; such
+            // operations are handed to the helpers in math/dec_arrays.h, as
+            // dynamically typed arithmetic does
+
+            case D_OP_ADD_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '+', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    top[-2].values.floating += top[-1].values.floating;
+                }
+                --top;
+                break;
+
+            case D_OP_SUB_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '-', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    top[-2].values.floating -= top[-1].values.floating;
+                }
+                --top;
+                break;
+
+            case D_OP_MUL_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '*', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    top[-2].values.floating *= top[-1].values.floating;
+                }
+                --top;
+                break;
+
+            case D_OP_DIV_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(d_dec_arrays_has_zero(&(top[-1]))) {
+                        _d_vm_show_division_by_zero(context, instruction,
+                                                    line);
+                        return 1;
+                    }
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '/', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    if(top[-1].values.floating == 0.0) {
+                        _d_vm_show_division_by_zero(context, instruction,
+                                                    line);
+                        return 1;
+                    }
+                    top[-2].values.floating /= top[-1].values.floating;
+                }
+                --top;
+                break;
+
+            case D_OP_MOD_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(d_dec_arrays_has_zero(&(top[-1]))) {
+                        _d_vm_show_division_by_zero(context, instruction,
+                                                    line);
+                        return 1;
+                    }
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '%', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    if(top[-1].values.floating == 0.0) {
+                        _d_vm_show_division_by_zero(context, instruction,
+                                                    line);
+                        return 1;
+                    }
+                    top[-2].values.floating = fmod(top[-2].values.floating,
+                                                   top[-1].values.floating);
+                }
+                --top;
+                break;
+
+            case D_OP_POW_FLOATING:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(_d_vm_compute_array_operation(context, instruction,
+                                                     '^', line, top) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    top[-2].values.floating = pow(top[-2].values.floating,
+                                                  top[-1].values.floating);
+                }
+                --top;
+                break;
+
+            case D_OP_NEG_FLOATING:
+                if(top[-1].is_array) {
+                    if(d_dec_arrays_negate(context->arrays, &(top[-1]),
+                                           &(top[-1])) != 0) {
+                        return -1;
+                    }
+                }
+                else {
+                    top[-1].values.floating = -(top[-1].values.floating);
+                }
+                break;
+
+
+            /* ═══ Dynamically typed arithmetic ═══ */
+
+            // Just as the rest of delta, these instructions rely on the
+            // helpers in math/dec_numbers.h, which apply the integer/floating
+            // point promotion rules; and on those in math/dec_arrays.h, which
+            // apply them element by element
+
+            case D_OP_DIV_ANY:
+            case D_OP_MOD_ANY:
+                if(d_dec_arrays_has_zero(&(top[-1]))) {
+                    _d_vm_show_division_by_zero(context, instruction, line);
+                    return 1;
+                }
+                /* Falls through */
+
+            case D_OP_ADD_ANY:
+            case D_OP_SUB_ANY:
+            case D_OP_MUL_ANY:
+            case D_OP_POW_ANY:
+                if(top[-2].is_array || top[-1].is_array) {
+                    if(_d_vm_compute_array_operation(
+                           context, instruction,
+                           "+-*/%^"[instruction->opcode - D_OP_ADD_ANY],
+                           line, top
+                       ) != 0) {
+                        return 1;
+                    }
+                }
+                else {
+                    top[-2] = d_dec_numbers_compute_operation(
+                                  "+-*/%^"[instruction->opcode - D_OP_ADD_ANY],
+                                  &(top[-2]), &(top[-1])
+                              );
+                }
+                --top;
+                break;
+
+            case D_OP_NEG_ANY:
+                if(top[-1].is_array) {
+                    if(d_dec_arrays_negate(context->arrays, &(top[-1]),
+                                           &(top[-1])) != 0) {
+                        return -1;
+                    }
+                }
+                else {
+                    top[-1] = d_dec_numbers_get_negated_value(&(top[-1]));
+                }
+                break;
+
+
+            default:
+                d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                                       "vm.c", "_d_vm_run", "the specified "
+                                       "opcode is not supported");
+                return -1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of vm.h/d_vm_execute
+ */
+int d_vm_execute(
+    struct d_context *context,
+    const struct d_bytecode *bytecode,
+    int line,
+    struct d_dec_number *result
+)
+{
+    struct d_dec_number local_stack[D_VM_LOCAL_STACK_SIZE];
+    struct d_dec_number *stack = local_stack;
+
+    int return_value = 0;
+
+
+    if(bytecode == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "vm.c",
+                               "d_vm_execute", "'bytecode'");
+        return -1;
+    }
+
+    if(result == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "vm.c",
+                               "d_vm_execute", "'result'");
+        return -1;
+    }
+
+
+    // No values are in use between programs but those of variables and the
+    // last expression, besides those that have been handed to an embedder,
+    // which are held, so unreachable arrays may be freed now
+    if(d_dec_arrays_is_collection_due(context->arrays)) {
+
+        d_dec_arrays_mark(d_symbol_table_get_variables(context->symbol_table),
+                          d_symbol_table_get_variable_count(
+                              context->symbol_table));
+
+        if(context->has_last_value) {
+            d_dec_arrays_mark(&(context->last_value), 1);
+        }
+
+        d_dec_arrays_sweep(context->arrays);
+    }
+
+
+    // Deeply nested expressions may need a larger stack; local slots are
+    // placed right after it
+    if(bytecode->stack_size + bytecode->local_count > D_VM_LOCAL_STACK_SIZE) {
+
+        if((stack = malloc((bytecode->stack_size + bytecode->local_count) *
+                           sizeof(struct d_dec_number))) == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "vm.c",
+                                   "d_vm_execute",
+                                   "'malloc' for the stack");
+            return -1;
+        }
+    }
+
+
+    // The expression's value is left at the bottom of the stack
+    if((return_value = _d_vm_run(context, bytecode, line, stack,
+                                   stack + bytecode->stack_size)) == 0) {
+        *result = stack[0];
+    }
+
+    if(stack != local_stack) {
+        free(stack);
+    }
+
+
+    return return_value;
+}
@@ -1,48 +1,213 @@
+// isatty
+#define _POSIX_C_SOURCE 200809L
+
+
 #include <stdio.h>
 #include <stdlib.h>
+// strcmp
+#include <string.h>
+// isatty
+#include <unistd.h>
 
 #include "analyzers/lexical.h"
 #include "analyzers/synsem.h"
-#include "common/symbol_table.h"
+#include "common/context.h"
+#include "interpreter/notebook.h"
+#include "server/server.h"
+
+
+/** Size in bytes of stdout's buffer when it is not a terminal, or in batch
+    mode; it is only written once it fills up, or when delta exits. */
+#define D_MAIN_OUTPUT_BUFFER_SIZE (1024 * 1024)
+
+/** How delta may be launched. */
+#define D_MAIN_USAGE \
+    "usage: delta [--batch]\n" \
+    "       delta [-e <statements>]... [<notebook>]...\n" \
+    "       delta --compile <notebook>\n" \
+    "       delta --serve <socket>\n"
+
+
+/**
+ * @brief Checks the arguments of the one-shot mode.
+ *
+ * @details
+ *  Every "-e" must be followed by its statements, and any other argument
+ *  that starts with '-' is not supported.
+ *
+ * @return 0 if they are all valid, any other value otherwise.
+ */
+int _d_main_check_arguments(
+    int argc,
+    char *argv[]
+)
+{
+    int i = 0;
+
+
+    for(i = 1; i < argc; ++i) {
+
+        if(strcmp(argv[i], "-e") == 0) {
+
+            if(++i == argc) {
+                return -1;
+            }
+        }
+
+        else if(argv[i][0] == '-') {
+            return -1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Runs the statements and notebooks that have been given as
+ *        arguments, in order.
+ *
+ * @details
+ *  Each one is analyzed on its own, until it ends, and stdin is never read.
+ *  A "quit" skips the rest of them.
+ *
+ * @return 0 if all of them have been run without errors, any other value
+ *         otherwise.
+ */
+int _d_main_run_arguments(
+    struct d_context *context,
+    int argc,
+    char *argv[]
+)
+{
+    int i = 0;
+    int result = 0;
+
+
+    for(i = 1; i < argc; ++i) {
+
+        if(strcmp(argv[i], "-e") == 0) {
+            ++i;
+
+            if(d_lexical_analyzer_new_string(context, argv[i],
+                                             strlen(argv[i])) != 0) {
+                return -1;
+            }
+        }
+
+        else if(d_lexical_analyzer_new_file(context, argv[i]) != 0) {
+            result = -1;
+            continue;
+        }
+
+        if(d_synsem_analyzer_parse(context) != 0) {
+            result = -1;
+        }
+
+        // Each input is popped once it ends, so any that is left means that
+        // delta has been told to quit
+        if(!context->is_stdin) {
+
+            while(!context->is_stdin) {
+                d_lexical_analyzer_pop_file(context);
+            }
+
+            break;
+        }
+    }
+
+
+    return (result == 0 && context->error_count == 0) ? 0 : -1;
+}
 
 
 int main(int argc, char *argv[])
 {
-    /* Initialization */
+    struct d_context context;
+    enum d_context_mode mode = D_CONTEXT_MODE_INTERACTIVE;
+    int is_one_shot = 0;
+    int result = 0;
 
-    // The main function is responsible for initializing all the components of
-    // delta
 
-    if(d_symbol_table_initialize() != 0) {
-        exit(EXIT_FAILURE);
+    /* Server mode */
+
+    // "delta --serve <socket>" evaluates statements on behalf of other
+    // processes instead of a user
+    if(argc == 3 && strcmp(argv[1], "--serve") == 0) {
+        exit((d_server_run(argv[2]) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+
+    /* Compiler mode */
+
+    // "delta --compile <notebook>" writes the compiled notebook of the given
+    // one, without running it, so that it may be done before loading it
+    if(argc == 3 && strcmp(argv[1], "--compile") == 0) {
+        exit((d_notebook_compile(argv[2]) == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+
+    /* Batch & one-shot modes */
+
+    // "delta --batch" runs the statements that are piped in without the
+    // intro tip nor the prompt, which is also the case if stdin is not a
+    // terminal, as nobody is typing them in
+    if((argc == 2 && strcmp(argv[1], "--batch") == 0) ||
+       !isatty(STDIN_FILENO)) {
+        mode = D_CONTEXT_MODE_BATCH;
     }
 
-    if(d_lexical_analyzer_initialize() != 0) {
-        exit(EXIT_FAILURE);   
+    // "delta -e <statements> <notebook>" just runs the given statements and
+    // notebooks, and exits; so, nobody is typing them in either
+    if(argc > 1 && strcmp(argv[1], "--batch") != 0) {
+
+        if(_d_main_check_arguments(argc, argv) != 0) {
+            fputs(D_MAIN_USAGE, stderr);
+            exit(EXIT_FAILURE);
+        }
+
+        mode = D_CONTEXT_MODE_BATCH;
+        is_one_shot = 1;
     }
 
-    if(d_synsem_analyzer_initialize() != 0) {
+
+    /* Initialization */
+
+    // The whole state of the interpreter lives in its context, which
+    // initializes all the components of delta
+    if(d_context_initialize(&context, mode) != 0) {
         exit(EXIT_FAILURE);
     }
 
 
+    /* Output */
+
+    // Values are written into stdout's buffer, which only needs to be
+    // flushed often if a user is reading them as they come
+    if(mode == D_CONTEXT_MODE_BATCH || !isatty(STDOUT_FILENO)) {
+        setvbuf(stdout, NULL, _IOFBF, D_MAIN_OUTPUT_BUFFER_SIZE);
+    }
+
+
     /* Input parsing */
 
     // Running the syntactic & semantic analyzer, which will call by itself
-    // the lexical analyzer
-    if(d_synsem_analyzer_parse() != 0) {
-        exit(EXIT_FAILURE);
+    // the lexical analyzer, over the arguments in the one-shot mode, or over
+    // stdin otherwise
+    if(is_one_shot) {
+        result = d_lexical_analyzer_use_stdin(&context, 0) != 0 ||
+                 _d_main_run_arguments(&context, argc, argv) != 0;
+    }
+    else {
+        result = d_synsem_analyzer_parse(&context) != 0;
     }
 
 
     /* Clean up */
 
-    d_synsem_analyzer_destroy();
-
-    d_lexical_analyzer_destroy();
+    d_context_destroy(&context);
 
-    d_symbol_table_destroy();
-    
 
-    return 0;
+    return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
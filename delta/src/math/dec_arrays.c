@@ -0,0 +1,858 @@
+/**
+ * @file dec_arrays.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of math/dec_arrays.h
+ */
+
+
+#include "math/dec_arrays.h"
+
+#include "common/errors.h"
+
+
+// fmod, pow
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+// strchr
+#include <string.h>
+
+// To operate on several elements at once
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+
+/* The same few operations are needed with either instruction set. Neither
+   of them can multiply, divide nor convert 64-bit integers, so those are
+   left to the scalar loops */
+#if defined(__AVX2__)
+
+/** How many elements are operated on at once. */
+#define D_DEC_ARRAYS_LANES 4
+
+#define D_DEC_ARRAYS_VECTOR_PD __m256d
+#define D_DEC_ARRAYS_LOAD_PD(pointer) _mm256_loadu_pd(pointer)
+#define D_DEC_ARRAYS_STORE_PD(pointer, a) _mm256_storeu_pd((pointer), (a))
+#define D_DEC_ARRAYS_SET_PD(value) _mm256_set1_pd(value)
+#define D_DEC_ARRAYS_ADD_PD(a, b) _mm256_add_pd((a), (b))
+#define D_DEC_ARRAYS_SUB_PD(a, b) _mm256_sub_pd((a), (b))
+#define D_DEC_ARRAYS_MUL_PD(a, b) _mm256_mul_pd((a), (b))
+#define D_DEC_ARRAYS_DIV_PD(a, b) _mm256_div_pd((a), (b))
+#define D_DEC_ARRAYS_XOR_PD(a, b) _mm256_xor_pd((a), (b))
+
+#define D_DEC_ARRAYS_VECTOR_EPI64 __m256i
+#define D_DEC_ARRAYS_LOAD_EPI64(pointer) \
+    _mm256_loadu_si256((const __m256i *) (pointer))
+#define D_DEC_ARRAYS_STORE_EPI64(pointer, a) \
+    _mm256_storeu_si256((__m256i *) (pointer), (a))
+#define D_DEC_ARRAYS_SET_EPI64(value) _mm256_set1_epi64x(value)
+#define D_DEC_ARRAYS_ADD_EPI64(a, b) _mm256_add_epi64((a), (b))
+#define D_DEC_ARRAYS_SUB_EPI64(a, b) _mm256_sub_epi64((a), (b))
+
+#elif defined(__SSE2__)
+
+/** How many elements are operated on at once. */
+#define D_DEC_ARRAYS_LANES 2
+
+#define D_DEC_ARRAYS_VECTOR_PD __m128d
+#define D_DEC_ARRAYS_LOAD_PD(pointer) _mm_loadu_pd(pointer)
+#define D_DEC_ARRAYS_STORE_PD(pointer, a) _mm_storeu_pd((pointer), (a))
+#define D_DEC_ARRAYS_SET_PD(value) _mm_set1_pd(value)
+#define D_DEC_ARRAYS_ADD_PD(a, b) _mm_add_pd((a), (b))
+#define D_DEC_ARRAYS_SUB_PD(a, b) _mm_sub_pd((a), (b))
+#define D_DEC_ARRAYS_MUL_PD(a, b) _mm_mul_pd((a), (b))
+#define D_DEC_ARRAYS_DIV_PD(a, b) _mm_div_pd((a), (b))
+#define D_DEC_ARRAYS_XOR_PD(a, b) _mm_xor_pd((a), (b))
+
+#define D_DEC_ARRAYS_VECTOR_EPI64 __m128i
+#define D_DEC_ARRAYS_LOAD_EPI64(pointer) \
+    _mm_loadu_si128((const __m128i *) (pointer))
+#define D_DEC_ARRAYS_STORE_EPI64(pointer, a) \
+    _mm_storeu_si128((__m128i *) (pointer), (a))
+#define D_DEC_ARRAYS_SET_EPI64(value) _mm_set1_epi64x(value)
+#define D_DEC_ARRAYS_ADD_EPI64(a, b) _mm_add_epi64((a), (b))
+#define D_DEC_ARRAYS_SUB_EPI64(a, b) _mm_sub_epi64((a), (b))
+
+#endif
+
+
+/* Operates on as many whole vectors of elements as there are, from the i-th
+   one on, leaving "i" at the first element that is left. Single numbers
+   (whose step is 0) are loaded into every lane just once */
+#ifdef D_DEC_ARRAYS_LANES
+
+#define D_DEC_ARRAYS_VECTOR_LOOP(type, operate) \
+    do { \
+        D_DEC_ARRAYS_VECTOR_##type left_vector = \
+            D_DEC_ARRAYS_SET_##type(*left); \
+        D_DEC_ARRAYS_VECTOR_##type right_vector = \
+            D_DEC_ARRAYS_SET_##type(*right); \
+        \
+        for(; i + D_DEC_ARRAYS_LANES <= length; i += D_DEC_ARRAYS_LANES) { \
+            if(left_step != 0) { \
+                left_vector = D_DEC_ARRAYS_LOAD_##type(left + i); \
+            } \
+            if(right_step != 0) { \
+                right_vector = D_DEC_ARRAYS_LOAD_##type(right + i); \
+            } \
+            D_DEC_ARRAYS_STORE_##type(result + i, \
+                                      operate(left_vector, right_vector)); \
+        } \
+    } while(0)
+
+#else
+
+// All elements are left to the scalar loops
+#define D_DEC_ARRAYS_VECTOR_LOOP(type, operate) \
+    do { \
+        (void) left; \
+        (void) left_step; \
+        (void) right_step; \
+    } while(0)
+
+#endif
+
+
+/** How many elements of integer arrays are converted at once into floating
+    point numbers, when they are operated with floating point ones. */
+#define D_DEC_ARRAYS_BLOCK_LENGTH 256
+
+/** Least amount of bytes that must have been used since the last collection
+    in order to collect the heap again. */
+#define D_DEC_ARRAYS_MIN_COLLECTION_SIZE (8 * 1024 * 1024)
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays
+ */
+struct d_dec_arrays {
+    /** All arrays, the most recently built ones first. */
+    struct d_dec_array *arrays;
+
+    /** How many bytes the arrays that have been built since the last
+        collection take. */
+    size_t new_size;
+
+    /** How many bytes the arrays that were still reachable in the last
+        collection take. It is how much memory must be used again before the
+        next one, so that collecting takes amortized constant time. */
+    size_t live_size;
+};
+
+
+/**
+ * @brief Returns how many bytes an array of the given length takes.
+ */
+size_t _d_dec_arrays_size(
+    size_t length
+)
+{
+    return sizeof(struct d_dec_array) + length * sizeof(d_dec_number_values);
+}
+
+
+/**
+ * @brief Allocates a new array of the given length from the given heap.
+ *
+ * @param[in,out] arrays The heap.
+ * @param[in] length How many elements the array has.
+ * @param[in] function Name of the function that needs the array, where any
+ *                     errors are reported.
+ *
+ * @return The array, whose elements are left uninitialized, or NULL if
+ *         failed.
+ */
+struct d_dec_array *_d_dec_arrays_new(
+    struct d_dec_arrays *arrays,
+    size_t length,
+    const char *function
+)
+{
+    struct d_dec_array *array = NULL;
+
+
+    if(length > (SIZE_MAX - sizeof(struct d_dec_array)) /
+                sizeof(d_dec_number_values) ||
+       (array = malloc(_d_dec_arrays_size(length))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "dec_arrays.c", function,
+                               "'malloc' for an array");
+        return NULL;
+    }
+
+    array->length = length;
+    array->is_marked = 0;
+    array->hold_count = 0;
+    array->next = arrays->arrays;
+
+    arrays->arrays = array;
+    arrays->new_size += _d_dec_arrays_size(length);
+
+
+    return array;
+}
+
+
+/**
+ * @brief Sets the given array as the given value.
+ */
+void _d_dec_arrays_set(
+    struct d_dec_number *value,
+    struct d_dec_array *array,
+    int is_floating
+)
+{
+    value->is_floating = (uint8_t) is_floating;
+    value->is_array = 1;
+    value->values.array = array;
+}
+
+
+/**
+ * @brief Applies the given operation to each pair of floating point
+ *        elements.
+ *
+ * @param[in] operation The symbol that represents the operation (+, -, *,
+ *                      /, %, ^).
+ * @param[out] result Where to write the results.
+ * @param[in] left The first operands.
+ * @param[in] left_step 1 if "left" is an array, 0 if it is a single number.
+ * @param[in] right The second operands.
+ * @param[in] right_step 1 if "right" is an array, 0 if it is a single
+ *                       number.
+ * @param[in] length How many results there are.
+ */
+void _d_dec_arrays_floating_kernel(
+    char operation,
+    double *result,
+    const double *left,
+    size_t left_step,
+    const double *right,
+    size_t right_step,
+    size_t length
+)
+{
+    size_t i = 0;
+
+
+    switch(operation) {
+
+        case '+':
+            D_DEC_ARRAYS_VECTOR_LOOP(PD, D_DEC_ARRAYS_ADD_PD);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] + right[i * right_step];
+            }
+            break;
+
+        case '-':
+            D_DEC_ARRAYS_VECTOR_LOOP(PD, D_DEC_ARRAYS_SUB_PD);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] - right[i * right_step];
+            }
+            break;
+
+        case '*':
+            D_DEC_ARRAYS_VECTOR_LOOP(PD, D_DEC_ARRAYS_MUL_PD);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] * right[i * right_step];
+            }
+            break;
+
+        case '/':
+            D_DEC_ARRAYS_VECTOR_LOOP(PD, D_DEC_ARRAYS_DIV_PD);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] / right[i * right_step];
+            }
+            break;
+
+        case '%':
+            for(; i < length; ++i) {
+                result[i] = fmod(left[i * left_step], right[i * right_step]);
+            }
+            break;
+
+        default:
+            for(; i < length; ++i) {
+                result[i] = pow(left[i * left_step], right[i * right_step]);
+            }
+            break;
+    }
+}
+
+
+/**
+ * @brief Applies the given operation to each pair of integer elements.
+ *
+ * @details
+ *  Just as "_d_dec_arrays_floating_kernel", but with integers.
+ */
+void _d_dec_arrays_integer_kernel(
+    char operation,
+    int64_t *result,
+    const int64_t *left,
+    size_t left_step,
+    const int64_t *right,
+    size_t right_step,
+    size_t length
+)
+{
+    size_t i = 0;
+
+
+    switch(operation) {
+
+        case '+':
+            D_DEC_ARRAYS_VECTOR_LOOP(EPI64, D_DEC_ARRAYS_ADD_EPI64);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] + right[i * right_step];
+            }
+            break;
+
+        case '-':
+            D_DEC_ARRAYS_VECTOR_LOOP(EPI64, D_DEC_ARRAYS_SUB_EPI64);
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] - right[i * right_step];
+            }
+            break;
+
+        case '*':
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] * right[i * right_step];
+            }
+            break;
+
+        case '/':
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] / right[i * right_step];
+            }
+            break;
+
+        case '%':
+            for(; i < length; ++i) {
+                result[i] = left[i * left_step] % right[i * right_step];
+            }
+            break;
+
+        default:
+            for(; i < length; ++i) {
+                result[i] = (int64_t) pow(left[i * left_step],
+                                          right[i * right_step]);
+            }
+            break;
+    }
+}
+
+
+/**
+ * @brief Negates each floating point element.
+ *
+ * @details
+ *  Just as the unary minus, only the sign bit is flipped, so even NaNs and
+ *  zeros get the opposite sign.
+ *
+ * @param[out] result Where to write the results.
+ * @param[in] right The elements.
+ * @param[in] length How many elements there are.
+ */
+void _d_dec_arrays_floating_negation_kernel(
+    double *result,
+    const double *right,
+    size_t length
+)
+{
+    const double sign_bit = -0.0;
+    const double *left = &sign_bit;
+    const size_t left_step = 0;
+    const size_t right_step = 1;
+    size_t i = 0;
+
+
+    D_DEC_ARRAYS_VECTOR_LOOP(PD, D_DEC_ARRAYS_XOR_PD);
+
+    for(; i < length; ++i) {
+        result[i] = -(right[i]);
+    }
+}
+
+
+/**
+ * @brief Returns the floating point values of the given block of elements
+ *        of the given value.
+ *
+ * @param[in] value The value, which may be a single number.
+ * @param[in] first The first element of the block.
+ * @param[in] count How many elements the block has, at most
+ *                  D_DEC_ARRAYS_BLOCK_LENGTH.
+ * @param[out] buffer Where integers are converted, if needed.
+ * @param[out] step 1 if the value is an array, 0 otherwise.
+ *
+ * @return The values.
+ */
+const double *_d_dec_arrays_get_floating_block(
+    const struct d_dec_number *value,
+    size_t first,
+    size_t count,
+    double *buffer,
+    size_t *step
+)
+{
+    const d_dec_number_values *elements = NULL;
+    size_t i = 0;
+
+
+    if(!value->is_array) {
+
+        *step = 0;
+        buffer[0] = value->is_floating ? value->values.floating :
+                                         (double) value->values.integer;
+        return buffer;
+    }
+
+    *step = 1;
+    elements = value->values.array->elements + first;
+
+    if(value->is_floating) {
+        return &(elements->floating);
+    }
+
+    for(i = 0; i < count; ++i) {
+        buffer[i] = (double) elements[i].integer;
+    }
+
+
+    return buffer;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_initialize
+ */
+int d_dec_arrays_initialize(
+    struct d_dec_arrays **arrays
+)
+{
+    if(arrays == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "dec_arrays.c",
+                               "d_dec_arrays_initialize", "'arrays'");
+        return -1;
+    }
+
+
+    if((*arrays = malloc(sizeof(struct d_dec_arrays))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                               "dec_arrays.c", "d_dec_arrays_initialize",
+                               "'malloc' for the heap");
+        return -1;
+    }
+
+    (*arrays)->arrays = NULL;
+    (*arrays)->new_size = 0;
+    (*arrays)->live_size = 0;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_destroy
+ */
+int d_dec_arrays_destroy(
+    struct d_dec_arrays *arrays
+)
+{
+    struct d_dec_array *array = NULL;
+    struct d_dec_array *next = NULL;
+
+
+    if(arrays == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "dec_arrays.c",
+                               "d_dec_arrays_destroy", "'arrays'");
+        return -1;
+    }
+
+
+    for(array = arrays->arrays; array != NULL; array = next) {
+        next = array->next;
+        free(array);
+    }
+
+    free(arrays);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_is_collection_due
+ */
+int d_dec_arrays_is_collection_due(
+    const struct d_dec_arrays *arrays
+)
+{
+    return arrays->new_size >= D_DEC_ARRAYS_MIN_COLLECTION_SIZE &&
+           arrays->new_size >= arrays->live_size;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_mark
+ */
+void d_dec_arrays_mark(
+    const struct d_dec_number *values,
+    size_t count
+)
+{
+    size_t i = 0;
+
+
+    for(i = 0; i < count; ++i) {
+        if(values[i].is_array) {
+            values[i].values.array->is_marked = 1;
+        }
+    }
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_hold
+ */
+void d_dec_arrays_hold(
+    const struct d_dec_number *value
+)
+{
+    if(value->is_array) {
+        ++(value->values.array->hold_count);
+    }
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_release
+ */
+void d_dec_arrays_release(
+    const struct d_dec_number *value
+)
+{
+    if(value->is_array && value->values.array->hold_count > 0) {
+        --(value->values.array->hold_count);
+    }
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_sweep
+ */
+void d_dec_arrays_sweep(
+    struct d_dec_arrays *arrays
+)
+{
+    struct d_dec_array **link = &(arrays->arrays);
+    struct d_dec_array *array = NULL;
+
+
+    arrays->new_size = 0;
+    arrays->live_size = 0;
+
+    while((array = *link) != NULL) {
+
+        if(array->is_marked || array->hold_count > 0) {
+
+            array->is_marked = 0;
+            arrays->live_size += _d_dec_arrays_size(array->length);
+            link = &(array->next);
+        }
+
+        else {
+            *link = array->next;
+            free(array);
+        }
+    }
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_build
+ */
+int d_dec_arrays_build(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *values,
+    size_t count,
+    struct d_dec_number *result
+)
+{
+    struct d_dec_array *array = NULL;
+    size_t i = 0;
+    int is_floating = 0;
+
+
+    // If any element is a floating point number, all of them are
+    for(i = 0; i < count; ++i) {
+
+        if(values[i].is_array) {
+            return D_DEC_ARRAYS_NESTED;
+        }
+
+        is_floating |= values[i].is_floating;
+    }
+
+    if((array = _d_dec_arrays_new(arrays, count, "d_dec_arrays_build"))
+       == NULL) {
+        return -1;
+    }
+
+
+    for(i = 0; i < count; ++i) {
+
+        if(is_floating && !values[i].is_floating) {
+            array->elements[i].floating = (double) values[i].values.integer;
+        }
+
+        else {
+            array->elements[i] = values[i].values;
+        }
+    }
+
+    _d_dec_arrays_set(result, array, is_floating);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_has_zero
+ */
+int d_dec_arrays_has_zero(
+    const struct d_dec_number *value
+)
+{
+    const struct d_dec_array *array = NULL;
+    size_t i = 0;
+
+
+    if(!value->is_array) {
+        return value->is_floating ? value->values.floating == 0.0 :
+                                    value->values.integer == 0;
+    }
+
+    array = value->values.array;
+
+    for(i = 0; i < array->length; ++i) {
+
+        if(value->is_floating ? array->elements[i].floating == 0.0 :
+                                array->elements[i].integer == 0) {
+            return 1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_compute_operation
+ */
+int d_dec_arrays_compute_operation(
+    struct d_dec_arrays *arrays,
+    char operation,
+    const struct d_dec_number *value_1,
+    const struct d_dec_number *value_2,
+    struct d_dec_number *result
+)
+{
+    double left_buffer[D_DEC_ARRAYS_BLOCK_LENGTH];
+    double right_buffer[D_DEC_ARRAYS_BLOCK_LENGTH];
+    const double *left = NULL;
+    const double *right = NULL;
+    size_t left_step = 0;
+    size_t right_step = 0;
+
+    struct d_dec_array *array = NULL;
+    size_t length_1 = value_1->is_array ? value_1->values.array->length : 0;
+    size_t length_2 = value_2->is_array ? value_2->values.array->length : 0;
+    size_t length = (length_1 > length_2) ? length_1 : length_2;
+    size_t first = 0;
+    size_t count = 0;
+    int is_floating = value_1->is_floating || value_2->is_floating;
+
+
+    if(operation == '\0' || strchr("+-*/%^", operation) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID,
+                               "dec_arrays.c",
+                               "d_dec_arrays_compute_operation",
+                               "the specified operation is not supported");
+        return -1;
+    }
+
+    if(length_1 != 0 && length_2 != 0 && length_1 != length_2) {
+        return D_DEC_ARRAYS_LENGTHS_DIFFER;
+    }
+
+    if((array = _d_dec_arrays_new(arrays, length,
+                                  "d_dec_arrays_compute_operation"))
+       == NULL) {
+        return -1;
+    }
+
+
+    // Integers are converted block by block, so that they are still in the
+    // cache when they are operated on
+    if(is_floating) {
+
+        for(first = 0; first < length; first += count) {
+
+            count = length - first;
+
+            if(count > D_DEC_ARRAYS_BLOCK_LENGTH) {
+                count = D_DEC_ARRAYS_BLOCK_LENGTH;
+            }
+
+            left = _d_dec_arrays_get_floating_block(value_1, first, count,
+                                                    left_buffer, &left_step);
+            right = _d_dec_arrays_get_floating_block(value_2, first, count,
+                                                     right_buffer,
+                                                     &right_step);
+
+            _d_dec_arrays_floating_kernel(operation,
+                                          &(array->elements[first].floating),
+                                          left, left_step, right, right_step,
+                                          count);
+        }
+    }
+
+    else {
+        _d_dec_arrays_integer_kernel(
+            operation, &(array->elements[0].integer),
+            value_1->is_array ? &(value_1->values.array->elements[0].integer) :
+                                &(value_1->values.integer),
+            value_1->is_array,
+            value_2->is_array ? &(value_2->values.array->elements[0].integer) :
+                                &(value_2->values.integer),
+            value_2->is_array, length
+        );
+    }
+
+    _d_dec_arrays_set(result, array, is_floating);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_negate
+ */
+int d_dec_arrays_negate(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+)
+{
+    const struct d_dec_array *operand = value->values.array;
+    struct d_dec_array *array = NULL;
+    int is_floating = value->is_floating;
+
+    // 0 - x is -x for integers
+    const int64_t integer_zero = 0;
+
+
+    if((array = _d_dec_arrays_new(arrays, operand->length,
+                                  "d_dec_arrays_negate")) == NULL) {
+        return -1;
+    }
+
+    if(is_floating) {
+        _d_dec_arrays_floating_negation_kernel(
+            &(array->elements[0].floating), &(operand->elements[0].floating),
+            operand->length
+        );
+    }
+
+    else {
+        _d_dec_arrays_integer_kernel('-', &(array->elements[0].integer),
+                                     &integer_zero, 0,
+                                     &(operand->elements[0].integer), 1,
+                                     operand->length);
+    }
+
+    _d_dec_arrays_set(result, array, is_floating);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_to_floating
+ */
+int d_dec_arrays_to_floating(
+    struct d_dec_arrays *arrays,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+)
+{
+    const struct d_dec_array *operand = value->values.array;
+    struct d_dec_array *array = NULL;
+    size_t i = 0;
+
+
+    if((array = _d_dec_arrays_new(arrays, operand->length,
+                                  "d_dec_arrays_to_floating")) == NULL) {
+        return -1;
+    }
+
+    for(i = 0; i < operand->length; ++i) {
+        array->elements[i].floating = (double) operand->elements[i].integer;
+    }
+
+    _d_dec_arrays_set(result, array, 1);
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Implementation of dec_arrays.h/d_dec_arrays_apply_function
+ */
+int d_dec_arrays_apply_function(
+    struct d_dec_arrays *arrays,
+    d_dec_function function,
+    const struct d_dec_number *value,
+    struct d_dec_number *result
+)
+{
+    const struct d_dec_array *operand = value->values.array;
+    struct d_dec_array *array = NULL;
+    size_t i = 0;
+
+
+    if((array = _d_dec_arrays_new(arrays, operand->length,
+                                  "d_dec_arrays_apply_function")) == NULL) {
+        return -1;
+    }
+
+    // Math functions may come from any dynamic library, so they can only be
+    // called one element at a time
+    for(i = 0; i < operand->length; ++i) {
+        array->elements[i].floating = function(operand->elements[i].floating);
+    }
+
+    _d_dec_arrays_set(result, array, 1);
+
+
+    return 0;
+}
@@ -0,0 +1,1112 @@
+/**
+ * @file server.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Implementation of server/server.h
+ */
+
+
+// accept4
+#define _GNU_SOURCE
+
+
+#include "server/server.h"
+
+#include "api/delta.h"
+#include "common/errors.h"
+#include "math/dec_arrays.h"
+#include "math/dec_format.h"
+
+
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+// memchr, memcpy, memmove, memset, strlen
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/signalfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+/** How many events the main thread handles at most per wait. */
+#define D_SERVER_EVENTS_PER_WAIT 64
+
+/** How many bytes are read at most from a socket per event. */
+#define D_SERVER_READ_CHUNK_LENGTH (16 * 1024)
+
+/** How many connections may be waiting to be accepted. */
+#define D_SERVER_BACKLOG 128
+
+
+/**
+ * @brief Represents a client's connection.
+ *
+ * @details
+ *  Its buffers and flags are shared by the main thread and the workers, so
+ *  they are guarded by the server's lock. Its context, however, is only used
+ *  by the worker to which the connection has been handed, if any.
+ */
+struct _d_server_connection {
+
+    /** The connection's socket. */
+    int socket;
+    /** The connection's own interpreter. */
+    struct d_context *context;
+
+    /** Bytes that have been received but not evaluated yet. */
+    char *input;
+    /** How many bytes are in "input". */
+    size_t input_length;
+    /** How many bytes "input" can hold. */
+    size_t input_capacity;
+
+    /** Answers that have not been sent yet. */
+    char *output;
+    /** How many bytes are in "output". */
+    size_t output_length;
+    /** How many bytes "output" can hold. */
+    size_t output_capacity;
+
+    /** If it is waiting for a worker, or a worker is evaluating one of its
+        lines. */
+    int is_scheduled;
+    /** If it is waiting for the main thread to send its answers. */
+    int is_notified;
+    /** If its client will not send any more lines. */
+    int is_input_closed;
+    /** If it must be closed, without sending any more answers. */
+    int is_broken;
+
+    /** The events that the main thread waits for, or 0 if its socket has
+        been removed from epoll. Only used by the main thread. */
+    uint32_t events;
+
+    /** Next connection waiting for a worker. */
+    struct _d_server_connection *next_scheduled;
+    /** Next connection waiting for the main thread. */
+    struct _d_server_connection *next_notified;
+
+    /** Previous connection in the list of all connections. */
+    struct _d_server_connection *previous;
+    /** Next connection in the list of all connections. */
+    struct _d_server_connection *next;
+};
+
+
+/**
+ * @brief Represents the state of the server.
+ */
+struct _d_server {
+
+    /** The listening socket. */
+    int listener;
+    /** The epoll instance, through which the main thread waits. */
+    int epoll;
+    /** Eventfd through which workers wake the main thread up. */
+    int wakeup;
+    /** Signalfd through which SIGINT and SIGTERM are received. */
+    int signals;
+
+    /** The signal mask before the server started. */
+    sigset_t previous_signal_mask;
+
+    /** Guards the connections' buffers and flags, and the lists below. */
+    pthread_mutex_t lock;
+    /** Signaled when a connection is waiting for a worker. */
+    pthread_cond_t work_available;
+
+    /** First connection waiting for a worker. */
+    struct _d_server_connection *scheduled_head;
+    /** Last connection waiting for a worker. */
+    struct _d_server_connection *scheduled_tail;
+    /** Connections waiting for the main thread, in no specific order. */
+    struct _d_server_connection *notified;
+    /** All connections. Only used by the main thread. */
+    struct _d_server_connection *connections;
+
+    /** If the workers must stop. */
+    int is_stopping;
+
+    /** The workers. */
+    pthread_t *workers;
+    /** How many workers have been started. */
+    size_t worker_count;
+};
+
+
+/**
+ * @brief Appends the given bytes to a buffer, enlarging it if needed.
+ *
+ * @param[in,out] buffer The buffer.
+ * @param[in,out] length How many bytes are in the buffer.
+ * @param[in,out] capacity How many bytes the buffer can hold.
+ * @param[in] data The bytes.
+ * @param[in] data_length How many bytes there are.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_server_append(
+    char **buffer,
+    size_t *length,
+    size_t *capacity,
+    const char *data,
+    size_t data_length
+)
+{
+    size_t new_capacity = 0;
+    char *new_buffer = NULL;
+
+
+    if(*length + data_length > *capacity) {
+
+        new_capacity = (*capacity > 0) ? *capacity : 256;
+
+        while(new_capacity < *length + data_length) {
+            new_capacity *= 2;
+        }
+
+        if((new_buffer = realloc(*buffer, new_capacity)) == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                                   "_d_server_append", "'realloc' of a "
+                                   "buffer");
+            return -1;
+        }
+
+        *buffer = new_buffer;
+        *capacity = new_capacity;
+    }
+
+    memcpy(*buffer + *length, data, data_length);
+    *length += data_length;
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Hands the given connection to the workers, if it has any complete
+ *        line and it has not been handed yet.
+ *
+ * @details
+ *  The server's lock must be held.
+ *
+ * @param[in,out] server The server.
+ * @param[in,out] connection The connection.
+ */
+void _d_server_schedule(
+    struct _d_server *server,
+    struct _d_server_connection *connection
+)
+{
+    if(connection->is_scheduled || connection->is_broken ||
+       memchr(connection->input, '\n', connection->input_length) == NULL) {
+        return;
+    }
+
+
+    connection->is_scheduled = 1;
+    connection->next_scheduled = NULL;
+
+    if(server->scheduled_tail != NULL) {
+        server->scheduled_tail->next_scheduled = connection;
+    }
+    else {
+        server->scheduled_head = connection;
+    }
+
+    server->scheduled_tail = connection;
+
+    pthread_cond_signal(&(server->work_available));
+}
+
+
+/**
+ * @brief Writes the answer that corresponds to the given evaluation.
+ *
+ * @param[in] result What "d_ctx_eval" returned.
+ * @param[in] value The value that "d_ctx_eval" handed back, if any.
+ * @param[in,out] answer Where to write the '\n' terminated answer, which is
+ *                       enlarged if needed, as arrays may be of any length.
+ * @param[out] answer_length The length of the answer.
+ * @param[in,out] answer_capacity How many bytes "answer" can hold.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_server_write_answer(
+    int result,
+    const struct d_dec_number *value,
+    char **answer,
+    size_t *answer_length,
+    size_t *answer_capacity
+)
+{
+    char text[D_DEC_FORMAT_MAX_ELEMENT_LENGTH];
+    size_t length = 0;
+    size_t i = 0;
+
+
+    *answer_length = 0;
+
+    if(result == 1) {
+        return _d_server_append(answer, answer_length, answer_capacity, "\n",
+                                1);
+    }
+
+    else if(result != 0) {
+        return _d_server_append(answer, answer_length, answer_capacity,
+                                "error\n", 6);
+    }
+
+
+    if(!value->is_array) {
+        length = d_dec_format_number(value, text);
+
+        if(_d_server_append(answer, answer_length, answer_capacity, text,
+                            length) != 0) {
+            return -1;
+        }
+    }
+
+    else {
+        for(i = 0; i < value->values.array->length; ++i) {
+
+            length = d_dec_format_element(value, i, text);
+
+            if(_d_server_append(answer, answer_length, answer_capacity, text,
+                                length) != 0) {
+                return -1;
+            }
+        }
+    }
+
+
+    return _d_server_append(answer, answer_length, answer_capacity, "\n", 1);
+}
+
+
+/**
+ * @brief Evaluates lines on behalf of the connections, until the server
+ *        stops.
+ *
+ * @details
+ *  Each worker takes the first connection that is waiting, evaluates just
+ *  one of its lines, and puts the connection back at the end of the queue if
+ *  it has any more. Therefore, connections are served fairly, and a
+ *  connection is never handed to two workers at the same time.
+ *
+ * @param[in,out] argument The server.
+ *
+ * @return NULL.
+ */
+void *_d_server_work(
+    void *argument
+)
+{
+    struct _d_server *server = argument;
+    struct _d_server_connection *connection = NULL;
+
+    char *line = NULL;
+    size_t line_length = 0;
+    const char *line_end = NULL;
+
+    int evaluation = 0;
+    int result = 0;
+    struct d_dec_number value;
+    char *answer = NULL;
+    size_t answer_length = 0;
+    size_t answer_capacity = 0;
+
+    uint64_t wakeup = 1;
+
+
+    if((line = malloc(D_SERVER_MAX_LINE_LENGTH)) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_work", "'malloc' of the line");
+        return NULL;
+    }
+
+
+    pthread_mutex_lock(&(server->lock));
+
+    while(1) {
+
+        while(!server->is_stopping && server->scheduled_head == NULL) {
+            pthread_cond_wait(&(server->work_available), &(server->lock));
+        }
+
+        if(server->is_stopping) {
+            break;
+        }
+
+        connection = server->scheduled_head;
+        server->scheduled_head = connection->next_scheduled;
+
+        if(server->scheduled_head == NULL) {
+            server->scheduled_tail = NULL;
+        }
+
+
+        // The line is taken out of the input, as the main thread may keep
+        // appending to it while the line is being evaluated
+        line_end = memchr(connection->input, '\n', connection->input_length);
+        line_length = line_end - connection->input + 1;
+
+        if(connection->is_broken) {
+            // Its client has gone away meanwhile
+        }
+
+        else if(line_length > D_SERVER_MAX_LINE_LENGTH) {
+            connection->is_broken = 1;
+        }
+
+        else {
+            memcpy(line, connection->input, line_length);
+            memmove(connection->input, connection->input + line_length,
+                    connection->input_length - line_length);
+            connection->input_length -= line_length;
+
+            pthread_mutex_unlock(&(server->lock));
+
+            evaluation = d_ctx_eval(connection->context, line, line_length,
+                                    &value);
+            result = _d_server_write_answer(evaluation, &value, &answer,
+                                            &answer_length, &answer_capacity);
+
+            // The value is no longer needed once written
+            if(evaluation == 0) {
+                d_ctx_release(connection->context, &value);
+            }
+
+            pthread_mutex_lock(&(server->lock));
+
+            if(result != 0 ||
+               _d_server_append(&(connection->output),
+                                &(connection->output_length),
+                                &(connection->output_capacity), answer,
+                                answer_length) != 0) {
+                connection->is_broken = 1;
+            }
+        }
+
+
+        // The connection goes back to the queue if it has more lines
+        connection->is_scheduled = 0;
+        _d_server_schedule(server, connection);
+
+        // Anyways, the main thread has to send the answer, or close the
+        // connection
+        if(!connection->is_notified) {
+
+            connection->is_notified = 1;
+            connection->next_notified = server->notified;
+            server->notified = connection;
+        }
+
+        pthread_mutex_unlock(&(server->lock));
+
+        if(write(server->wakeup, &wakeup, sizeof(wakeup)) < 0 &&
+           errno != EAGAIN) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                                   "_d_server_work", "'write' to the "
+                                   "eventfd");
+        }
+
+        pthread_mutex_lock(&(server->lock));
+    }
+
+    pthread_mutex_unlock(&(server->lock));
+
+    free(line);
+    free(answer);
+
+
+    return NULL;
+}
+
+
+/**
+ * @brief Closes the given connection, and frees it.
+ *
+ * @details
+ *  It may only be called by the main thread, once the connection is neither
+ *  scheduled nor notified.
+ *
+ * @param[in,out] server The server.
+ * @param[in,out] connection The connection.
+ */
+void _d_server_destroy_connection(
+    struct _d_server *server,
+    struct _d_server_connection *connection
+)
+{
+    if(connection->previous != NULL) {
+        connection->previous->next = connection->next;
+    }
+    else {
+        server->connections = connection->next;
+    }
+
+    if(connection->next != NULL) {
+        connection->next->previous = connection->previous;
+    }
+
+
+    // Closing the socket also removes it from epoll
+    close(connection->socket);
+
+    if(connection->context != NULL) {
+        d_ctx_free(connection->context);
+    }
+
+    free(connection->input);
+    free(connection->output);
+    free(connection);
+}
+
+
+/**
+ * @brief Accepts all the connections that are waiting.
+ *
+ * @param[in,out] server The server.
+ */
+void _d_server_accept(
+    struct _d_server *server
+)
+{
+    int socket = -1;
+    struct _d_server_connection *connection = NULL;
+    struct epoll_event event;
+
+
+    while((socket = accept4(server->listener, NULL, NULL,
+                            SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0) {
+
+        if((connection = calloc(1, sizeof(struct _d_server_connection)))
+           == NULL) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                                   "_d_server_accept", "'calloc' of a "
+                                   "connection");
+            close(socket);
+            continue;
+        }
+
+        connection->socket = socket;
+        connection->next = server->connections;
+
+        if(server->connections != NULL) {
+            server->connections->previous = connection;
+        }
+
+        server->connections = connection;
+
+
+        if((connection->context = d_ctx_new()) == NULL) {
+
+            _d_server_destroy_connection(server, connection);
+            continue;
+        }
+
+        connection->context->is_sandboxed = 1;
+
+        event.events = EPOLLIN;
+        event.data.ptr = connection;
+
+        if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, socket, &event) != 0) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                                   "_d_server_accept", "'epoll_ctl' of a "
+                                   "connection");
+            _d_server_destroy_connection(server, connection);
+            continue;
+        }
+
+        connection->events = EPOLLIN;
+    }
+
+    if(errno != EAGAIN && errno != EWOULDBLOCK && errno != ECONNABORTED &&
+       errno != EINTR) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_accept", "'accept4'");
+    }
+}
+
+
+/**
+ * @brief Receives bytes from the given connection, and hands it to the
+ *        workers if it has any complete lines.
+ *
+ * @param[in,out] server The server.
+ * @param[in,out] connection The connection.
+ */
+void _d_server_receive(
+    struct _d_server *server,
+    struct _d_server_connection *connection
+)
+{
+    char chunk[D_SERVER_READ_CHUNK_LENGTH];
+    ssize_t chunk_length = 0;
+    size_t partial_line_length = 0;
+
+
+    chunk_length = recv(connection->socket, chunk, sizeof(chunk), 0);
+
+    if(chunk_length < 0 && (errno == EAGAIN || errno == EWOULDBLOCK ||
+                            errno == EINTR)) {
+        return;
+    }
+
+
+    pthread_mutex_lock(&(server->lock));
+
+    if(chunk_length < 0) {
+        connection->is_broken = 1;
+    }
+
+    else if(chunk_length == 0) {
+        connection->is_input_closed = 1;
+    }
+
+    else if(_d_server_append(&(connection->input),
+                             &(connection->input_length),
+                             &(connection->input_capacity), chunk,
+                             chunk_length) != 0) {
+        connection->is_broken = 1;
+    }
+
+    else {
+        // Lines must not grow indefinitely while waiting for their '\n'
+        while(partial_line_length < connection->input_length &&
+              connection->input[connection->input_length -
+                                partial_line_length - 1] != '\n') {
+            ++partial_line_length;
+        }
+
+        if(partial_line_length >= D_SERVER_MAX_LINE_LENGTH) {
+            connection->is_broken = 1;
+        }
+
+        _d_server_schedule(server, connection);
+    }
+
+    pthread_mutex_unlock(&(server->lock));
+}
+
+
+/**
+ * @brief Sends as many answers of the given connection as the socket
+ *        accepts.
+ *
+ * @param[in,out] server The server.
+ * @param[in,out] connection The connection.
+ */
+void _d_server_send(
+    struct _d_server *server,
+    struct _d_server_connection *connection
+)
+{
+    ssize_t sent_length = 0;
+
+
+    pthread_mutex_lock(&(server->lock));
+
+    while(!connection->is_broken && connection->output_length > 0) {
+
+        // MSG_NOSIGNAL, so that clients that go away do not kill the server
+        // through SIGPIPE
+        sent_length = send(connection->socket, connection->output,
+                           connection->output_length, MSG_NOSIGNAL);
+
+        if(sent_length < 0) {
+
+            if(errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                connection->is_broken = 1;
+            }
+
+            if(errno != EINTR) {
+                break;
+            }
+        }
+
+        else {
+            memmove(connection->output, connection->output + sent_length,
+                    connection->output_length - sent_length);
+            connection->output_length -= sent_length;
+        }
+    }
+
+    pthread_mutex_unlock(&(server->lock));
+}
+
+
+/**
+ * @brief Updates which events the main thread waits for on the given
+ *        connection, or closes it if it is done.
+ *
+ * @details
+ *  A connection is done once it is neither scheduled nor notified, and it
+ *  is either broken, or its client will not send any more lines and all of
+ *  its answers have been sent.
+ *
+ *  The main thread stops reading from connections that have too many bytes
+ *  pending, until their clients read their answers.
+ *
+ * @param[in,out] server The server.
+ * @param[in,out] connection The connection.
+ */
+void _d_server_update(
+    struct _d_server *server,
+    struct _d_server_connection *connection
+)
+{
+    int is_done = 0;
+    uint32_t events = 0;
+    int operation = 0;
+    struct epoll_event event;
+
+
+    pthread_mutex_lock(&(server->lock));
+
+    if(!connection->is_scheduled && !connection->is_notified) {
+
+        is_done = connection->is_broken ||
+                  (connection->is_input_closed &&
+                   connection->output_length == 0 &&
+                   memchr(connection->input, '\n',
+                          connection->input_length) == NULL);
+    }
+
+    if(!connection->is_broken) {
+
+        if(!connection->is_input_closed &&
+           connection->input_length + connection->output_length <
+           D_SERVER_MAX_PENDING_LENGTH) {
+            events |= EPOLLIN;
+        }
+
+        if(connection->output_length > 0) {
+            events |= EPOLLOUT;
+        }
+    }
+
+    pthread_mutex_unlock(&(server->lock));
+
+
+    if(is_done) {
+        _d_server_destroy_connection(server, connection);
+        return;
+    }
+
+    if(events == connection->events) {
+        return;
+    }
+
+
+    // Sockets are removed from epoll while there is nothing to wait for, as
+    // broken or half-closed ones would keep reporting events until a worker
+    // is done with them
+    if(events == 0) {
+        operation = EPOLL_CTL_DEL;
+    }
+    else if(connection->events == 0) {
+        operation = EPOLL_CTL_ADD;
+    }
+    else {
+        operation = EPOLL_CTL_MOD;
+    }
+
+    event.events = events;
+    event.data.ptr = connection;
+
+    if(epoll_ctl(server->epoll, operation, connection->socket, &event)
+       != 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_update", "'epoll_ctl' of a "
+                               "connection");
+    }
+
+    connection->events = events;
+}
+
+
+/**
+ * @brief Sends the answers of the connections that the workers have
+ *        notified.
+ *
+ * @param[in,out] server The server.
+ */
+void _d_server_collect(
+    struct _d_server *server
+)
+{
+    uint64_t wakeups = 0;
+    struct _d_server_connection *connection = NULL;
+    struct _d_server_connection *next = NULL;
+
+
+    if(read(server->wakeup, &wakeups, sizeof(wakeups)) < 0 &&
+       errno != EAGAIN) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_collect", "'read' of the eventfd");
+    }
+
+
+    pthread_mutex_lock(&(server->lock));
+
+    connection = server->notified;
+    server->notified = NULL;
+
+    for(next = connection; next != NULL; next = next->next_notified) {
+        next->is_notified = 0;
+    }
+
+    pthread_mutex_unlock(&(server->lock));
+
+
+    // Workers may notify these connections again meanwhile, but they are
+    // only destroyed by this thread, so they remain valid
+    while(connection != NULL) {
+
+        next = connection->next_notified;
+
+        _d_server_send(server, connection);
+        _d_server_update(server, connection);
+
+        connection = next;
+    }
+}
+
+
+/**
+ * @brief Creates the listening socket.
+ *
+ * @param[in,out] server The server.
+ * @param[in] socket_path Path to the socket.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_server_listen(
+    struct _d_server *server,
+    const char *socket_path
+)
+{
+    struct sockaddr_un address;
+    struct stat status;
+
+
+    if(strlen(socket_path) >= sizeof(address.sun_path)) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_INVALID, "server.c",
+                               "_d_server_listen", "'socket_path' is too "
+                               "long");
+        return -1;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, socket_path, strlen(socket_path));
+
+
+    // Stale sockets from previous runs are replaced, but nothing else is
+    if(lstat(socket_path, &status) == 0 && S_ISSOCK(status.st_mode)) {
+        unlink(socket_path);
+    }
+
+    if((server->listener = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK |
+                                  SOCK_CLOEXEC, 0)) < 0 ||
+       bind(server->listener, (struct sockaddr *) &address,
+            sizeof(address)) != 0 ||
+       listen(server->listener, D_SERVER_BACKLOG) != 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_listen", "'socket', 'bind' or "
+                               "'listen'");
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Starts the server.
+ *
+ * @details
+ *  SIGINT and SIGTERM are blocked before the workers are started, so that
+ *  they are only received through the signalfd.
+ *
+ * @param[in,out] server The server, which must be 0-initialized except for
+ *                       its file descriptors, which must be -1.
+ * @param[in] socket_path Path to the socket.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int _d_server_start(
+    struct _d_server *server,
+    const char *socket_path
+)
+{
+    sigset_t signals;
+    struct epoll_event event;
+    long processors = 0;
+
+
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+
+    if(pthread_sigmask(SIG_BLOCK, &signals, &(server->previous_signal_mask))
+       != 0 ||
+       (server->signals = signalfd(-1, &signals, SFD_NONBLOCK | SFD_CLOEXEC))
+       < 0 ||
+       (server->wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0 ||
+       (server->epoll = epoll_create1(EPOLL_CLOEXEC)) < 0) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_start", "'signalfd', 'eventfd' or "
+                               "'epoll_create1'");
+        return -1;
+    }
+
+    if(_d_server_listen(server, socket_path) != 0) {
+        return -1;
+    }
+
+
+    // The special file descriptors are told apart from the connections
+    // through the address of their fields
+    event.events = EPOLLIN;
+
+    event.data.ptr = &(server->listener);
+    if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, server->listener, &event)
+       != 0) {
+        goto epoll_failed;
+    }
+
+    event.data.ptr = &(server->wakeup);
+    if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, server->wakeup, &event)
+       != 0) {
+        goto epoll_failed;
+    }
+
+    event.data.ptr = &(server->signals);
+    if(epoll_ctl(server->epoll, EPOLL_CTL_ADD, server->signals, &event)
+       != 0) {
+        goto epoll_failed;
+    }
+
+
+    if((processors = sysconf(_SC_NPROCESSORS_ONLN)) < 1) {
+        processors = 1;
+    }
+
+    if((server->workers = malloc(processors * sizeof(pthread_t))) == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                               "_d_server_start", "'malloc' of the workers");
+        return -1;
+    }
+
+    for(; server->worker_count < (size_t) processors;
+        ++(server->worker_count)) {
+
+        if(pthread_create(&(server->workers[server->worker_count]), NULL,
+                          &_d_server_work, server) != 0) {
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                   "server.c", "_d_server_start",
+                                   "'pthread_create'");
+            return -1;
+        }
+    }
+
+
+    return 0;
+
+
+epoll_failed:
+    d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED, "server.c",
+                           "_d_server_start", "'epoll_ctl'");
+    return -1;
+}
+
+
+/**
+ * @brief Stops the server, closing all of its connections.
+ *
+ * @details
+ *  Workers finish evaluating their current lines before stopping.
+ *
+ * @param[in,out] server The server, which may have been partially started.
+ * @param[in] socket_path Path to the socket.
+ */
+void _d_server_stop(
+    struct _d_server *server,
+    const char *socket_path
+)
+{
+    size_t i = 0;
+
+
+    pthread_mutex_lock(&(server->lock));
+    server->is_stopping = 1;
+    pthread_cond_broadcast(&(server->work_available));
+    pthread_mutex_unlock(&(server->lock));
+
+    for(i = 0; i < server->worker_count; ++i) {
+        pthread_join(server->workers[i], NULL);
+    }
+
+    free(server->workers);
+
+
+    while(server->connections != NULL) {
+        _d_server_destroy_connection(server, server->connections);
+    }
+
+    if(server->listener >= 0) {
+        close(server->listener);
+        unlink(socket_path);
+    }
+
+    if(server->epoll >= 0) {
+        close(server->epoll);
+    }
+
+    if(server->wakeup >= 0) {
+        close(server->wakeup);
+    }
+
+    if(server->signals >= 0) {
+        close(server->signals);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &(server->previous_signal_mask), NULL);
+}
+
+
+/**
+ * @brief Implementation of server.h/d_server_run
+ */
+int d_server_run(
+    const char *socket_path
+)
+{
+    struct _d_server server;
+    struct epoll_event events[D_SERVER_EVENTS_PER_WAIT];
+    int event_count = 0;
+    int i = 0;
+
+    struct _d_server_connection *connection = NULL;
+    int has_notifications = 0;
+    int is_running = 1;
+
+
+    if(socket_path == NULL) {
+
+        d_errors_internal_show(4, D_ERR_INTERN_ARGUMENT_NULL, "server.c",
+                               "d_server_run", "'socket_path'");
+        return -1;
+    }
+
+
+    memset(&server, 0, sizeof(server));
+    server.listener = server.epoll = server.wakeup = server.signals = -1;
+    sigemptyset(&(server.previous_signal_mask));
+    pthread_mutex_init(&(server.lock), NULL);
+    pthread_cond_init(&(server.work_available), NULL);
+
+    if(_d_server_start(&server, socket_path) != 0) {
+
+        _d_server_stop(&server, socket_path);
+        pthread_cond_destroy(&(server.work_available));
+        pthread_mutex_destroy(&(server.lock));
+        return -1;
+    }
+
+
+    while(is_running) {
+
+        if((event_count = epoll_wait(server.epoll, events,
+                                     D_SERVER_EVENTS_PER_WAIT, -1)) < 0) {
+
+            if(errno == EINTR) {
+                continue;
+            }
+
+            d_errors_internal_show(4, D_ERR_INTERN_SYSCALL_FAILED,
+                                   "server.c", "d_server_run",
+                                   "'epoll_wait'");
+            break;
+        }
+
+        for(i = 0; i < event_count; ++i) {
+
+            if(events[i].data.ptr == &(server.signals)) {
+                is_running = 0;
+            }
+
+            else if(events[i].data.ptr == &(server.listener)) {
+                _d_server_accept(&server);
+            }
+
+            else if(events[i].data.ptr == &(server.wakeup)) {
+                has_notifications = 1;
+            }
+
+            else {
+                connection = events[i].data.ptr;
+
+                // Any remaining bytes are received before telling whether
+                // the client has gone away
+                if(events[i].events & EPOLLIN) {
+                    _d_server_receive(&server, connection);
+                }
+
+                if(events[i].events & (EPOLLERR | EPOLLHUP)) {
+
+                    pthread_mutex_lock(&(server.lock));
+                    connection->is_broken = 1;
+                    pthread_mutex_unlock(&(server.lock));
+                }
+
+                if(events[i].events & EPOLLOUT) {
+                    _d_server_send(&server, connection);
+                }
+
+                _d_server_update(&server, connection);
+            }
+        }
+
+        // Notified connections may be closed, so they are handled once no
+        // other events may reference them
+        if(has_notifications) {
+            _d_server_collect(&server);
+            has_notifications = 0;
+        }
+    }
+
+
+    _d_server_stop(&server, socket_path);
+    pthread_cond_destroy(&(server.work_available));
+    pthread_mutex_destroy(&(server.lock));
+
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file release_test.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Test of the arrays that the embedding API (see api/delta.h) hands
+ *        back, which must stay valid until they are released.
+ *
+ * @details
+ *  Evaluates a small array and keeps it, while evaluating (and releasing)
+ *  enough large arrays for their heap to be collected several times. The
+ *  kept array is then assigned to a variable, released, and read back
+ *  through the variable after a few more collections.
+ *
+ *    delta_release_test
+ *
+ *  It is meant to be run under AddressSanitizer or Valgrind too, which tell
+ *  if any array is used after being freed.
+ */
+
+
+#include "api/delta.h"
+
+#include "math/dec_arrays.h"
+
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+
+/** How many elements the large arrays have. */
+#define TEST_LENGTH 1000
+
+/** How many large arrays are evaluated each time, which take several times
+    the memory after which the heap is collected. */
+#define TEST_EVALUATIONS 3000
+
+
+/**
+ * @brief Evaluates the given large array the given amount of times,
+ *        releasing each value once it has been checked.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int test_churn(
+    struct d_context *context,
+    const char *text,
+    size_t length
+)
+{
+    struct d_dec_number value;
+    size_t i = 0;
+
+
+    for(i = 0; i < TEST_EVALUATIONS; ++i) {
+
+        if(d_ctx_eval(context, text, length, &value) != 0 ||
+           !value.is_array || value.values.array->length != TEST_LENGTH ||
+           d_ctx_release(context, &value) != 0) {
+            return -1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+int main(void)
+{
+    struct d_context *context = NULL;
+    struct d_dec_number kept;
+    struct d_dec_number value;
+
+    char *text = NULL;
+    size_t length = 0;
+    size_t i = 0;
+
+    int result = -1;
+
+
+    if((context = d_ctx_new()) == NULL ||
+       (text = malloc(TEST_LENGTH * 8 + 8)) == NULL) {
+
+        fprintf(stderr, "release_test: could not set up the interpreter\n");
+        return EXIT_FAILURE;
+    }
+
+    // [0, 1, 2, ...] * 2
+    length = (size_t) sprintf(text, "[0");
+
+    for(i = 1; i < TEST_LENGTH; ++i) {
+        length += (size_t) sprintf(text + length, ", %zu", i);
+    }
+
+    length += (size_t) sprintf(text + length, "] * 2");
+
+
+    if(d_ctx_eval(context, "[1, 2, 3] * 2", 13, &kept) == 0 &&
+       test_churn(context, text, length) == 0 &&
+       d_ctx_set_var(context, "kept", &kept) == 0 &&
+       d_ctx_release(context, &kept) == 0 &&
+       test_churn(context, text, length) == 0 &&
+       d_ctx_eval(context, "kept + 1", 8, &value) == 0) {
+
+        if(value.is_array && value.values.array->length == 3 &&
+           value.values.array->elements[0].integer == 3 &&
+           value.values.array->elements[1].integer == 5 &&
+           value.values.array->elements[2].integer == 7) {
+
+            printf("release_test: the kept array is still [2, 4, 6]\n");
+            result = 0;
+        }
+
+        d_ctx_release(context, &value);
+    }
+
+    if(result != 0) {
+        fprintf(stderr, "release_test: the kept array was not kept\n");
+    }
+
+
+    free(text);
+    d_ctx_free(context);
+
+
+    return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,360 @@
+/**
+ * @file array_differential.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Differential test of the element-wise arithmetic over arrays (see
+ *        math/dec_arrays.h) against that of single numbers (see
+ *        math/dec_numbers.h).
+ *
+ * @details
+ *  Generates the given amount of random operations (100000 by default),
+ *  over arrays of integers and floating point numbers of random lengths
+ *  (from a single element to several blocks of vectors, so that the tails
+ *  are covered too), or over an array and a single number, in either order.
+ *  Each element of the result must be exactly the same (bitwise) as what
+ *  "d_dec_numbers_compute_operation" gives for its operands. Negations,
+ *  conversions and math functions are checked likewise.
+ *
+ *    delta_array_differential [operations] [seed]
+ *
+ *  The first element for which both differ, if any, is shown.
+ */
+
+
+#include "math/dec_arrays.h"
+
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/** Longest array, which spans several blocks of conversions. */
+#define DIFFERENTIAL_MAX_LENGTH 700
+
+
+/**
+ * @brief Returns the next number of a xorshift64* generator.
+ */
+uint64_t differential_random(
+    uint64_t *state
+)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+
+    return *state * UINT64_C(2685821657736338717);
+}
+
+
+/**
+ * @brief Returns a random operand of the given operation.
+ *
+ * @details
+ *  Integers are kept small enough for none of the operations to overflow,
+ *  and integer divisors are never 0 (the virtual machine checks them
+ *  beforehand), whereas any double may be used.
+ */
+struct d_dec_number differential_number(
+    uint64_t *state,
+    char operation,
+    int is_floating,
+    int is_divisor
+)
+{
+    struct d_dec_number number;
+    uint64_t kind = differential_random(state);
+
+
+    memset(&number, 0, sizeof(number));
+    number.is_floating = (uint8_t) is_floating;
+
+    if(!is_floating) {
+
+        if(operation == '^') {
+            number.values.integer = is_divisor ?
+                (int64_t) (differential_random(state) % 7) :
+                (int64_t) (differential_random(state) % 21) - 10;
+        }
+
+        else {
+            number.values.integer = (int64_t) (differential_random(state) %
+                                               2001) - 1000;
+
+            if(is_divisor && (operation == '/' || operation == '%') &&
+               number.values.integer == 0) {
+                number.values.integer = 7;
+            }
+        }
+
+        return number;
+    }
+
+
+    switch(kind % 8) {
+
+        case 0:
+            number.values.floating = (kind & 8) ? 0.0 : -0.0;
+            break;
+
+        case 1:
+            number.values.floating = (kind & 8) ? INFINITY :
+                                     (kind & 16) ? -INFINITY : NAN;
+            break;
+
+        default:
+            number.values.floating =
+                ldexp((double) (int64_t) (differential_random(state) %
+                                          2000001) - 1000000.0,
+                      (int) (differential_random(state) % 40) - 20);
+            break;
+    }
+
+
+    return number;
+}
+
+
+/**
+ * @brief Checks if two numbers are the same, bitwise.
+ */
+int differential_same(
+    const struct d_dec_number *expected,
+    int is_floating,
+    const d_dec_number_values *element
+)
+{
+    if(expected->is_floating != is_floating) {
+        return 0;
+    }
+
+
+    return expected->is_floating ?
+               memcmp(&(expected->values.floating), &(element->floating),
+                      sizeof(double)) == 0 :
+               expected->values.integer == element->integer;
+}
+
+
+/**
+ * @brief Shows a mismatch.
+ */
+void differential_report(
+    const char *kind,
+    char operation,
+    size_t index,
+    const struct d_dec_number *expected,
+    int is_floating,
+    const d_dec_number_values *element
+)
+{
+    if(expected->is_floating) {
+        fprintf(stderr, "array_differential: %s '%c', element %zu: expected "
+                        "%a", kind, operation, index,
+                expected->values.floating);
+    }
+    else {
+        fprintf(stderr, "array_differential: %s '%c', element %zu: expected "
+                        "%" PRId64, kind, operation, index,
+                expected->values.integer);
+    }
+
+    if(is_floating) {
+        fprintf(stderr, ", got %a\n", element->floating);
+    }
+    else {
+        fprintf(stderr, ", got %" PRId64 "\n", element->integer);
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 100000;
+    uint64_t state = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1;
+    size_t i = 0;
+    size_t j = 0;
+
+    struct d_dec_arrays *arrays = NULL;
+    static struct d_dec_number elements_1[DIFFERENTIAL_MAX_LENGTH];
+    static struct d_dec_number elements_2[DIFFERENTIAL_MAX_LENGTH];
+    struct d_dec_number value_1;
+    struct d_dec_number value_2;
+    struct d_dec_number result;
+    struct d_dec_number expected;
+    struct d_dec_number element_1;
+    struct d_dec_number element_2;
+
+    char operation = '\0';
+    size_t length = 0;
+    uint64_t shape = 0;
+    int is_floating_1 = 0;
+    int is_floating_2 = 0;
+
+
+    if(state == 0) {
+        state = 1;
+    }
+
+    if(d_dec_arrays_initialize(&arrays) != 0) {
+        return EXIT_FAILURE;
+    }
+
+
+    for(i = 0; i < count; ++i) {
+
+        operation = "+-*/%^"[differential_random(&state) % 6];
+        length = 1 + differential_random(&state) % DIFFERENTIAL_MAX_LENGTH;
+        shape = differential_random(&state);
+        is_floating_1 = (int) (shape & 4) != 0;
+        is_floating_2 = (int) (shape & 8) != 0;
+
+
+        /* Operands */
+
+        // Arrays are built out of single numbers, whose data types are the
+        // same so that none is converted
+        for(j = 0; j < length; ++j) {
+            elements_1[j] = differential_number(&state, operation,
+                                                is_floating_1, 0);
+            elements_2[j] = differential_number(&state, operation,
+                                                is_floating_2, 1);
+        }
+
+        // Both arrays, or an array and a single number, in either order
+        if(d_dec_arrays_build(arrays, elements_1, (shape % 3 == 2) ? 1 :
+                                                  length, &value_1) != 0 ||
+           d_dec_arrays_build(arrays, elements_2, (shape % 3 == 1) ? 1 :
+                                                  length, &value_2) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        if(shape % 3 == 1) {
+            value_2 = elements_2[0];
+        }
+
+        else if(shape % 3 == 2) {
+            value_1 = elements_1[0];
+        }
+
+
+        /* Arithmetic */
+
+        if(d_dec_arrays_compute_operation(arrays, operation, &value_1,
+                                          &value_2, &result) != 0 ||
+           !result.is_array || result.values.array->length != length) {
+
+            fprintf(stderr, "array_differential: '%c' over %zu elements "
+                            "failed\n", operation, length);
+            return EXIT_FAILURE;
+        }
+
+        for(j = 0; j < length; ++j) {
+
+            element_1 = value_1.is_array ? elements_1[j] : value_1;
+            element_2 = value_2.is_array ? elements_2[j] : value_2;
+            expected = d_dec_numbers_compute_operation(operation, &element_1,
+                                                       &element_2);
+
+            if(!differential_same(&expected, result.is_floating,
+                                  &(result.values.array->elements[j]))) {
+
+                differential_report("operation", operation, j, &expected,
+                                    result.is_floating,
+                                    &(result.values.array->elements[j]));
+                return EXIT_FAILURE;
+            }
+        }
+
+
+        /* Negations, conversions & math functions */
+
+        if(d_dec_arrays_negate(arrays, &result, &value_1) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        for(j = 0; j < length; ++j) {
+
+            element_1.is_floating = result.is_floating;
+            element_1.is_array = 0;
+            element_1.values = result.values.array->elements[j];
+            expected = d_dec_numbers_get_negated_value(&element_1);
+
+            if(!differential_same(&expected, value_1.is_floating,
+                                  &(value_1.values.array->elements[j]))) {
+
+                differential_report("negation after", operation, j,
+                                    &expected, value_1.is_floating,
+                                    &(value_1.values.array->elements[j]));
+                return EXIT_FAILURE;
+            }
+        }
+
+        if(!value_1.is_floating &&
+           d_dec_arrays_to_floating(arrays, &value_1, &value_1) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        if(d_dec_arrays_apply_function(arrays, sqrt, &value_1, &value_2)
+           != 0) {
+            return EXIT_FAILURE;
+        }
+
+        for(j = 0; j < length; ++j) {
+
+            expected.is_floating = 1;
+            expected.values.floating =
+                sqrt(value_1.values.array->elements[j].floating);
+
+            if(!differential_same(&expected, value_2.is_floating,
+                                  &(value_2.values.array->elements[j]))) {
+
+                differential_report("sqrt after", operation, j, &expected,
+                                    value_2.is_floating,
+                                    &(value_2.values.array->elements[j]));
+                return EXIT_FAILURE;
+            }
+        }
+
+
+        /* Lengths */
+
+        if(length > 1) {
+
+            if(d_dec_arrays_build(arrays, elements_1, length - 1, &value_1)
+               != 0) {
+                return EXIT_FAILURE;
+            }
+
+            if(d_dec_arrays_compute_operation(arrays, operation, &result,
+                                              &value_1, &value_2)
+               != D_DEC_ARRAYS_LENGTHS_DIFFER) {
+
+                fprintf(stderr, "array_differential: arrays of %zu and %zu "
+                                "elements were operated\n", length,
+                        length - 1);
+                return EXIT_FAILURE;
+            }
+        }
+
+
+        // Nothing is kept from one operation to the next
+        if(d_dec_arrays_is_collection_due(arrays)) {
+            d_dec_arrays_sweep(arrays);
+        }
+    }
+
+    d_dec_arrays_destroy(arrays);
+
+
+    printf("array_differential: %zu operations, no differences\n", count);
+
+
+    return EXIT_SUCCESS;
+}
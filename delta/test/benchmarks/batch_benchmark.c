@@ -0,0 +1,287 @@
+/**
+ * @file batch_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of how fast delta runs the statements that are piped
+ *        through it.
+ *
+ * @details
+ *  Pipes the given amount of lines (10^7 by default) through delta's
+ *  executable in batch mode, and reads back all the values that it shows, as
+ *  a script that uses delta as a filter would do. Most lines are repeated,
+ *  so that they are run from the compiled-expressions cache.
+ *
+ *  The very same lines are also piped through "cat", which does nothing but
+ *  the I/O, so that both throughputs may be compared:
+ *
+ *    delta_batch_benchmark <path to delta> [lines]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/** Size in bytes of the blocks in which lines are written and values are
+    read. */
+#define BENCHMARK_BLOCK_SIZE 65536
+
+
+/** Lines that are piped through delta, over and over. */
+const char *BENCHMARK_LINES[] = {
+    "1 + 2\n",
+    "a = 3 * 4\n",
+    "a / 7\n",
+    "2 ^ 10 - 1\n",
+    "sqrt(2) * a\n",
+    "a % 5\n",
+    "exp(1)\n",
+    "\n"
+};
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Writes all of the given block into the given file descriptor.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int benchmark_write_block(
+    int file_descriptor,
+    const char *block,
+    size_t length
+)
+{
+    ssize_t written = 0;
+
+
+    for(; length > 0; block += written, length -= (size_t) written) {
+
+        if((written = write(file_descriptor, block, length)) <= 0) {
+            return -1;
+        }
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Writes the given amount of lines into the given file descriptor.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int benchmark_write_lines(
+    int file_descriptor,
+    size_t lines
+)
+{
+    char block[BENCHMARK_BLOCK_SIZE];
+    const char *line = NULL;
+    size_t used = 0;
+    size_t length = 0;
+    size_t i = 0;
+
+
+    for(i = 0; i < lines; ++i) {
+
+        line = BENCHMARK_LINES[i % (sizeof(BENCHMARK_LINES) /
+                                    sizeof(BENCHMARK_LINES[0]))];
+        length = strlen(line);
+
+        if(used + length > sizeof(block)) {
+
+            if(benchmark_write_block(file_descriptor, block, used) != 0) {
+                return -1;
+            }
+
+            used = 0;
+        }
+
+        memcpy(block + used, line, length);
+        used += length;
+    }
+
+
+    return benchmark_write_block(file_descriptor, block, used);
+}
+
+
+/**
+ * @brief Pipes the given amount of lines through the given program, and
+ *        reads back all that it writes.
+ *
+ * @param[in] arguments The program's path and arguments, NULL terminated.
+ * @param[in] lines How many lines are piped.
+ * @param[out] output_size How many bytes the program wrote.
+ *
+ * @return 0 if the program exited successfully, any other value otherwise.
+ */
+int benchmark_pipe(
+    char *arguments[],
+    size_t lines,
+    uint64_t *output_size
+)
+{
+    char block[BENCHMARK_BLOCK_SIZE];
+    int input[2];
+    int output[2];
+    int null_fd = -1;
+    int status = 0;
+    int writer_status = 0;
+    ssize_t read_count = 0;
+    pid_t child = 0;
+    pid_t writer = 0;
+
+
+    *output_size = 0;
+
+    if(pipe(input) != 0 || pipe(output) != 0) {
+        return -1;
+    }
+
+    if((child = fork()) < 0) {
+        return -1;
+    }
+
+    // The program reads its stdin from one pipe, and writes its stdout into
+    // the other one; errors are discarded
+    if(child == 0) {
+
+        null_fd = open("/dev/null", O_WRONLY);
+
+        dup2(input[0], STDIN_FILENO);
+        dup2(output[1], STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        close(input[0]);
+        close(input[1]);
+        close(output[0]);
+        close(output[1]);
+        close(null_fd);
+
+        execv(arguments[0], arguments);
+        _exit(127);
+    }
+
+    close(input[0]);
+    close(output[1]);
+
+    // Lines are written by another process, so that the program's output is
+    // read at the same time
+    if((writer = fork()) < 0) {
+        return -1;
+    }
+
+    if(writer == 0) {
+        close(output[0]);
+        _exit((benchmark_write_lines(input[1], lines) == 0) ? EXIT_SUCCESS :
+                                                               EXIT_FAILURE);
+    }
+
+    close(input[1]);
+
+    while((read_count = read(output[0], block, sizeof(block))) > 0) {
+        *output_size += (uint64_t) read_count;
+    }
+
+    close(output[0]);
+
+
+    if(waitpid(writer, &writer_status, 0) != writer ||
+       waitpid(child, &status, 0) != child || !WIFEXITED(status) ||
+       WEXITSTATUS(status) != 0 || !WIFEXITED(writer_status) ||
+       WEXITSTATUS(writer_status) != 0) {
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Pipes the lines through the given program, and shows how long it
+ *        took.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int benchmark_report(
+    const char *name,
+    char *arguments[],
+    size_t lines
+)
+{
+    uint64_t output_size = 0;
+    uint64_t start = benchmark_now();
+    double seconds = 0;
+
+
+    if(benchmark_pipe(arguments, lines, &output_size) != 0) {
+
+        fprintf(stderr, "batch_benchmark: could not pipe the lines through "
+                        "%s\n", arguments[0]);
+        return -1;
+    }
+
+    seconds = (benchmark_now() - start) / 1e9;
+
+    printf("%-8s %10.3f s %14.0f lines/s %10.1f MB out\n", name, seconds,
+           lines / seconds, output_size / 1e6);
+
+
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t lines = (argc > 2) ? strtoul(argv[2], NULL, 10) : 10000000;
+
+    char *cat_arguments[] = {"/bin/cat", NULL};
+    char *delta_arguments[] = {NULL, "--batch", NULL};
+
+
+    if(argc < 2) {
+        fprintf(stderr, "batch_benchmark: the path to delta is needed\n");
+        return EXIT_FAILURE;
+    }
+
+    delta_arguments[0] = argv[1];
+
+
+    if(benchmark_report("cat", cat_arguments, lines) != 0 ||
+       benchmark_report("delta", delta_arguments, lines) != 0) {
+        return EXIT_FAILURE;
+    }
+
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,311 @@
+/**
+ * @file input_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of how fast delta reads notebooks.
+ *
+ * @details
+ *  Generates a notebook of the given size in megabytes (256 by default),
+ *  and measures how long an embedded interpreter (see api/delta.h) takes to
+ *  "load" it:
+ *
+ *    - From a regular file, which the lexical analyzer maps into memory,
+ *      and scans line by line.
+ *
+ *    - From the same file, split into lexemes on the given amount of
+ *      threads (as many as processors by default) while it is analyzed.
+ *
+ *    - From a pipe, which the lexical analyzer reads in chunks, as it does
+ *      with stdin.
+ *
+ *  Most of the notebook's lines are repeated, so that they are run from the
+ *  compiled-expressions cache, and reading them is what takes most of the
+ *  time; every fourth line is different, so it needs to be fully analyzed:
+ *
+ *    delta_input_benchmark [megabytes] [threads]
+ */
+
+
+// clock_gettime, mkstemp
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "analyzers/lexical.h"
+
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/** Template of the path of the generated notebook. */
+#define BENCHMARK_PATH_TEMPLATE "/tmp/delta_input_benchmark_XXXXXX"
+
+
+/** Lines that make up most of the notebook. */
+const char *BENCHMARK_REPEATED_LINES[] = {
+    "a = a + 1;\n",
+    "b = sqrt(a) * 2.5 - b / 4;\n",
+    "c = (a + b) ^ 2 % 97;\n",
+    "\n",
+    "d = exp(-1 / (a + 1)) + log(b ^ 2 + 1);\n",
+    "a = a % 1000;\n"
+};
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Generates a notebook of, at least, the given size.
+ *
+ * @param[in] size The size of the notebook in bytes.
+ * @param[out] length The actual size of the notebook.
+ * @param[out] line_count How many lines the notebook has.
+ *
+ * @return The notebook, or NULL if failed.
+ */
+char *benchmark_generate(
+    size_t size,
+    size_t *length,
+    size_t *line_count
+)
+{
+    size_t repeated_count = sizeof(BENCHMARK_REPEATED_LINES) /
+                            sizeof(BENCHMARK_REPEATED_LINES[0]);
+    char *notebook = NULL;
+    int written = 0;
+
+
+    // Lines are shorter than 64 characters
+    if((notebook = malloc(size + 64)) == NULL) {
+        return NULL;
+    }
+
+    *length = 0;
+    *line_count = 0;
+
+    while(*length < size) {
+
+        if(*line_count % 4 == 0) {
+            written = snprintf(notebook + *length, 64,
+                               "v%zu = %zu.25 * (a - 3) / 7;\n",
+                               *line_count % 1000, *line_count);
+        }
+        else {
+            written = snprintf(notebook + *length, 64, "%s",
+                               BENCHMARK_REPEATED_LINES[*line_count %
+                                                        repeated_count]);
+        }
+
+        *length += (size_t) written;
+        ++(*line_count);
+    }
+
+
+    return notebook;
+}
+
+
+/**
+ * @brief Makes a new interpreter load the notebook at the given path,
+ *        splitting it into lexemes on the given amount of threads.
+ *
+ * @return How long it took, in nanoseconds, or 0 if failed.
+ */
+uint64_t benchmark_load(
+    const char *path,
+    size_t thread_count
+)
+{
+    struct d_context *context = NULL;
+    struct d_dec_number result_value;
+    char statement[64];
+    int length = 0;
+    int result = 0;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+
+
+    if((context = d_ctx_new()) == NULL ||
+       d_lexical_analyzer_use_threads(context, thread_count) != 0) {
+        return 0;
+    }
+
+    length = snprintf(statement, sizeof(statement), "load(\"%s\")", path);
+
+    start = benchmark_now();
+    result = d_ctx_eval(context, statement, (size_t) length,
+                        &result_value);
+    elapsed = benchmark_now() - start;
+
+    d_ctx_free(context);
+
+
+    return (result == 0 || result == 1) ? elapsed : 0;
+}
+
+
+/**
+ * @brief Shows how fast the notebook has been read.
+ */
+void benchmark_report(
+    const char *name,
+    uint64_t elapsed,
+    size_t length,
+    size_t line_count
+)
+{
+    printf("%-8s %12.1f %12.1f %12.2f\n", name, elapsed / 1e6,
+           (length / 1e6) / (elapsed / 1e9),
+           (line_count / 1e6) / (elapsed / 1e9));
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = (argc > 1) ? strtoul(argv[1], NULL, 10) : 256;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t thread_count = (argc > 2) ? strtoul(argv[2], NULL, 10) :
+                          (processors > 1) ? (size_t) processors : 1;
+    size_t length = 0;
+    size_t line_count = 0;
+    size_t offset = 0;
+    ssize_t written = 0;
+
+    char path[] = BENCHMARK_PATH_TEMPLATE;
+    char pipe_path[32];
+    char name[32];
+    char *notebook = NULL;
+    int file_descriptor = -1;
+    int pipe_descriptors[2];
+    int status = 0;
+    pid_t writer = 0;
+    uint64_t elapsed = 0;
+
+
+    if(megabytes == 0 ||
+       (notebook = benchmark_generate(megabytes * 1000000, &length,
+                                      &line_count)) == NULL) {
+
+        fprintf(stderr, "input_benchmark: a positive amount of megabytes, "
+                        "which fit in memory, is needed\n");
+        return EXIT_FAILURE;
+    }
+
+    if((file_descriptor = mkstemp(path)) < 0) {
+
+        fprintf(stderr, "input_benchmark: could not create %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    for(offset = 0; offset < length; offset += (size_t) written) {
+
+        if((written = write(file_descriptor, notebook + offset,
+                            length - offset)) <= 0) {
+
+            fprintf(stderr, "input_benchmark: could not write %s\n", path);
+            unlink(path);
+            return EXIT_FAILURE;
+        }
+    }
+
+    close(file_descriptor);
+
+
+    // "load" shows a message for each notebook, which is kept apart from
+    // the results
+    printf("%-8s %12s %12s %12s\n", "input", "time (ms)", "MB/s",
+           "Mlines/s");
+    fflush(stdout);
+
+
+    if((elapsed = benchmark_load(path, 1)) == 0) {
+
+        fprintf(stderr, "input_benchmark: could not load %s\n", path);
+        unlink(path);
+        return EXIT_FAILURE;
+    }
+
+    benchmark_report("file", elapsed, length, line_count);
+    fflush(stdout);
+
+    if((elapsed = benchmark_load(path, thread_count)) == 0) {
+
+        fprintf(stderr, "input_benchmark: could not load %s\n", path);
+        unlink(path);
+        return EXIT_FAILURE;
+    }
+
+    unlink(path);
+
+    snprintf(name, sizeof(name), "file/%zu", thread_count);
+    benchmark_report(name, elapsed, length, line_count);
+    fflush(stdout);
+
+
+    // The pipe is loaded through its path in /dev/fd, while a child process
+    // writes the notebook into it
+    if(pipe(pipe_descriptors) != 0 || (writer = fork()) < 0) {
+        return EXIT_FAILURE;
+    }
+
+    if(writer == 0) {
+
+        close(pipe_descriptors[0]);
+
+        for(offset = 0; offset < length; offset += (size_t) written) {
+
+            if((written = write(pipe_descriptors[1], notebook + offset,
+                                length - offset)) <= 0) {
+                _exit(EXIT_FAILURE);
+            }
+        }
+
+        _exit(EXIT_SUCCESS);
+    }
+
+    close(pipe_descriptors[1]);
+
+    snprintf(pipe_path, sizeof(pipe_path), "/dev/fd/%d",
+             pipe_descriptors[0]);
+    elapsed = benchmark_load(pipe_path, 1);
+
+    close(pipe_descriptors[0]);
+    kill(writer, SIGTERM);
+    waitpid(writer, &status, 0);
+
+    if(elapsed == 0) {
+
+        fprintf(stderr, "input_benchmark: could not load %s\n", pipe_path);
+        return EXIT_FAILURE;
+    }
+
+    benchmark_report("pipe", elapsed, length, line_count);
+
+    free(notebook);
+
+
+    return EXIT_SUCCESS;
+}
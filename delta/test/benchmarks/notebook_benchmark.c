@@ -0,0 +1,265 @@
+/**
+ * @file notebook_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of how fast delta loads compiled notebooks.
+ *
+ * @details
+ *  Generates a notebook of the given size in megabytes (64 by default),
+ *  whose lines are all different, so that none of them is run from the
+ *  compiled-expressions cache. Then, it measures how long compiling it
+ *  takes (see interpreter/notebook.h), and how long an embedded interpreter
+ *  (see api/delta.h) takes to "load" both its source and the compiled
+ *  notebook, keeping the fastest of the given amount of runs (3 by
+ *  default):
+ *
+ *    delta_notebook_benchmark [megabytes] [runs]
+ */
+
+
+// clock_gettime, mkdtemp
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "interpreter/notebook.h"
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/** Template of the directory of the generated notebook. */
+#define BENCHMARK_DIRECTORY_TEMPLATE "/tmp/delta_notebook_benchmark_XXXXXX"
+
+/** Name of the generated notebook in its directory. */
+#define BENCHMARK_NAME "/notebook" D_NOTEBOOK_SOURCE_EXTENSION
+
+/** How many variables the notebook's lines assign to. */
+#define BENCHMARK_VARIABLE_COUNT 1000
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Generates a notebook of, at least, the given size.
+ *
+ * @param[in] size The size of the notebook in bytes.
+ * @param[out] length The actual size of the notebook.
+ * @param[out] line_count How many lines the notebook has.
+ *
+ * @return The notebook, or NULL if failed.
+ */
+char *benchmark_generate(
+    size_t size,
+    size_t *length,
+    size_t *line_count
+)
+{
+    char *notebook = NULL;
+    int written = 0;
+
+
+    // Lines are shorter than 96 characters
+    if((notebook = malloc(size + 96)) == NULL) {
+        return NULL;
+    }
+
+    *length = 0;
+    *line_count = 0;
+
+    while(*length < size) {
+
+        written = snprintf(notebook + *length, 96,
+                           "v%zu = %zu.5 * (v%zu - 3) / 7 + sqrt(%zu) %% 97;"
+                           "\n", *line_count % BENCHMARK_VARIABLE_COUNT,
+                           *line_count,
+                           (*line_count + 1) % BENCHMARK_VARIABLE_COUNT,
+                           *line_count % 8191);
+
+        *length += (size_t) written;
+        ++(*line_count);
+    }
+
+
+    return notebook;
+}
+
+
+/**
+ * @brief Makes a new interpreter load the notebook at the given path.
+ *
+ * @return How long it took, in nanoseconds, or 0 if failed.
+ */
+uint64_t benchmark_load(
+    const char *path
+)
+{
+    struct d_context *context = NULL;
+    struct d_dec_number result_value;
+    char statement[128];
+    int length = 0;
+    int result = 0;
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+
+
+    if((context = d_ctx_new()) == NULL) {
+        return 0;
+    }
+
+    length = snprintf(statement, sizeof(statement), "load(\"%s\")", path);
+
+    start = benchmark_now();
+    result = d_ctx_eval(context, statement, (size_t) length,
+                        &result_value);
+    elapsed = benchmark_now() - start;
+
+    d_ctx_free(context);
+
+
+    return (result == 0 || result == 1) ? elapsed : 0;
+}
+
+
+/**
+ * @brief Shows how fast the notebook has been read.
+ */
+void benchmark_report(
+    const char *name,
+    uint64_t elapsed,
+    size_t length,
+    size_t line_count
+)
+{
+    printf("%-8s %12.1f %12.1f %12.2f\n", name, elapsed / 1e6,
+           (length / 1e6) / (elapsed / 1e9),
+           (line_count / 1e6) / (elapsed / 1e9));
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = (argc > 1) ? strtoul(argv[1], NULL, 10) : 64;
+    size_t run_count = (argc > 2) ? strtoul(argv[2], NULL, 10) : 3;
+    size_t length = 0;
+    size_t line_count = 0;
+    size_t i = 0;
+
+    char directory[] = BENCHMARK_DIRECTORY_TEMPLATE;
+    char path[sizeof(BENCHMARK_DIRECTORY_TEMPLATE) + sizeof(BENCHMARK_NAME)];
+    char *compiled_path = NULL;
+    char *notebook = NULL;
+    FILE *file = NULL;
+    uint64_t start = 0;
+    uint64_t compile_elapsed = 0;
+    uint64_t source_elapsed = UINT64_MAX;
+    uint64_t compiled_elapsed = UINT64_MAX;
+    uint64_t elapsed = 0;
+    int status = EXIT_SUCCESS;
+
+
+    if(megabytes == 0 || run_count == 0 ||
+       (notebook = benchmark_generate(megabytes * 1000000, &length,
+                                      &line_count)) == NULL) {
+
+        fprintf(stderr, "notebook_benchmark: positive amounts of megabytes, "
+                        "which fit in memory, and of runs are needed\n");
+        return EXIT_FAILURE;
+    }
+
+    if(mkdtemp(directory) == NULL) {
+
+        fprintf(stderr, "notebook_benchmark: could not create %s\n",
+                directory);
+        return EXIT_FAILURE;
+    }
+
+    snprintf(path, sizeof(path), "%s%s", directory, BENCHMARK_NAME);
+
+    if((file = fopen(path, "w")) == NULL ||
+       fwrite(notebook, 1, length, file) != length ||
+       fclose(file) != 0) {
+
+        fprintf(stderr, "notebook_benchmark: could not write %s\n", path);
+        rmdir(directory);
+        return EXIT_FAILURE;
+    }
+
+    free(notebook);
+
+
+    start = benchmark_now();
+
+    if(d_notebook_compile(path) != 0 ||
+       (compiled_path = d_notebook_get_compiled_path(path)) == NULL) {
+
+        fprintf(stderr, "notebook_benchmark: could not compile %s\n", path);
+        unlink(path);
+        rmdir(directory);
+        return EXIT_FAILURE;
+    }
+
+    compile_elapsed = benchmark_now() - start;
+
+
+    // "load" shows a message for each notebook, which is kept apart from
+    // the results
+    for(i = 0; i < run_count && status == EXIT_SUCCESS; ++i) {
+
+        if((elapsed = benchmark_load(path)) == 0) {
+            status = EXIT_FAILURE;
+        }
+        else if(elapsed < source_elapsed) {
+            source_elapsed = elapsed;
+        }
+
+        if((elapsed = benchmark_load(compiled_path)) == 0) {
+            status = EXIT_FAILURE;
+        }
+        else if(elapsed < compiled_elapsed) {
+            compiled_elapsed = elapsed;
+        }
+    }
+
+    unlink(compiled_path);
+    unlink(path);
+    rmdir(directory);
+    free(compiled_path);
+
+    if(status != EXIT_SUCCESS) {
+
+        fprintf(stderr, "notebook_benchmark: could not load %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+
+    printf("%-8s %12s %12s %12s\n", "input", "time (ms)", "MB/s",
+           "Mlines/s");
+    benchmark_report("compile", compile_elapsed, length, line_count);
+    benchmark_report("source", source_elapsed, length, line_count);
+    benchmark_report("compiled", compiled_elapsed, length, line_count);
+
+
+    return EXIT_SUCCESS;
+}
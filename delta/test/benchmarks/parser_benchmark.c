@@ -0,0 +1,241 @@
+/**
+ * @file parser_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of the syntactic and semantic analyzer (see
+ *        analyzers/synsem.h).
+ *
+ * @details
+ *  Generates two corpora of the given size in megabytes (16 by default),
+ *  whose lines are all different so that none of them is run from the
+ *  compiled-expressions cache:
+ *
+ *    - "flat", made up of short assignments.
+ *
+ *    - "nested", whose expressions are wrapped in the given amount of
+ *      parentheses (256 by default), so that the parser's stacks grow as
+ *      deep as they do for machine-generated notebooks.
+ *
+ *  Each corpus is evaluated the given amount of times (5 by default), each
+ *  one by a new interpreter, and the fastest time is shown along with the
+ *  size of the parser's semantic values, which every slot of its value
+ *  stack takes:
+ *
+ *    delta_parser_benchmark [megabytes] [depth] [iterations]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "common/lexical_comp.h"
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/** Longest line of the flat corpus, '\0' included. */
+#define BENCHMARK_LINE_SIZE 64
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Generates a corpus of, at least, the given size, whose expressions
+ *        are wrapped in the given amount of parentheses.
+ *
+ * @param[in] size The size of the corpus in bytes.
+ * @param[in] depth How many parentheses wrap each expression.
+ * @param[out] length The actual size of the corpus.
+ * @param[out] line_count How many lines the corpus has.
+ *
+ * @return The corpus, or NULL if failed.
+ */
+char *benchmark_generate(
+    size_t size,
+    size_t depth,
+    size_t *length,
+    size_t *line_count
+)
+{
+    size_t line_size = 2 * depth + BENCHMARK_LINE_SIZE;
+    char *corpus = NULL;
+    size_t i = 0;
+    int written = 0;
+
+
+    if((corpus = malloc(size + line_size)) == NULL) {
+        return NULL;
+    }
+
+    for(*length = 0, *line_count = 0; *length < size; ++(*line_count)) {
+
+        written = snprintf(corpus + *length, line_size, "x%zu = ",
+                           *line_count % 10);
+        *length += (size_t) written;
+
+        for(i = 0; i < depth; ++i) {
+            corpus[(*length)++] = '(';
+        }
+
+        written = snprintf(corpus + *length, line_size,
+                           "%zu + x%zu * 3 - 1",
+                           *line_count, (*line_count + 1) % 10);
+        *length += (size_t) written;
+
+        for(i = 0; i < depth; ++i) {
+            corpus[(*length)++] = ')';
+        }
+
+        // Results are not shown, as printing them is not being measured
+        corpus[(*length)++] = ';';
+        corpus[(*length)++] = '\n';
+    }
+
+
+    return corpus;
+}
+
+
+/**
+ * @brief Evaluates the given corpus the given amount of times, and shows the
+ *        fastest time.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int benchmark_parse(
+    const char *name,
+    const char *corpus,
+    size_t length,
+    size_t line_count,
+    size_t iterations
+)
+{
+    size_t i = 0;
+    size_t variable = 0;
+
+    struct d_context *context = NULL;
+    struct d_dec_number result_value;
+    char name_buffer[8];
+    int result = 0;
+
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint64_t best = UINT64_MAX;
+
+
+    for(i = 0; i < iterations; ++i) {
+
+        if((context = d_ctx_new()) == NULL) {
+            return -1;
+        }
+
+        // The variables that the corpus reads need to be already declared
+        result_value.is_floating = 0;
+        result_value.is_array = 0;
+        result_value.values.integer = 1;
+
+        for(variable = 0; variable < 10; ++variable) {
+
+            snprintf(name_buffer, sizeof(name_buffer), "x%zu", variable);
+
+            if(d_ctx_set_var(context, name_buffer, &result_value) != 0) {
+                d_ctx_free(context);
+                return -1;
+            }
+        }
+
+        start = benchmark_now();
+        result = d_ctx_eval(context, corpus, length, &result_value);
+        elapsed = benchmark_now() - start;
+
+        d_ctx_free(context);
+
+        if(result != 0) {
+            return -1;
+        }
+
+        if(elapsed < best) {
+            best = elapsed;
+        }
+    }
+
+
+    printf("%10s %14zu %14.1f %14.2f %14.1f\n", name, line_count,
+           best / 1e6, (line_count / 1e6) / (best / 1e9),
+           (length / 1e6) / (best / 1e9));
+
+
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = (argc > 1) ? strtoul(argv[1], NULL, 10) : 16;
+    size_t depth = (argc > 2) ? strtoul(argv[2], NULL, 10) : 256;
+    size_t iterations = (argc > 3) ? strtoul(argv[3], NULL, 10) : 5;
+    size_t flat_length = 0;
+    size_t flat_line_count = 0;
+    size_t nested_length = 0;
+    size_t nested_line_count = 0;
+    char *flat = NULL;
+    char *nested = NULL;
+
+
+    if(megabytes == 0 || iterations == 0 ||
+       (flat = benchmark_generate(megabytes * 1000000, 0, &flat_length,
+                                  &flat_line_count)) == NULL ||
+       (nested = benchmark_generate(megabytes * 1000000, depth,
+                                    &nested_length,
+                                    &nested_line_count)) == NULL) {
+
+        fprintf(stderr, "parser_benchmark: a positive amount of megabytes, "
+                        "which fit in memory, and of iterations are "
+                        "needed\n");
+        return EXIT_FAILURE;
+    }
+
+
+    printf("sizeof(YYSTYPE): %zu bytes\n", sizeof(YYSTYPE));
+    printf("%10s %14s %14s %14s %14s\n", "corpus", "lines", "time (ms)",
+           "Mlines/s", "MB/s");
+
+    if(benchmark_parse("flat", flat, flat_length, flat_line_count,
+                       iterations) != 0 ||
+       benchmark_parse("nested", nested, nested_length, nested_line_count,
+                       iterations) != 0) {
+
+        fprintf(stderr, "parser_benchmark: the corpus could not be "
+                        "evaluated\n");
+        return EXIT_FAILURE;
+    }
+
+    free(flat);
+    free(nested);
+
+
+    return EXIT_SUCCESS;
+}
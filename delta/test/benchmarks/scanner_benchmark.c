@@ -0,0 +1,193 @@
+/**
+ * @file scanner_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of the lexical analyzer (see analyzers/lexical.h).
+ *
+ * @details
+ *  Generates a numeric-heavy corpus of the given size in megabytes (64 by
+ *  default), in which every kind of number that delta supports shows up
+ *  (e.g. "42", "4.2", ".42", "42.", "4.2e-1", "42E+1"), and measures how
+ *  fast the lexical analyzer splits it into lexical components, without
+ *  parsing them.
+ *
+ *  The corpus is scanned the given amount of times (5 by default), each one
+ *  by a new interpreter, with both flex's scanner and the batch one (see
+ *  analyzers/batch_scanner.h), and the fastest time of each is shown:
+ *
+ *    delta_scanner_benchmark [megabytes] [iterations]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "analyzers/lexical.h"
+#include "common/lexical_comp.h"
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/** Longest line of the corpus, '\0' included. */
+#define BENCHMARK_LINE_SIZE 128
+
+
+/** Names of the scanners, in the same order as "is_batch_scanner_enabled"'s
+    values. */
+const char *BENCHMARK_SCANNERS[] = {"flex", "batch"};
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Generates a corpus of, at least, the given size.
+ *
+ * @param[in] size The size of the corpus in bytes.
+ * @param[out] length The actual size of the corpus.
+ *
+ * @return The corpus, or NULL if failed.
+ */
+char *benchmark_generate(
+    size_t size,
+    size_t *length
+)
+{
+    char *corpus = NULL;
+    size_t i = 0;
+    int written = 0;
+
+
+    if((corpus = malloc(size + BENCHMARK_LINE_SIZE)) == NULL) {
+        return NULL;
+    }
+
+    for(*length = 0; *length < size; *length += (size_t) written, ++i) {
+
+        written = snprintf(corpus + *length, BENCHMARK_LINE_SIZE,
+                           "x%zu = %zu.%zu * %zue-%zu + .%zu - %zu. / "
+                           "(%zu.%zuE+%zu ^ %zu) %% %zu\n",
+                           i % 10, i % 1000, i % 97, i % 89, i % 7, i % 83,
+                           i % 79, i % 73, i % 71, i % 5, i % 3, i + 1);
+    }
+
+
+    return corpus;
+}
+
+
+/**
+ * @brief Scans the given corpus with the given scanner, the given amount of
+ *        times, and shows the fastest time.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int benchmark_scan(
+    const char *corpus,
+    size_t length,
+    size_t iterations,
+    int is_batch_scanner_enabled
+)
+{
+    size_t token_count = 0;
+    size_t i = 0;
+
+    struct d_context *context = NULL;
+    YYSTYPE value;
+    YYLTYPE location;
+
+    uint64_t start = 0;
+    uint64_t elapsed = 0;
+    uint64_t best = UINT64_MAX;
+
+
+    for(i = 0; i < iterations; ++i) {
+
+        if((context = d_ctx_new()) == NULL ||
+           d_lexical_analyzer_use_batch_scanner(
+               context, is_batch_scanner_enabled) != 0 ||
+           d_lexical_analyzer_new_string(context, corpus, length) != 0) {
+            return -1;
+        }
+
+        token_count = 0;
+        start = benchmark_now();
+
+        // The end of a text is reported as 0
+        while(yylex(&value, &location, context) != 0) {
+            ++token_count;
+        }
+
+        elapsed = benchmark_now() - start;
+
+        if(elapsed < best) {
+            best = elapsed;
+        }
+
+        d_ctx_free(context);
+    }
+
+
+    printf("%14s %14zu %14.1f %14.2f %14.1f\n",
+           BENCHMARK_SCANNERS[is_batch_scanner_enabled], token_count,
+           best / 1e6, (token_count / 1e6) / (best / 1e9),
+           (length / 1e6) / (best / 1e9));
+
+
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t megabytes = (argc > 1) ? strtoul(argv[1], NULL, 10) : 64;
+    size_t iterations = (argc > 2) ? strtoul(argv[2], NULL, 10) : 5;
+    size_t length = 0;
+    char *corpus = NULL;
+
+
+    if(megabytes == 0 || iterations == 0 ||
+       (corpus = benchmark_generate(megabytes * 1000000, &length)) == NULL) {
+
+        fprintf(stderr, "scanner_benchmark: a positive amount of megabytes, "
+                        "which fit in memory, and of iterations are "
+                        "needed\n");
+        return EXIT_FAILURE;
+    }
+
+
+    printf("%14s %14s %14s %14s %14s\n", "scanner", "tokens", "time (ms)",
+           "Mtokens/s", "MB/s");
+
+    if(benchmark_scan(corpus, length, iterations, 0) != 0 ||
+       benchmark_scan(corpus, length, iterations, 1) != 0) {
+        return EXIT_FAILURE;
+    }
+
+    free(corpus);
+
+
+    return EXIT_SUCCESS;
+}
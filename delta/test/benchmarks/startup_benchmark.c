@@ -0,0 +1,247 @@
+/**
+ * @file startup_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of how long delta takes to start up.
+ *
+ * @details
+ *  Measures, over the given amount of iterations (1000 by default):
+ *
+ *    - How long it takes to create and destroy an embedded interpreter (see
+ *      api/delta.h), which is the part of the startup that delta itself
+ *      controls.
+ *
+ *    - If the path to delta's executable is given, how long it takes to
+ *      launch it and have it run "quit" through stdin, as well as to have it
+ *      run "1 + 2" through "-e" and exit, as scripts that run delta once per
+ *      job do.
+ *
+ *  The median (p50) and 99th percentile (p99) latencies are shown:
+ *
+ *    delta_startup_benchmark [iterations] [path to delta]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Compares two latencies, for qsort.
+ */
+int benchmark_compare(
+    const void *a,
+    const void *b
+)
+{
+    uint64_t first = *(const uint64_t *) a;
+    uint64_t second = *(const uint64_t *) b;
+
+
+    return (first > second) - (first < second);
+}
+
+
+/**
+ * @brief Shows the p50 and p99 of the given latencies, which get sorted.
+ */
+void benchmark_report(
+    const char *name,
+    uint64_t *latencies,
+    size_t count
+)
+{
+    qsort(latencies, count, sizeof(uint64_t), &benchmark_compare);
+
+    printf("%-12s %14.1f %14.1f\n", name, latencies[count / 2] / 1e3,
+           latencies[(count * 99) / 100] / 1e3);
+}
+
+
+/**
+ * @brief Launches delta with the given arguments, writes the given input
+ *        into its stdin, and waits for it.
+ *
+ * @return 0 if delta exited successfully, any other value otherwise.
+ */
+int benchmark_launch(
+    char *arguments[],
+    const char *text
+)
+{
+    size_t length = strlen(text);
+    int input[2];
+    int null_fd = -1;
+    int status = 0;
+    pid_t child = 0;
+
+
+    if(pipe(input) != 0) {
+        return -1;
+    }
+
+    if((child = fork()) < 0) {
+        return -1;
+    }
+
+    // Delta reads its stdin from the pipe, and its output is discarded
+    if(child == 0) {
+
+        null_fd = open("/dev/null", O_WRONLY);
+
+        dup2(input[0], STDIN_FILENO);
+        dup2(null_fd, STDOUT_FILENO);
+        dup2(null_fd, STDERR_FILENO);
+        close(input[0]);
+        close(input[1]);
+        close(null_fd);
+
+        execv(arguments[0], arguments);
+        _exit(127);
+    }
+
+    close(input[0]);
+
+    if(length > 0 && write(input[1], text, length) != (ssize_t) length) {
+        status = -1;
+    }
+
+    close(input[1]);
+
+
+    if(waitpid(child, &status, 0) != child || !WIFEXITED(status) ||
+       WEXITSTATUS(status) != 0) {
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Launches delta the given amount of times, and keeps how long each
+ *        one took.
+ *
+ * @return 0 if delta always exited successfully, any other value otherwise.
+ */
+int benchmark_measure(
+    char *arguments[],
+    const char *text,
+    uint64_t *latencies,
+    size_t iterations
+)
+{
+    size_t i = 0;
+    uint64_t start = 0;
+
+
+    for(i = 0; i < iterations; ++i) {
+
+        start = benchmark_now();
+
+        if(benchmark_launch(arguments, text) != 0) {
+            return -1;
+        }
+
+        latencies[i] = benchmark_now() - start;
+    }
+
+
+    return 0;
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t iterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000;
+    size_t i = 0;
+
+    struct d_context *context = NULL;
+    uint64_t *latencies = NULL;
+    uint64_t start = 0;
+
+    char *stdin_arguments[] = {NULL, NULL};
+    char *one_shot_arguments[] = {NULL, "-e", "1 + 2", NULL};
+
+
+    if(iterations == 0 ||
+       (latencies = malloc(2 * iterations * sizeof(uint64_t))) == NULL) {
+
+        fprintf(stderr, "startup_benchmark: a positive amount of iterations, "
+                        "which fits in memory, is needed\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("%-12s %14s %14s\n", "startup", "p50 (us)", "p99 (us)");
+
+
+    for(i = 0; i < iterations; ++i) {
+
+        start = benchmark_now();
+
+        if((context = d_ctx_new()) == NULL || d_ctx_free(context) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        latencies[i] = benchmark_now() - start;
+    }
+
+    benchmark_report("context", latencies, iterations);
+
+
+    if(argc > 2) {
+
+        stdin_arguments[0] = argv[2];
+        one_shot_arguments[0] = argv[2];
+
+        if(benchmark_measure(stdin_arguments, "quit\n", latencies,
+                             iterations) != 0 ||
+           benchmark_measure(one_shot_arguments, "", latencies + iterations,
+                             iterations) != 0) {
+
+            fprintf(stderr, "startup_benchmark: could not run %s\n",
+                    argv[2]);
+            return EXIT_FAILURE;
+        }
+
+        benchmark_report("process", latencies, iterations);
+        benchmark_report("one-shot", latencies + iterations, iterations);
+    }
+
+    free(latencies);
+
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,231 @@
+/**
+ * @file symbol_table_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of the symbol table (see common/symbol_table.h).
+ *
+ * @details
+ *  Fills a symbol table with increasing amounts of variables (from 10^3 up
+ *  to the given maximum, 10^7 by default), and measures how long it takes:
+ *
+ *    - To insert them.
+ *
+ *    - To delete BENCHMARK_FUNCTION_COUNT math functions that are added
+ *      after them, by their lexical component, just as the "wsc" command
+ *      does. It should not depend on how many variables there are.
+ *
+ *    - To look the variables up, in a different order than the one in
+ *      which they were inserted, past the slots of the deleted functions.
+ *
+ *    - To look up names that are not present.
+ *
+ *    - To delete them all at once by their lexical component.
+ *
+ *    delta_symbol_table_benchmark [max. variables]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "common/lexical_comp.h"
+#include "common/symbol_table.h"
+
+
+// sqrt
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+
+/** Size in bytes of each name: a letter, up to 20 digits and '\0', rounded
+    up to a multiple of 8. */
+#define BENCHMARK_NAME_SIZE 24
+
+/** How many math functions are added along with the variables, such as
+    those of an imported library. */
+#define BENCHMARK_FUNCTION_COUNT 300
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Returns the i-th name of the given list.
+ */
+const char *benchmark_name(
+    char *names,
+    size_t i
+)
+{
+    return names + i * BENCHMARK_NAME_SIZE;
+}
+
+
+int main(int argc, char *argv[])
+{
+    struct d_symbol_table *table = NULL;
+    struct d_symbol_table_entry entry;
+    struct d_symbol_table_entry function;
+    char function_name[BENCHMARK_NAME_SIZE];
+
+    size_t max_count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 10000000;
+    size_t count = 0;
+    size_t i = 0;
+    size_t found = 0;
+
+    // Names of the variables that are inserted ("v..."), and of those that
+    // are not ("w...")
+    char *names = NULL;
+    char *missing_names = NULL;
+
+    uint64_t start = 0;
+    uint64_t insert_time = 0;
+    uint64_t function_time = 0;
+    uint64_t lookup_time = 0;
+    uint64_t miss_time = 0;
+    uint64_t delete_time = 0;
+
+
+    if(max_count < 1000 ||
+       (names = malloc(max_count * BENCHMARK_NAME_SIZE)) == NULL ||
+       (missing_names = malloc(max_count * BENCHMARK_NAME_SIZE)) == NULL) {
+
+        fprintf(stderr, "symbol_table_benchmark: at least 1000 variables, "
+                        "which fit in memory, are needed\n");
+        return EXIT_FAILURE;
+    }
+
+    for(i = 0; i < max_count; ++i) {
+
+        snprintf(names + i * BENCHMARK_NAME_SIZE, BENCHMARK_NAME_SIZE,
+                 "v%zu", i);
+        snprintf(missing_names + i * BENCHMARK_NAME_SIZE,
+                 BENCHMARK_NAME_SIZE, "w%zu", i);
+    }
+
+
+    entry.lexical_component = D_LC_IDENTIFIER_VARIABLE;
+    entry.attribute.dec_number.is_floating = 0;
+    entry.attribute.dec_number.is_array = 0;
+
+    function.lexeme = function_name;
+    function.lexical_component = D_LC_IDENTIFIER_FUNCTION;
+    function.attribute.function = &sqrt;
+
+    printf("%10s %14s %16s %14s %14s %14s\n", "variables", "insert (ns)",
+           "del. funcs (us)", "lookup (ns)", "miss (ns)", "delete (us)");
+
+    for(count = 1000; count <= max_count; count *= 10) {
+
+        if(d_symbol_table_initialize(&table) != 0) {
+            return EXIT_FAILURE;
+        }
+
+
+        start = benchmark_now();
+
+        for(i = 0; i < count; ++i) {
+
+            entry.lexeme = benchmark_name(names, i);
+            entry.attribute.dec_number.values.integer = (int64_t) i;
+
+            if(d_symbol_table_add(table, &entry) != 0) {
+                return EXIT_FAILURE;
+            }
+        }
+
+        insert_time = benchmark_now() - start;
+
+
+        for(i = 0; i < BENCHMARK_FUNCTION_COUNT; ++i) {
+
+            snprintf(function_name, sizeof(function_name), "f%zu", i);
+
+            if(d_symbol_table_add(table, &function) != 0) {
+                return EXIT_FAILURE;
+            }
+        }
+
+        start = benchmark_now();
+
+        if(d_symbol_table_delete(table, D_LC_IDENTIFIER_FUNCTION) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        function_time = benchmark_now() - start;
+
+
+        // A stride which is coprime with the amount of variables visits
+        // them all, but not in the order in which they were inserted
+        found = 0;
+        start = benchmark_now();
+
+        for(i = 0; i < count; ++i) {
+            found += d_symbol_table_search(
+                         table, benchmark_name(names, (i * 7919) % count)
+                     ) != NULL;
+        }
+
+        lookup_time = benchmark_now() - start;
+
+
+        start = benchmark_now();
+
+        for(i = 0; i < count; ++i) {
+            found += d_symbol_table_search(
+                         table, benchmark_name(missing_names, i)
+                     ) != NULL;
+        }
+
+        miss_time = benchmark_now() - start;
+
+        if(found != count) {
+
+            fprintf(stderr, "symbol_table_benchmark: %zu lookups out of %zu "
+                            "were right\n", found, 2 * count);
+            return EXIT_FAILURE;
+        }
+
+
+        start = benchmark_now();
+
+        if(d_symbol_table_delete(table, D_LC_IDENTIFIER_VARIABLE) != 0) {
+            return EXIT_FAILURE;
+        }
+
+        delete_time = benchmark_now() - start;
+
+
+        printf("%10zu %14.1f %16.1f %14.1f %14.1f %14.1f\n", count,
+               (double) insert_time / count, function_time / 1e3,
+               (double) lookup_time / count, (double) miss_time / count,
+               delete_time / 1e3);
+
+        d_symbol_table_destroy(table);
+    }
+
+    free(names);
+    free(missing_names);
+
+
+    return EXIT_SUCCESS;
+}
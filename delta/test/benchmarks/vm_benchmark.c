@@ -0,0 +1,251 @@
+/**
+ * @file vm_benchmark.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Benchmark of the virtual machine (see interpreter/vm.h) against
+ *        analyzing the same expression over and over.
+ *
+ * @details
+ *  Evaluates the same expression the given amount of times (10^6 by
+ *  default), in three ways:
+ *
+ *    - "vm", which runs a program that has been compiled just once.
+ *
+ *    - "eval", which hands the expression's text to "d_ctx_eval"; as it is
+ *      always the same line, its program is run from the compiled-
+ *      expressions cache, but the line still goes through the lexical
+ *      analyzer.
+ *
+ *    - "parse", which does the same after clearing the cache, so that the
+ *      expression is analyzed, and compiled, every time it is evaluated.
+ *
+ *  The JIT compiler is disabled, so that all of them are run by the virtual
+ *  machine. Evaluations per second are shown for each one:
+ *
+ *    delta_vm_benchmark [evaluations]
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "common/arena.h"
+#include "common/context.h"
+#include "common/symbol_table.h"
+#include "interpreter/ast.h"
+#include "interpreter/bytecode.h"
+#include "interpreter/cache.h"
+#include "interpreter/jit.h"
+#include "interpreter/vm.h"
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+
+/** The expression that is evaluated; its AST is built by hand below. */
+#define BENCHMARK_EXPRESSION "x * 3 + y / 2 - sqrt(x) * 1.5;\n"
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t benchmark_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Builds the AST of BENCHMARK_EXPRESSION, as the parser would.
+ *
+ * @return The root of the AST, or NULL if failed.
+ */
+struct d_ast_node *benchmark_build(
+    struct d_context *context,
+    struct d_arena *arena
+)
+{
+    struct d_symbol_table_entry *x = NULL;
+    struct d_symbol_table_entry *y = NULL;
+    struct d_symbol_table_entry *sqrt_entry = NULL;
+    struct d_dec_number three;
+    struct d_dec_number two;
+    struct d_dec_number one_and_a_half;
+    struct d_ast_node *left = NULL;
+    struct d_ast_node *right = NULL;
+    struct d_ast_node *call = NULL;
+
+
+    memset(&three, 0, sizeof(three));
+    memset(&two, 0, sizeof(two));
+    memset(&one_and_a_half, 0, sizeof(one_and_a_half));
+    three.values.integer = 3;
+    two.values.integer = 2;
+    one_and_a_half.is_floating = 1;
+    one_and_a_half.values.floating = 1.5;
+
+    if((x = d_symbol_table_search(context->symbol_table, "x")) == NULL ||
+       (y = d_symbol_table_search(context->symbol_table, "y")) == NULL ||
+       (sqrt_entry = d_symbol_table_search(context->symbol_table, "sqrt"))
+       == NULL) {
+        return NULL;
+    }
+
+
+    // x * 3 + y / 2
+    left = d_ast_new_operation(
+               arena, '+',
+               d_ast_new_operation(
+                   arena, '*',
+                   d_ast_new_identifier(arena, D_AST_VARIABLE, x, 1, 2),
+                   d_ast_new_literal(arena, &three, 1, 6), 1, 6
+               ),
+               d_ast_new_operation(
+                   arena, '/',
+                   d_ast_new_identifier(arena, D_AST_VARIABLE, y, 1, 10),
+                   d_ast_new_literal(arena, &two, 1, 14), 1, 14
+               ),
+               1, 14
+           );
+
+    // sqrt(x) * 1.5
+    call = d_ast_new_unary(arena, D_AST_FUNCTION_CALL, sqrt_entry,
+                           d_ast_new_identifier(arena, D_AST_VARIABLE, x, 1,
+                                                24),
+                           1, 25);
+    right = d_ast_new_operation(arena, '*', call,
+                                d_ast_new_literal(arena, &one_and_a_half, 1,
+                                                  31),
+                                1, 31);
+
+
+    return d_ast_new_operation(arena, '-', left, right, 1, 31);
+}
+
+
+/**
+ * @brief Shows how many evaluations per second were done.
+ */
+void benchmark_report(
+    const char *name,
+    size_t evaluations,
+    uint64_t elapsed,
+    const struct d_dec_number *result
+)
+{
+    printf("%8s %14.1f %14.2f %18.10g\n", name, elapsed / 1e6,
+           (evaluations / 1e6) / (elapsed / 1e9),
+           result->is_floating ? result->values.floating :
+                                 (double) result->values.integer);
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t evaluations = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    size_t length = strlen(BENCHMARK_EXPRESSION);
+    size_t i = 0;
+
+    struct d_context *context = NULL;
+    struct d_arena arena;
+    struct d_ast_node *root = NULL;
+    struct d_bytecode bytecode;
+    struct d_dec_number value;
+    uint64_t start = 0;
+
+
+    if(evaluations == 0) {
+
+        fprintf(stderr, "vm_benchmark: a positive amount of evaluations is "
+                        "needed\n");
+        return EXIT_FAILURE;
+    }
+
+    d_jit_enabled = 0;
+
+    memset(&value, 0, sizeof(value));
+    value.is_floating = 1;
+    value.values.floating = 2.0;
+
+    if((context = d_ctx_new()) == NULL ||
+       d_ctx_set_var(context, "x", &value) != 0 ||
+       d_ctx_set_var(context, "y", &value) != 0 ||
+       d_arena_initialize(&arena, D_ARENA_DEFAULT_BLOCK_SIZE) != 0 ||
+       (root = benchmark_build(context, &arena)) == NULL ||
+       d_bytecode_compile(root, &arena, &bytecode) != 0) {
+
+        fprintf(stderr, "vm_benchmark: the expression could not be "
+                        "compiled\n");
+        return EXIT_FAILURE;
+    }
+
+
+    printf("%8s %14s %14s %18s\n", "path", "time (ms)", "Mevals/s",
+           "result");
+
+
+    /* Compiled once */
+
+    start = benchmark_now();
+
+    for(i = 0; i < evaluations; ++i) {
+
+        if(d_vm_execute(context, &bytecode, 1, &value) != 0) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    benchmark_report("vm", evaluations, benchmark_now() - start, &value);
+
+
+    /* Cached */
+
+    start = benchmark_now();
+
+    for(i = 0; i < evaluations; ++i) {
+
+        if(d_ctx_eval(context, BENCHMARK_EXPRESSION, length, &value) != 0) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    benchmark_report("eval", evaluations, benchmark_now() - start, &value);
+
+
+    /* Analyzed every time */
+
+    start = benchmark_now();
+
+    for(i = 0; i < evaluations; ++i) {
+
+        if(d_cache_clear(context->cache) != 0 ||
+           d_ctx_eval(context, BENCHMARK_EXPRESSION, length, &value) != 0) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    benchmark_report("parse", evaluations, benchmark_now() - start, &value);
+
+
+    d_arena_destroy(&arena);
+    d_ctx_free(context);
+
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,245 @@
+/**
+ * @file format_differential.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Differential test of how base 10 numbers are written (see
+ *        math/dec_format.h) against printf.
+ *
+ * @details
+ *  Generates the given amount of random numbers (1000000 by default): doubles
+ *  with random bits (subnormals, infinities and NaNs included), doubles that
+ *  come from short decimal numbers (i.e. "0.1", "2.5e-7"), and integers of
+ *  every magnitude. For each one:
+ *
+ *    - Integers must be written just as "%" PRId64 would.
+ *
+ *    - Doubles must be read back as themselves, with no more significant
+ *      digits than the shortest "%.Ng" that is read back as them (which may
+ *      have more, as it is the closest N-digit number, not just any one).
+ *
+ *    - Doubles must be written just as "%.15g" would once
+ *      "d_dec_format_is_compatible" is set.
+ *
+ *    delta_format_differential [numbers] [seed]
+ *
+ *  The first number for which both differ, if any, is shown.
+ */
+
+
+#include "math/dec_format.h"
+
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/**
+ * @brief Returns the next number of a xorshift64* generator.
+ */
+uint64_t differential_random(
+    uint64_t *state
+)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+
+    return *state * UINT64_C(2685821657736338717);
+}
+
+
+/**
+ * @brief Returns a random double, which is one of the kinds that the test
+ *        covers.
+ */
+double differential_double(
+    uint64_t *state
+)
+{
+    uint64_t bits = differential_random(state);
+    double value = 0;
+    char text[64];
+
+
+    switch(bits % 4) {
+
+        // Any bits at all
+        case 0:
+        case 1:
+            bits = differential_random(state);
+            memcpy(&value, &bits, sizeof(value));
+            return value;
+
+        // A short decimal number, which is where the shortest representation
+        // differs the most from "%.17g"
+        case 2:
+            snprintf(text, sizeof(text), "%" PRIu64 "e%d",
+                     differential_random(state) %
+                     (UINT64_C(1) << (differential_random(state) % 50 + 1)),
+                     (int) (differential_random(state) % 80) - 40);
+            return strtod(text, NULL);
+
+        // An integer, or a power of 2, which stress the trailing zeros
+        default:
+            return ldexp((double) (differential_random(state) % 100000),
+                         (int) (differential_random(state) % 200) - 100);
+    }
+}
+
+
+/**
+ * @brief Returns how many significant digits the given written double has.
+ */
+int differential_significant_digits(
+    const char *text
+)
+{
+    int count = 0;
+    int trailing_zeros = 0;
+    int is_leading = 1;
+
+
+    for(; *text != '\0' && *text != 'e'; ++text) {
+
+        if(*text < '0' || *text > '9' || (is_leading && *text == '0')) {
+            continue;
+        }
+
+        is_leading = 0;
+        ++count;
+        trailing_zeros = (*text == '0') ? trailing_zeros + 1 : 0;
+    }
+
+
+    // Those of integers such as "1000" are not significant
+    return count - trailing_zeros;
+}
+
+
+/**
+ * @brief Shows a mismatch.
+ */
+void differential_report(
+    const char *kind,
+    double value,
+    const char *expected,
+    const char *written
+)
+{
+    fprintf(stderr, "format_differential: %s of %a: expected \"%s\", got "
+                    "\"%s\"\n", kind, value, expected, written);
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    uint64_t state = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1;
+    size_t i = 0;
+    int precision = 0;
+
+    double value = 0;
+    int64_t integer = 0;
+    char expected[64];
+    char written[D_DEC_FORMAT_MAX_LENGTH];
+    size_t length = 0;
+
+
+    if(state == 0) {
+        state = 1;
+    }
+
+
+    for(i = 0; i < count; ++i) {
+
+        /* Integers */
+
+        integer = (int64_t) (differential_random(&state) >>
+                             (differential_random(&state) % 64));
+
+        if(i % 2 == 0) {
+            integer = -integer;
+        }
+
+        snprintf(expected, sizeof(expected), "%" PRId64, integer);
+        length = d_dec_format_integer(integer, written);
+
+        if(strcmp(expected, written) != 0 || length != strlen(written)) {
+            fprintf(stderr, "format_differential: expected \"%s\", got "
+                            "\"%s\"\n", expected, written);
+            return EXIT_FAILURE;
+        }
+
+
+        /* Shortest doubles */
+
+        value = differential_double(&state);
+
+        d_dec_format_is_compatible = 0;
+        length = d_dec_format_floating(value, written);
+
+        if(length != strlen(written)) {
+            differential_report("length", value, "", written);
+            return EXIT_FAILURE;
+        }
+
+        if(isnan(value)) {
+
+            snprintf(expected, sizeof(expected), "%g", value);
+
+            if(strcmp(expected, written) != 0) {
+                differential_report("nan", value, expected, written);
+                return EXIT_FAILURE;
+            }
+        }
+
+        else {
+
+            for(precision = 1; precision < 17; ++precision) {
+
+                snprintf(expected, sizeof(expected), "%.*g", precision,
+                         value);
+
+                if(strtod(expected, NULL) == value) {
+                    break;
+                }
+            }
+
+            snprintf(expected, sizeof(expected), "%.*g", precision, value);
+
+            if(memcmp(&value, &(double){strtod(written, NULL)},
+                      sizeof(value)) != 0 ||
+               (isfinite(value) && value != 0 &&
+                differential_significant_digits(written) >
+                differential_significant_digits(expected))) {
+
+                differential_report("shortest", value, expected, written);
+                return EXIT_FAILURE;
+            }
+        }
+
+
+        /* Compatible doubles */
+
+        d_dec_format_is_compatible = 1;
+        snprintf(expected, sizeof(expected), "%.15g", value);
+        length = d_dec_format_floating(value, written);
+
+        if(strcmp(expected, written) != 0 || length != strlen(written)) {
+            differential_report("%.15g", value, expected, written);
+            return EXIT_FAILURE;
+        }
+    }
+
+
+    printf("format_differential: %zu numbers, no differences\n", count);
+
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,345 @@
+/**
+ * @file load_generator.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Load generator for delta's server mode (see server/server.h).
+ *
+ * @details
+ *  Opens the given amount of connections to a delta server, each one from
+ *  its own thread, and sends the same line through each of them as many
+ *  times as requested. Up to "pipeline depth" lines may be waiting for their
+ *  answers at once on each connection.
+ *
+ *  Once all the answers have been received, the median (p50) and 99th
+ *  percentile (p99) latencies, and the overall throughput, are shown:
+ *
+ *    delta --serve /tmp/delta.sock &
+ *    delta_load /tmp/delta.sock 8 100000 16 "sin(1) ^ 2 + cos(1) ^ 2"
+ */
+
+
+// clock_gettime
+#define _POSIX_C_SOURCE 200809L
+
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+
+/**
+ * @brief Represents the work of a connection.
+ */
+struct load_connection {
+    /** Path to the server's socket. */
+    const char *socket_path;
+    /** The '\n' terminated line to send. */
+    const char *line;
+    /** How many times the line must be sent. */
+    size_t requests;
+    /** How many lines may be waiting for their answers at once. */
+    size_t depth;
+
+    /** The latency of each request, in nanoseconds. */
+    uint64_t *latencies;
+    /** How many answers have been received. */
+    size_t answers;
+    /** How many answers were "error". */
+    size_t errors;
+    /** If the connection failed before receiving all the answers. */
+    int failed;
+};
+
+
+/**
+ * @brief Returns the current time of a monotonic clock, in nanoseconds.
+ */
+uint64_t load_now(
+    void
+)
+{
+    struct timespec now;
+
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+
+    return (uint64_t) now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+
+/**
+ * @brief Sends the whole given buffer.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int load_send_all(
+    int socket,
+    const char *buffer,
+    size_t length
+)
+{
+    ssize_t sent = 0;
+
+
+    while(length > 0) {
+
+        if((sent = send(socket, buffer, length, MSG_NOSIGNAL)) <= 0) {
+            return -1;
+        }
+
+        buffer += sent;
+        length -= sent;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Runs the requests of a connection.
+ *
+ * @param[in,out] argument The connection's work.
+ *
+ * @return NULL.
+ */
+void *load_run_connection(
+    void *argument
+)
+{
+    struct load_connection *connection = argument;
+    struct sockaddr_un address;
+    int socket_fd = -1;
+
+    size_t line_length = strlen(connection->line);
+    // Ring with the send times of the requests that are in flight
+    uint64_t *sent_at = NULL;
+    size_t sent = 0;
+
+    char chunk[4096];
+    ssize_t chunk_length = 0;
+    // How many characters of the current answer have been received
+    size_t answer_length = 0;
+    int is_error = 0;
+    ssize_t i = 0;
+
+
+    connection->failed = 1;
+
+    if((sent_at = malloc(connection->depth * sizeof(uint64_t))) == NULL) {
+        return NULL;
+    }
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strncpy(address.sun_path, connection->socket_path,
+            sizeof(address.sun_path) - 1);
+
+    if((socket_fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0 ||
+       connect(socket_fd, (struct sockaddr *) &address,
+               sizeof(address)) != 0) {
+
+        perror("load_generator: connect");
+        goto clean_up;
+    }
+
+
+    while(connection->answers < connection->requests) {
+
+        // The pipeline is refilled...
+        while(sent < connection->requests &&
+              sent - connection->answers < connection->depth) {
+
+            sent_at[sent % connection->depth] = load_now();
+
+            if(load_send_all(socket_fd, connection->line, line_length)
+               != 0) {
+
+                perror("load_generator: send");
+                goto clean_up;
+            }
+
+            ++sent;
+        }
+
+        // ... and then, as many answers as available are received
+        if((chunk_length = recv(socket_fd, chunk, sizeof(chunk), 0)) <= 0) {
+
+            fprintf(stderr, "load_generator: the server closed the "
+                            "connection\n");
+            goto clean_up;
+        }
+
+        for(i = 0; i < chunk_length; ++i) {
+
+            if(chunk[i] != '\n') {
+
+                is_error = (answer_length == 0 && chunk[i] == 'e') ||
+                           (answer_length > 0 && is_error);
+                ++answer_length;
+                continue;
+            }
+
+            connection->latencies[connection->answers] =
+                load_now() - sent_at[connection->answers % connection->depth];
+
+            connection->errors += is_error;
+            ++(connection->answers);
+
+            answer_length = 0;
+            is_error = 0;
+        }
+    }
+
+    connection->failed = 0;
+
+
+clean_up:
+    if(socket_fd >= 0) {
+        close(socket_fd);
+    }
+
+    free(sent_at);
+
+
+    return NULL;
+}
+
+
+/**
+ * @brief Compares two latencies, for qsort.
+ */
+int load_compare(
+    const void *a,
+    const void *b
+)
+{
+    uint64_t first = *(const uint64_t *) a;
+    uint64_t second = *(const uint64_t *) b;
+
+
+    return (first > second) - (first < second);
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t connection_count = 0;
+    size_t requests = 0;
+    size_t depth = 0;
+    char *line = NULL;
+
+    struct load_connection *connections = NULL;
+    pthread_t *threads = NULL;
+    uint64_t *latencies = NULL;
+    size_t latency_count = 0;
+    size_t errors = 0;
+    size_t i = 0;
+
+    uint64_t start = 0;
+    double elapsed = 0;
+
+
+    if(argc < 5 || argc > 6) {
+
+        fprintf(stderr, "usage: %s <socket> <connections> <requests per "
+                        "connection> <pipeline depth> [expression]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    connection_count = strtoul(argv[2], NULL, 10);
+    requests = strtoul(argv[3], NULL, 10);
+    depth = strtoul(argv[4], NULL, 10);
+
+    if(connection_count == 0 || requests == 0 || depth == 0) {
+
+        fprintf(stderr, "load_generator: connections, requests and depth "
+                        "must be positive\n");
+        return EXIT_FAILURE;
+    }
+
+    // The server expects '\n' terminated lines
+    line = malloc(strlen((argc == 6) ? argv[5] : "1 + 1") + 2);
+    connections = calloc(connection_count, sizeof(struct load_connection));
+    threads = calloc(connection_count, sizeof(pthread_t));
+    latencies = malloc(connection_count * requests * sizeof(uint64_t));
+
+    if(line == NULL || connections == NULL || threads == NULL ||
+       latencies == NULL) {
+
+        fprintf(stderr, "load_generator: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    sprintf(line, "%s\n", (argc == 6) ? argv[5] : "1 + 1");
+
+
+    start = load_now();
+
+    for(i = 0; i < connection_count; ++i) {
+
+        connections[i].socket_path = argv[1];
+        connections[i].line = line;
+        connections[i].requests = requests;
+        connections[i].depth = depth;
+        connections[i].latencies = latencies + i * requests;
+
+        if(pthread_create(&threads[i], NULL, &load_run_connection,
+                          &connections[i]) != 0) {
+
+            fprintf(stderr, "load_generator: could not create a thread\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    for(i = 0; i < connection_count; ++i) {
+
+        pthread_join(threads[i], NULL);
+
+        // Latencies are packed, as failed connections may have fewer
+        memmove(latencies + latency_count, connections[i].latencies,
+                connections[i].answers * sizeof(uint64_t));
+        latency_count += connections[i].answers;
+        errors += connections[i].errors;
+
+        if(connections[i].failed) {
+            fprintf(stderr, "load_generator: connection %zu failed\n", i);
+        }
+    }
+
+    elapsed = (load_now() - start) / 1e9;
+
+
+    if(latency_count == 0) {
+
+        fprintf(stderr, "load_generator: no answers were received\n");
+        return EXIT_FAILURE;
+    }
+
+    qsort(latencies, latency_count, sizeof(uint64_t), &load_compare);
+
+    printf("requests:   %zu (%zu errors)\n", latency_count, errors);
+    printf("p50:        %.1f us\n", latencies[latency_count / 2] / 1e3);
+    printf("p99:        %.1f us\n",
+           latencies[(latency_count * 99) / 100] / 1e3);
+    printf("throughput: %.0f requests/s\n", latency_count / elapsed);
+
+
+    free(latencies);
+    free(threads);
+    free(connections);
+    free(line);
+
+
+    return (latency_count == connection_count * requests) ? EXIT_SUCCESS
+                                                          : EXIT_FAILURE;
+}
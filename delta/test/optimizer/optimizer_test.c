@@ -0,0 +1,214 @@
+/**
+ * @file optimizer_test.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Test of the common subexpression elimination of the optimizer (see
+ *        interpreter/optimizer.h) around assignments.
+ *
+ * @details
+ *  Builds the ASTs of a few expressions, optimizes and compiles them, and
+ *  checks how many multiplications their programs compute, as well as the
+ *  values that they give when run, with a = 2 and b = 3:
+ *
+ *    - "a*b + a*b", which computes "a*b" once.
+ *
+ *    - "x = a*b + a*b", which computes "a*b" once too, as "x" is not read.
+ *
+ *    - "x = a*b + (a = a*b) + a*b", which computes all three, as "a" is
+ *      assigned between them.
+ *
+ *    delta_optimizer_test
+ */
+
+
+#include "api/delta.h"
+
+#include "common/arena.h"
+#include "common/context.h"
+#include "common/symbol_table.h"
+#include "interpreter/ast.h"
+#include "interpreter/bytecode.h"
+#include "interpreter/optimizer.h"
+#include "interpreter/vm.h"
+
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/** Symbol table entries of the variables that the expressions use. */
+struct d_symbol_table_entry *test_a = NULL;
+struct d_symbol_table_entry *test_b = NULL;
+struct d_symbol_table_entry *test_x = NULL;
+
+
+/**
+ * @brief Returns a new node that reads the given variable.
+ */
+struct d_ast_node *test_variable(
+    struct d_arena *arena,
+    struct d_symbol_table_entry *entry
+)
+{
+    return d_ast_new_identifier(arena, D_AST_VARIABLE, entry, 1, 1);
+}
+
+
+/**
+ * @brief Returns a new "a*b" node.
+ */
+struct d_ast_node *test_product(
+    struct d_arena *arena
+)
+{
+    return d_ast_new_operation(arena, '*', test_variable(arena, test_a),
+                               test_variable(arena, test_b), 1, 1);
+}
+
+
+/**
+ * @brief Sets the given variable to the given integer.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int test_set(
+    struct d_context *context,
+    const char *name,
+    int64_t integer
+)
+{
+    struct d_dec_number value;
+
+
+    memset(&value, 0, sizeof(value));
+    value.values.integer = integer;
+
+
+    return d_ctx_set_var(context, name, &value);
+}
+
+
+/**
+ * @brief Optimizes, compiles and runs the given AST, with a = 2 and b = 3.
+ *
+ * @return 0 if its program computes the given amount of multiplications and
+ *         its value is the given one, any other value otherwise.
+ */
+int test_check(
+    struct d_context *context,
+    struct d_arena *arena,
+    const char *name,
+    struct d_ast_node *root,
+    size_t multiplications,
+    int64_t expected
+)
+{
+    struct d_bytecode bytecode;
+    struct d_dec_number value;
+    size_t count = 0;
+    size_t i = 0;
+
+
+    if(root == NULL || test_set(context, "a", 2) != 0 ||
+       d_optimizer_optimize(root, arena) != 0 ||
+       d_bytecode_compile(root, arena, &bytecode) != 0 ||
+       d_vm_execute(context, &bytecode, 1, &value) != 0) {
+
+        fprintf(stderr, "optimizer_test: \"%s\" could not be run\n", name);
+        return -1;
+    }
+
+    for(i = 0; i < bytecode.instruction_count; ++i) {
+
+        if(bytecode.instructions[i].opcode == D_OP_MUL_INTEGER ||
+           bytecode.instructions[i].opcode == D_OP_MUL_ANY) {
+            ++count;
+        }
+    }
+
+    if(count != multiplications || value.is_floating || value.is_array ||
+       value.values.integer != expected) {
+
+        fprintf(stderr, "optimizer_test: \"%s\" computes %zu "
+                        "multiplications and gives %" PRId64 ", instead of "
+                        "%zu and %" PRId64 "\n", name, count,
+                value.values.integer, multiplications, expected);
+        return -1;
+    }
+
+    printf("%-28s %zu multiplications, %" PRId64 "\n", name, count,
+           value.values.integer);
+
+
+    return 0;
+}
+
+
+int main(void)
+{
+    struct d_context *context = NULL;
+    struct d_arena arena;
+    struct d_ast_node *root = NULL;
+    int result = 0;
+
+
+    if((context = d_ctx_new()) == NULL ||
+       test_set(context, "a", 2) != 0 || test_set(context, "b", 3) != 0 ||
+       test_set(context, "x", 0) != 0 ||
+       d_arena_initialize(&arena, D_ARENA_DEFAULT_BLOCK_SIZE) != 0) {
+
+        fprintf(stderr, "optimizer_test: could not set up the interpreter\n");
+        return EXIT_FAILURE;
+    }
+
+    test_a = d_symbol_table_search(context->symbol_table, "a");
+    test_b = d_symbol_table_search(context->symbol_table, "b");
+    test_x = d_symbol_table_search(context->symbol_table, "x");
+
+
+    /* a*b + a*b */
+
+    root = d_ast_new_operation(&arena, '+', test_product(&arena),
+                               test_product(&arena), 1, 1);
+    result |= test_check(context, &arena, "a*b + a*b", root, 1, 12);
+
+
+    /* x = a*b + a*b */
+
+    root = d_ast_new_unary(&arena, D_AST_ASSIGNMENT, test_x,
+                           d_ast_new_operation(&arena, '+',
+                                               test_product(&arena),
+                                               test_product(&arena), 1, 1),
+                           1, 1);
+    result |= test_check(context, &arena, "x = a*b + a*b", root, 1, 12);
+
+
+    /* x = a*b + (a = a*b) + a*b */
+
+    root = d_ast_new_unary(
+               &arena, D_AST_ASSIGNMENT, test_x,
+               d_ast_new_operation(
+                   &arena, '+',
+                   d_ast_new_operation(
+                       &arena, '+', test_product(&arena),
+                       d_ast_new_unary(&arena, D_AST_ASSIGNMENT, test_a,
+                                       test_product(&arena), 1, 1),
+                       1, 1
+                   ),
+                   test_product(&arena), 1, 1
+               ),
+               1, 1
+           );
+    result |= test_check(context, &arena, "x = a*b + (a = a*b) + a*b", root,
+                         3, 30);
+
+
+    d_arena_destroy(&arena);
+    d_ctx_free(context);
+
+
+    return (result == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
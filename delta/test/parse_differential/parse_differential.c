@@ -0,0 +1,247 @@
+/**
+ * @file parse_differential.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Differential test of how the lexemes of numbers are converted (see
+ *        math/dec_parse.h) against strtoll and strtod.
+ *
+ * @details
+ *  Generates the given amount of random lexemes of each kind (1000000 by
+ *  default), in every shape that the lexical analyzer hands over:
+ *
+ *    - Integers, from a few digits to far more than an int64_t holds, which
+ *      must be converted just as strtoll would, and reported as out of range
+ *      whenever it saturates.
+ *
+ *    - Floating point numbers, such as "12.", ".5", "1.5e-3" or "7E+300",
+ *      with random digits (up to far more than 19 of them), and with those
+ *      of doubles and of the midpoints between consecutive doubles, which
+ *      must be converted to the very same double as strtod.
+ *
+ *    delta_parse_differential [lexemes] [seed]
+ *
+ *  The first lexeme for which both differ, if any, is shown.
+ */
+
+
+#include "math/dec_parse.h"
+
+
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/** Longest lexeme, '\0' included. */
+#define DIFFERENTIAL_LEXEME_SIZE 512
+
+
+/**
+ * @brief Returns the next number of a xorshift64* generator.
+ */
+uint64_t differential_random(
+    uint64_t *state
+)
+{
+    *state ^= *state >> 12;
+    *state ^= *state << 25;
+    *state ^= *state >> 27;
+
+
+    return *state * UINT64_C(2685821657736338717);
+}
+
+
+/**
+ * @brief Writes the given amount of random digits.
+ *
+ * @return How many characters have been written.
+ */
+size_t differential_digits(
+    uint64_t *state,
+    char *lexeme,
+    size_t count
+)
+{
+    size_t i = 0;
+
+
+    for(i = 0; i < count; ++i) {
+        // Zeros are more likely, as runs of them are where it gets tricky
+        lexeme[i] = (differential_random(state) % 3 == 0) ?
+                        '0' : (char) ('0' + differential_random(state) % 10);
+    }
+
+
+    return count;
+}
+
+
+/**
+ * @brief Writes a random lexeme of a floating point number.
+ */
+void differential_floating(
+    uint64_t *state,
+    char *lexeme
+)
+{
+    uint64_t shape = differential_random(state);
+    uint64_t bits = 0;
+    double value = 0;
+    long double midpoint = 0;
+    size_t length = 0;
+
+
+    switch(shape % 4) {
+
+        // Random digits, in any of the lexer's shapes
+        case 0:
+        case 1:
+
+            if(shape & 4) {
+                length += differential_digits(state, lexeme + length,
+                                              1 + differential_random(state)
+                                                  % 30);
+            }
+
+            if(!(shape & 4) || (shape & 8)) {
+
+                lexeme[length++] = '.';
+
+                if(!(shape & 4) || (shape & 16)) {
+                    length += differential_digits(
+                                  state, lexeme + length,
+                                  1 + differential_random(state) % 30);
+                }
+            }
+
+            if(shape & 32) {
+                length += (size_t) snprintf(lexeme + length, 16, "%c%s%d",
+                                            (shape & 64) ? 'e' : 'E',
+                                            (shape & 128) ? "-" :
+                                            (shape & 256) ? "+" : "",
+                                            (int) (differential_random(state)
+                                                   % 360));
+            }
+
+            lexeme[length] = '\0';
+            break;
+
+        // The digits of a double
+        case 2:
+
+            bits = differential_random(state) & ~(UINT64_C(1) << 63);
+            memcpy(&value, &bits, sizeof(value));
+
+            if(!isfinite(value)) {
+                value = 1.5;
+            }
+
+            snprintf(lexeme, DIFFERENTIAL_LEXEME_SIZE, "%.*e",
+                     (int) (differential_random(state) % 25), value);
+            break;
+
+        // The digits of the midpoint between a double and the next one,
+        // which must be rounded to even
+        default:
+
+            bits = differential_random(state) & ~(UINT64_C(1) << 63);
+            memcpy(&value, &bits, sizeof(value));
+
+            if(!isfinite(value)) {
+                value = 1.5;
+            }
+
+            midpoint = ((long double) value +
+                        (long double) nextafter(value, INFINITY)) / 2;
+            snprintf(lexeme, DIFFERENTIAL_LEXEME_SIZE, "%.*Le",
+                     (int) (15 + differential_random(state) % 100),
+                     midpoint);
+            break;
+    }
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 1000000;
+    uint64_t state = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1;
+    size_t i = 0;
+
+    char lexeme[DIFFERENTIAL_LEXEME_SIZE];
+    size_t length = 0;
+    int64_t expected_integer = 0;
+    int64_t integer = 0;
+    int is_out_of_range = 0;
+    double expected_floating = 0;
+    double floating = 0;
+    int result = 0;
+
+
+    if(state == 0) {
+        state = 1;
+    }
+
+
+    for(i = 0; i < count; ++i) {
+
+        /* Integers */
+
+        length = differential_digits(&state, lexeme,
+                                     1 + differential_random(&state) % 24);
+        lexeme[length] = '\0';
+
+        errno = 0;
+        expected_integer = strtoll(lexeme, NULL, 10);
+        is_out_of_range = errno == ERANGE;
+
+        // The lexeme is followed by garbage, as it does not need to be '\0'
+        // terminated
+        lexeme[length] = '7';
+        result = d_dec_parse_integer(lexeme, length, &integer);
+
+        if(integer != expected_integer ||
+           result != (is_out_of_range ? D_DEC_PARSE_OUT_OF_RANGE : 0)) {
+
+            lexeme[length] = '\0';
+            fprintf(stderr, "parse_differential: \"%s\": expected %" PRId64
+                            "%s, got %" PRId64 " (%d)\n", lexeme,
+                    expected_integer, is_out_of_range ? " (out of range)" : "",
+                    integer, result);
+            return EXIT_FAILURE;
+        }
+
+
+        /* Floating point numbers */
+
+        differential_floating(&state, lexeme);
+        length = strlen(lexeme);
+
+        expected_floating = strtod(lexeme, NULL);
+
+        lexeme[length] = '5';
+        result = d_dec_parse_floating(lexeme, length, &floating);
+        lexeme[length] = '\0';
+
+        if(result != 0 ||
+           memcmp(&floating, &expected_floating, sizeof(floating)) != 0) {
+
+            fprintf(stderr, "parse_differential: \"%s\": expected %a, got %a "
+                            "(%d)\n", lexeme, expected_floating, floating,
+                    result);
+            return EXIT_FAILURE;
+        }
+    }
+
+
+    printf("parse_differential: %zu lexemes of each kind, no differences\n",
+           count);
+
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,482 @@
+/**
+ * @file scanner_differential.c
+ * @author Álvaro Goldar Dieste
+ * @date Oct 2026
+ *
+ * @brief Differential test of the batch scanner (see
+ *        analyzers/batch_scanner.h) against flex's.
+ *
+ * @details
+ *  Generates the given amount of random texts (100000 by default), made up
+ *  of fragments of what delta's lexemes look like (and of what they should
+ *  not look like: malformed numbers, unclosed strings, characters that are
+ *  not supported...), so that every rule of lexical.l gets exercised.
+ *
+ *  Each text is analyzed by two interpreters, one through flex's scanner and
+ *  the other through the batch one, and every lexical component, along with
+ *  its semantic value and location, as well as every error that is shown,
+ *  must be the same:
+ *
+ *    delta_scanner_differential [texts] [seed]
+ *
+ *  The first text in which both scanners differ, if any, is shown.
+ */
+
+
+// fileno, ftruncate, pread
+#define _POSIX_C_SOURCE 200809L
+
+
+#include "api/delta.h"
+
+#include "analyzers/lexical.h"
+#include "common/lexical_comp.h"
+#include "common/symbol_table.h"
+
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+
+/** Most fragments that a text may have. */
+#define DIFFERENTIAL_FRAGMENT_COUNT 32
+
+/** Every this many texts, one is much longer than flex's buffer. */
+#define DIFFERENTIAL_LONG_TEXT_PERIOD 1000
+
+/** Most fragments that a long text may have. */
+#define DIFFERENTIAL_LONG_FRAGMENT_COUNT 4096
+
+
+/** Fragments of which the texts are made up; the empty one stands for a
+    '\0' character. */
+const char *DIFFERENTIAL_FRAGMENTS[] = {
+    "0", "1", "7", "42", "3.", "1.5", ".5", ".", "..", "e", "E", "e+", "E-",
+    "+", "-", "*", "/", "%", "^", "=", ";", "(", ")", "[", "]", ",", "_",
+    "x", "b", "B", "abc", "sqrt", "pi", "load", " ", "  ", "\t", "\n", "\n", "\"", "\"\"",
+    "\"a b\"", "\"x\" \"", "\xC2\xB2", "\xFF", "\x7F", "#", "!", "",
+    "1e5", "2.5E-3", "1e_", "1e+_", "4e5_6", "4e5_x", "4e+5x", "12ab",
+    "1.x", "1.5b", "1.5e+", "12345678901234567890123",
+    "abcdefghijklmnopqrstuvwxyz_ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789",
+    "                                        ",
+    "\"a string that is longer than a whole block of characters\""
+};
+
+
+/**
+ * @brief A lexical component, as recognized by a scanner.
+ */
+struct differential_token {
+    /** The lexical component. */
+    int lexical_component;
+    /** Its semantic value. */
+    YYSTYPE value;
+    /** Its location. */
+    YYLTYPE location;
+    /** If it is a literal string, where its copy starts (see
+        differential_result.strings). */
+    size_t string_offset;
+};
+
+
+/**
+ * @brief What a scanner has recognized in a text.
+ */
+struct differential_result {
+    /** The lexical components. */
+    struct differential_token *tokens;
+    /** How many lexical components there are. */
+    size_t token_count;
+    /** How many lexical components fit. */
+    size_t token_capacity;
+    /** Copies of the literal strings, as the scanners only keep them until
+        the next line starts. */
+    char *strings;
+    /** Length of the copies. */
+    size_t strings_length;
+    /** How many characters fit. */
+    size_t strings_capacity;
+    /** What has been written to stderr (i.e. the errors). */
+    char *errors;
+    /** Length of the errors. */
+    size_t errors_length;
+};
+
+
+/** State of the pseudo-random generator (xorshift64). */
+uint64_t differential_state = 1;
+
+
+/**
+ * @brief Returns a pseudo-random number lower than the given one.
+ */
+size_t differential_random(
+    size_t bound
+)
+{
+    differential_state ^= differential_state << 13;
+    differential_state ^= differential_state >> 7;
+    differential_state ^= differential_state << 17;
+
+
+    return (size_t) (differential_state % bound);
+}
+
+
+/**
+ * @brief Generates a random text into the given buffer.
+ *
+ * @return The length of the text.
+ */
+size_t differential_generate(
+    char *text,
+    size_t fragment_count
+)
+{
+    size_t count = sizeof(DIFFERENTIAL_FRAGMENTS) /
+                   sizeof(DIFFERENTIAL_FRAGMENTS[0]);
+    size_t length = 0;
+    size_t fragment_length = 0;
+    size_t i = 0;
+    const char *fragment = NULL;
+
+
+    fragment_count = 1 + differential_random(fragment_count);
+
+    for(i = 0; i < fragment_count; ++i) {
+
+        fragment = DIFFERENTIAL_FRAGMENTS[differential_random(count)];
+        fragment_length = strlen(fragment);
+
+        if(fragment_length == 0) {
+            text[length++] = '\0';
+        }
+        else {
+            memcpy(text + length, fragment, fragment_length);
+            length += fragment_length;
+        }
+    }
+
+
+    return length;
+}
+
+
+/**
+ * @brief Analyzes the given text through the given interpreter, whose
+ *        errors are written to the given file.
+ *
+ * @return 0 if successful, any other value otherwise.
+ */
+int differential_scan(
+    struct d_context *context,
+    const char *text,
+    size_t length,
+    int errors_descriptor,
+    struct differential_result *result
+)
+{
+    struct differential_token *token = NULL;
+    int stderr_descriptor = -1;
+    off_t errors_length = 0;
+
+
+    result->token_count = 0;
+    result->strings_length = 0;
+
+    if(ftruncate(errors_descriptor, 0) != 0 ||
+       lseek(errors_descriptor, 0, SEEK_SET) != 0 ||
+       (stderr_descriptor = dup(STDERR_FILENO)) < 0) {
+        return -1;
+    }
+
+    fflush(stderr);
+    dup2(errors_descriptor, STDERR_FILENO);
+
+    d_lexical_analyzer_new_string(context, text, length);
+
+    do {
+
+        if(result->token_count == result->token_capacity) {
+
+            result->token_capacity = 2 * result->token_capacity + 64;
+            result->tokens = realloc(result->tokens,
+                                     result->token_capacity *
+                                     sizeof(struct differential_token));
+
+            if(result->tokens == NULL) {
+                return -1;
+            }
+        }
+
+        token = &result->tokens[result->token_count++];
+        memset(token, 0, sizeof(struct differential_token));
+
+        // The end of a text is reported as 0
+        token->lexical_component = yylex(&token->value, &token->location,
+                                         context);
+
+        if(token->lexical_component == D_LC_LITERAL_STR) {
+
+            if(result->strings_length + token->value.string.length >
+               result->strings_capacity) {
+
+                result->strings_capacity = 2 * result->strings_capacity +
+                                           token->value.string.length;
+                result->strings = realloc(result->strings,
+                                          result->strings_capacity);
+
+                if(result->strings == NULL) {
+                    return -1;
+                }
+            }
+
+            token->string_offset = result->strings_length;
+            memcpy(result->strings + result->strings_length,
+                   token->value.string.text, token->value.string.length);
+            result->strings_length += token->value.string.length;
+        }
+
+    } while(token->lexical_component != 0);
+
+    fflush(stderr);
+    dup2(stderr_descriptor, STDERR_FILENO);
+    close(stderr_descriptor);
+
+
+    if((errors_length = lseek(errors_descriptor, 0, SEEK_END)) < 0) {
+        return -1;
+    }
+
+    free(result->errors);
+    result->errors_length = (size_t) errors_length;
+
+    if((result->errors = malloc(result->errors_length + 1)) == NULL ||
+       pread(errors_descriptor, result->errors, result->errors_length, 0) !=
+       errors_length) {
+        return -1;
+    }
+
+
+    return 0;
+}
+
+
+/**
+ * @brief Returns whether two lexical components are the same.
+ */
+int differential_same_token(
+    const struct differential_result *a_result,
+    const struct differential_token *a,
+    const struct differential_result *b_result,
+    const struct differential_token *b
+)
+{
+    if(a->lexical_component != b->lexical_component ||
+       memcmp(&a->location, &b->location, sizeof(YYLTYPE)) != 0) {
+        return 0;
+    }
+
+
+    switch(a->lexical_component) {
+
+        case D_LC_LITERAL_INT:
+            return a->value.dec_number.values.integer ==
+                   b->value.dec_number.values.integer;
+
+        // Bit by bit, so that NaNs are the same too
+        case D_LC_LITERAL_FP:
+            return memcmp(&a->value.dec_number.values.floating,
+                          &b->value.dec_number.values.floating,
+                          sizeof(a->value.dec_number.values.floating)) == 0;
+
+        case D_LC_LITERAL_STR:
+            return a->value.string.length == b->value.string.length &&
+                   memcmp(a_result->strings + a->string_offset,
+                          b_result->strings + b->string_offset,
+                          a->value.string.length) == 0;
+
+        // Each interpreter has its own symbol table
+        case D_LC_IDENTIFIER_COMMAND:
+        case D_LC_IDENTIFIER_CONSTANT:
+        case D_LC_IDENTIFIER_FUNCTION:
+        case D_LC_IDENTIFIER_VARIABLE:
+            return strcmp(a->value.st_entry->lexeme,
+                          b->value.st_entry->lexeme) == 0;
+    }
+
+
+    return 1;
+}
+
+
+/**
+ * @brief Shows a lexical component.
+ */
+void differential_show_token(
+    const char *scanner,
+    const struct differential_token *token
+)
+{
+    fprintf(stderr, "  %-6s component %d at ln %d : col %d - ln %d : "
+                    "col %d\n", scanner, token->lexical_component,
+            token->location.first_line, token->location.first_column,
+            token->location.last_line, token->location.last_column);
+}
+
+
+/**
+ * @brief Shows the text in which both scanners differ, escaping whatever
+ *        is not printable.
+ */
+void differential_show_text(
+    const char *text,
+    size_t length
+)
+{
+    size_t i = 0;
+
+
+    fprintf(stderr, "  text: \"");
+
+    for(i = 0; i < length; ++i) {
+
+        if(text[i] == '\n') {
+            fprintf(stderr, "\\n");
+        }
+        else if(text[i] == '"' || text[i] == '\\') {
+            fprintf(stderr, "\\%c", text[i]);
+        }
+        else if(text[i] >= ' ' && text[i] < 0x7F) {
+            fputc(text[i], stderr);
+        }
+        else {
+            fprintf(stderr, "\\x%02X", (unsigned char) text[i]);
+        }
+    }
+
+    fprintf(stderr, "\"\n");
+}
+
+
+int main(int argc, char *argv[])
+{
+    size_t text_count = (argc > 1) ? strtoul(argv[1], NULL, 10) : 100000;
+    size_t token_count = 0;
+    size_t length = 0;
+    size_t i = 0;
+    size_t j = 0;
+
+    struct d_context *flex_context = NULL;
+    struct d_context *batch_context = NULL;
+    struct differential_result flex_result;
+    struct differential_result batch_result;
+    FILE *flex_errors = NULL;
+    FILE *batch_errors = NULL;
+    char *text = NULL;
+
+
+    differential_state = (argc > 2) ? strtoull(argv[2], NULL, 10) : 1;
+
+    if(differential_state == 0) {
+        differential_state = 1;
+    }
+
+    memset(&flex_result, 0, sizeof(flex_result));
+    memset(&batch_result, 0, sizeof(batch_result));
+
+    if((text = malloc(DIFFERENTIAL_LONG_FRAGMENT_COUNT * 128)) == NULL ||
+       (flex_context = d_ctx_new()) == NULL ||
+       (batch_context = d_ctx_new()) == NULL ||
+       (flex_errors = tmpfile()) == NULL ||
+       (batch_errors = tmpfile()) == NULL ||
+       d_lexical_analyzer_use_batch_scanner(flex_context, 0) != 0 ||
+       d_lexical_analyzer_use_batch_scanner(batch_context, 1) != 0) {
+
+        fprintf(stderr, "scanner_differential: could not set up the "
+                        "interpreters\n");
+        return EXIT_FAILURE;
+    }
+
+
+    for(i = 0; i < text_count; ++i) {
+
+        length = differential_generate(text,
+                     (i % DIFFERENTIAL_LONG_TEXT_PERIOD == 0) ?
+                         DIFFERENTIAL_LONG_FRAGMENT_COUNT :
+                         DIFFERENTIAL_FRAGMENT_COUNT);
+
+        if(differential_scan(flex_context, text, length,
+                             fileno(flex_errors), &flex_result) != 0 ||
+           differential_scan(batch_context, text, length,
+                             fileno(batch_errors), &batch_result) != 0) {
+
+            fprintf(stderr, "scanner_differential: could not analyze text "
+                            "%zu\n", i);
+            return EXIT_FAILURE;
+        }
+
+
+        for(j = 0; j < flex_result.token_count &&
+                   j < batch_result.token_count; ++j) {
+
+            if(!differential_same_token(&flex_result, &flex_result.tokens[j],
+                                        &batch_result,
+                                        &batch_result.tokens[j])) {
+                break;
+            }
+        }
+
+        if(j < flex_result.token_count || j < batch_result.token_count) {
+
+            fprintf(stderr, "scanner_differential: text %zu, lexical "
+                            "component %zu differs\n", i, j);
+            differential_show_text(text, length);
+
+            if(j < flex_result.token_count) {
+                differential_show_token("flex", &flex_result.tokens[j]);
+            }
+            if(j < batch_result.token_count) {
+                differential_show_token("batch", &batch_result.tokens[j]);
+            }
+
+            return EXIT_FAILURE;
+        }
+
+        if(flex_result.errors_length != batch_result.errors_length ||
+           memcmp(flex_result.errors, batch_result.errors,
+                  flex_result.errors_length) != 0) {
+
+            fprintf(stderr, "scanner_differential: text %zu, errors "
+                            "differ\n", i);
+            differential_show_text(text, length);
+            fprintf(stderr, "  flex:\n%.*s  batch:\n%.*s",
+                    (int) flex_result.errors_length, flex_result.errors,
+                    (int) batch_result.errors_length, batch_result.errors);
+
+            return EXIT_FAILURE;
+        }
+
+        token_count += flex_result.token_count;
+    }
+
+
+    printf("%zu texts, %zu lexical components: both scanners agree\n",
+           text_count, token_count);
+
+    d_ctx_free(flex_context);
+    d_ctx_free(batch_context);
+    free(flex_result.tokens);
+    free(flex_result.errors);
+    free(flex_result.strings);
+    free(batch_result.tokens);
+    free(batch_result.errors);
+    free(batch_result.strings);
+    free(text);
+
+
+    return EXIT_SUCCESS;
+}